@@ -21,6 +21,8 @@
 
 #include <string>
 #include <cstdint>
+#include <cstddef>
+#include "socket_options.hpp"
 
 /************************************************/
 /*                  Class                       */
@@ -35,6 +37,32 @@ class arguments
         uint16_t port               = 4567;         //!< Port Number on Which The Server Is Listening
         uint16_t confirmTimeOutUDP  = 250;          //!< Time Out For UDP Protocol
         uint8_t confirmRetriesUDP   = 3;            //!< Number of Retries For UDP Protocol
+        uint32_t connectTimeOut     = 5000;         //!< Deadline For Resolution And Connection In Milliseconds
+        SocketOptions_t socketOptions;              //!< Socket Tuning Profile And Custom Options
+        bool kernelTimestamps       = false;        //!< Report Network RTT From Kernel Timestamps (UDP)
+        std::string captureFile;                    //!< pcapng File Recording The Session
+        std::string traceFile;                      //!< Chrome Trace JSON With Stages of Every Message
+        std::string replayFile;                     //!< pcapng File Whose Server Traffic Is Replayed
+        bool replayMaxSpeed         = false;        //!< Replay Without Recorded Gaps
+        std::string recordHistoryFile;              //!< History Log Appended By This Session
+        std::string historyFile;                    //!< History Log To Dump
+        uint64_t historyLast        = 0;            //!< Number of Newest Records To Dump, 0 For All
+        size_t searchMemory         = 16;           //!< Memory Cap of Search Index In MiB, 0 Disables It
+        std::string sessionsFile;                   //!< File Listing Sessions Run In One Event Loop
+        double sendRate             = 0.0;          //!< Paced Messages Per Second, 0 For No Limit
+        uint32_t sendBurst          = 1;            //!< Messages Which May Leave Back To Back
+        bool retransmitsPaced       = false;        //!< UDP Retransmissions Take Tokens Too
+        uint32_t reconnectAttempts  = 0;            //!< Reconnects After Server Drops TCP Session, 0 Disables It
+        uint32_t reconnectDelay     = 500;          //!< First Backoff Step Before Reconnect In Milliseconds
+        uint32_t drainTimeout       = 2000;         //!< Queued Messages May Be Sent This Long After Signal, In Milliseconds
+        std::string sendFile;                       //!< File Whose Lines Are Sent As Messages After Authentication
+        bool jsonlOutput            = false;        //!< Received Messages As JSON Lines Instead of Text
+        std::string outputFile;                     //!< File For JSON Lines, Empty For STDOUT
+        std::string inputFormat     = "text";       //!< Input Format (text, jsonl, binary)
+        int inputFd                 = 0;            //!< Descriptor of Structured Input
+        std::string shmRing;                        //!< Shared Object With Input And Output Rings, Empty For None
+        std::string listenPath;                     //!< Unix Socket Shared By Local Processes, Empty For None
+        bool daemon                 = false;        //!< Detach Into Background After Socket Is Bound
         /**
          * @brief Constructor
          * @param argc Number of Arguments
@@ -71,7 +99,7 @@ class arguments
         /**
          * @brief Resolves Host Name
          * 
-         * Resolves Host Name To IP Address
+         * Stores IP Address If Host Name Is IP Address, Other Names Are Resolved By Client
         */        
         void resolveHostName();                        // Resolves Host Name To IP Address Declaration
         /**
@@ -0,0 +1,56 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      backoff.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Exponential Backoff With Jitter.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           backoff.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Exponential Backoff With Jitter.
+ * ****************************/
+
+#ifndef BACKOFF_HPP
+#define BACKOFF_HPP
+
+#include <chrono>
+#include <random>
+
+/**
+ * @brief Delays Between Repeated Attempts, Doubled After Each One Up To Cap
+ *
+ * Each Delay Is Random Between Half And Whole of The Current Step, So
+ * Clients Dropped By One Server Outage Do Not Come Back At The Same Time.
+ */
+class Backoff
+{
+    public:
+        /**
+         * @brief Constructor of Backoff
+         * @param initial Step Before The First Attempt
+         * @param maximum Cap of The Step
+         */
+        Backoff(std::chrono::milliseconds initial, std::chrono::milliseconds maximum);
+        /**
+         * @brief Returns Delay Before The Next Attempt And Doubles The Step
+         * @return Delay With Jitter
+         */
+        std::chrono::milliseconds next();
+        /**
+         * @brief Starts Again From The Initial Step
+         */
+        void reset();
+
+    private:
+        std::chrono::milliseconds initialDelay;
+        std::chrono::milliseconds maxDelay;
+        std::chrono::milliseconds step;     //!< Upper Bound of The Next Delay
+        std::mt19937 generator;
+};
+
+#endif // BACKOFF_HPP
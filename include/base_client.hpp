@@ -31,17 +31,100 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <vector>
+#include <chrono>
+#include "macros.hpp"
+#include "resolver.hpp"
+#include "socket_options.hpp"
+#include "token_bucket.hpp"
+#include "trace.hpp"
+#include "file_sender.hpp"
 
 class Client 
 {
     private:
-        std::string _serverAddress;   //!< IP Address of The Server
+        std::string _serverAddress;   //!< Host Name or IP Address of The Server
         int _port;                    //!< Port Number on Which The Server Is Listening
         uint _protocol;               //!< Protocol used by the client (TCP/UDP)
+        int _connectTimeOut;          //!< Deadline For Resolution And Connection In Milliseconds
+    protected:
+        SocketOptions_t socketOptions;          //!< Tuning Applied To Every Created Socket
+        TokenBucket pacing;                     //!< Limits Messages Put On The Wire
+        bool retransmitsPaced = false;          //!< Retransmissions Take Tokens Too, Otherwise They Bypass pacing
+        uint64_t replyAwaitedSince = 0;         //!< Trace Start of Waiting For REPLY, 0 If Not Traced
+        uint32_t replyMessage = 0;              //!< Trace Number of The Message Awaiting REPLY
+        FileSender fileSender;                  //!< File Streamed As MSG When Flow Control Allows
+
+        /**
+         * @brief Starts Resolution of Server's Host Name On Resolver Thread
+         * @param resolver Resolver Whose Descriptor Is Awaited By The Session
+         *
+         * @return SUCCESS If The Resolver Thread Was Started, Otherwise CONNECT_FAILED
+         */
+        int startResolution(Resolver& resolver);
+        /**
+         * @brief Collects Resolved Addresses Ordered For Racing
+         * @param resolver Resolver Whose Descriptor Became Readable
+         * @param addresses Destination of The Addresses
+         *
+         * @return SUCCESS If At Least One Address Was Resolved, Otherwise CONNECT_FAILED
+         */
+        int collectAddresses(Resolver& resolver, std::vector<Resolver::Address_t>& addresses);
+        /**
+         * @brief Starts Non-Blocking TCP Connect To One Address
+         * @param address Server's Address
+         * @param established Set If The Connection Was Established At Once
+         *
+         * @return Connecting Socket, NOT_CONNECTED If The Attempt Failed At Once (errno Is Kept)
+         */
+        int startAttempt(const Resolver::Address_t& address, bool& established);
+        /**
+         * @brief Returns Result of Connect Attempt Whose Socket Became Writable
+         * @param attemptSock Connecting Socket
+         *
+         * @return 0 If Connected, Otherwise errno of The Attempt
+         */
+        static int attemptError(int attemptSock);
+        /**
+         * @brief Keeps Connected Socket As sock
+         * @param attemptSock Socket Which Won The Race
+         * @param address Its Server's Address
+         */
+        void adoptConnection(int attemptSock, const Resolver::Address_t& address);
+        /**
+         * @brief Creates Socket For Every UDP Address, The First One Becomes sock
+         * @param addresses Ordered Server's Addresses
+         *
+         * @return SUCCESS If At Least One Socket Was Created, Otherwise CONNECT_FAILED
+         */
+        int prepareCandidates(const std::vector<Resolver::Address_t>& addresses);
+        /**
+         * @brief Returns Server's Host Name or Address As Given By The User
+         */
+        const std::string& getServerAddress() const { return _serverAddress; }
+        /**
+         * @brief Returns Deadline For Resolution And Connection In Milliseconds
+         */
+        int getConnectTimeOut() const { return _connectTimeOut; }
+        /**
+         * @brief Determine If The Client Uses TCP
+         */
+        bool usesTcp() const { return TCP == _protocol; }
     public:
+        /**
+         * @brief Server Address Competing For The UDP Session
+         */
+        struct Candidate_t
+        {
+            int sock;                   //!< Socket Used For This Address
+            Resolver::Address_t address;//!< Server's Address
+            bool started;               //!< AUTH Was Already Sent To This Address
+        };
 
         int sock;                     //!< File Descriptor of The Socket Used For Communication
-        struct sockaddr_in server;    //!< Structure Containing Server's Address Information
+        struct sockaddr_storage server;         //!< Structure Containing Server's Address Information
+        std::vector<Candidate_t> candidates;    //!< UDP Addresses Racing Until One Answers AUTH
+
+        static constexpr int CONNECTION_ATTEMPT_DELAY = 250;    //!< Delay Between Racing Attempts (RFC 8305)
 
         static constexpr uint TCP = 99u;
         static constexpr uint UDP = 100u;
@@ -57,14 +140,16 @@ class Client
         };
         /**
          * @brief Constructor of TcpClient Class 
-         * @param addr Server's Address 
+         * @param addr Server's Host Name or Address 
          * @param port Server's Port
          * @param protocol Protocol Used For Communication
+         * @param connectTimeOut Deadline For Resolution And Connection In Milliseconds
          *
          * Constructor Initialize Client With Server's Address And Port.
-         * Default State of Socket Is Set To NOT_CONNECTED.
+         * Default State of Socket Is Set To NOT_CONNECTED, Connection Is
+         * Established Later By Session::connectToServer().
          */
-        Client(const std::string& addr, int port, uint protocol);
+        Client(const std::string& addr, int port, uint protocol, int connectTimeOut);
         /**
          * @brief Destructor of TcpClient Class 
          * 
@@ -90,7 +175,32 @@ class Client
          * 
          * Returns Server's Address Information.
         */
-        const struct sockaddr_in& getServerAddr() const;
+        const struct sockaddr_storage& getServerAddr() const;
+        /**
+         * @brief Closes The Socket, The Session May Connect Again
+         */
+        void disconnect();
+        /**
+         * @brief Sets Tuning Options Applied To Sockets Created While Connecting
+         * @param options Resolved Socket Options
+         */
+        void setSocketOptions(const SocketOptions_t& options);
+        /**
+         * @brief Sets Pacing of Outgoing Messages
+         * @param rate Messages Per Second, 0 Disables Pacing
+         * @param burst Messages Which May Leave Back To Back
+         * @param pacedRetransmits Retransmissions Take Tokens Too
+         */
+        void setPacing(double rate, uint32_t burst, bool pacedRetransmits);
+        /**
+         * @brief Starts Sending Lines of The File As Messages
+         * @param path Path of The File
+         *
+         * Lines Leave After Authentication, Each Only When Queued Input Was
+         * Sent And Pacing (UDP Also CONFIRM) Allows Another Message.
+         * @return SUCCESS If The File Is Mapped, Otherwise FAIL
+         */
+        int sendFile(const std::string& path);
 
 };
 
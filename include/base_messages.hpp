@@ -20,8 +20,10 @@
 
 #include "macros.hpp"
 #include "strings.hpp"
+#include "fixed_string.hpp"
 #include <string>
 #include <vector>
+#include <memory_resource>
 #include <cstdint>
 
 class BaseMessages {
@@ -35,6 +37,8 @@ public:
         MSG                 = 0x04,
         COMMAND_HELP        = 0x05,
         COMMAND_RENAME      = 0x06,
+        COMMAND_SEARCH      = 0x07,
+        COMMAND_SENDFILE    = 0x08,
         ERROR               = 0xFE,
         COMMAND_BYE         = 0xFF,
         UNKNOWN_MSG_TYPE    = 0x99,
@@ -47,27 +51,60 @@ public:
         INPUT_JOIN,
         INPUT_RENAME,
         INPUT_MSG,
-        INPUT_HELP
+        INPUT_HELP,
+        INPUT_SEARCH,
+        INPUT_SENDFILE
     };
 
+    using Username = FixedString<LENGHT_USERNAME>;
+    using Secret = FixedString<LENGHT_SECRET>;
+    using DisplayName = FixedString<LENGHT_DISPLAY_NAME>;
+    using ChannelID = FixedString<LENGHT_CHANNEL_ID>;
+
+    /**
+     * @brief Fields of The Message, Variable Ones Allocated From One Memory Resource
+     *
+     * Copy Construction Without Allocator Falls Back To The Default Resource
+     * (std::pmr Rule), Assignment Keeps The Resource of The Destination.
+     * Bounded Fields Are Stored Inline And Their Overflow Replaces Length Check.
+     */
     struct Message_t 
     {
-        MessageType_t type;
-        std::vector<char> content;
-        bool isCommand;
-        std::vector<char> login;
-        std::vector<char> secret;
-        std::vector<char> displayName;
-        std::vector<char> channelID;
-        std::vector<char> displayNameOutside;
-        std::vector<char> buffer;
+        using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+        Message_t() : Message_t(allocator_type()) {}
+        explicit Message_t(allocator_type alloc)
+            : content(alloc), buffer(alloc) {}
+        Message_t(const Message_t& other, allocator_type alloc)
+            : type(other.type), content(other.content, alloc), isCommand(other.isCommand), structured(other.structured), login(other.login),
+              secret(other.secret), displayName(other.displayName), channelID(other.channelID),
+              displayNameOutside(other.displayNameOutside), buffer(other.buffer, alloc) {}
+        Message_t(const Message_t&) = default;
+        Message_t& operator=(const Message_t&) = default;
+
+        MessageType_t type = UNKNOWN_MSG_TYPE;
+        CharBuffer content;
+        bool isCommand = false;
+        bool structured = false;            //!< Fields Filled By InputReader, buffer Is Not Parsed
+        Username login;
+        Secret secret;
+        DisplayName displayName;
+        ChannelID channelID;
+        DisplayName displayNameOutside;
+        CharBuffer buffer;
     };
 
     MessageType_t msgType;
     Message_t msg;
+    uint32_t traceMessage = 0;          //!< Number of The Message In Trace, Kept While It Is Queued
 
 
     BaseMessages();
+    /**
+     * @brief Constructor of Message Allocated From Memory Resource
+     * @param resource Arena or Pool For All Fields of The Message
+     */
+    explicit BaseMessages(std::pmr::memory_resource* resource);
     /**
      * @brief Constructor of TcpMessages Class 
      * @param type Type of The Message
@@ -95,7 +132,8 @@ public:
     void cleanMessage();
     /**
      * @brief Check If The Message Components Are Valid (ID, Display Name, Content, Secret Length)
-     * 
+     *
+     * Bounded Fields Are Too Long If They Overflowed While Being Filled.
      * @return SUCCESS If The Message Is Valid, Otherwise Returns NON_VALID_PARAM
      */    
     int checkLength();
@@ -130,18 +168,21 @@ public:
     int parseMessage();
     /**
      * @brief Prints Message to The Standard Output
+     * @param messageID UDP Message ID Shown In JSONL Output
     */    
-    void printMessage();
+    void printMessage(int32_t messageID = NO_MESSAGE_ID);
     /**
      * @brief Prints Servers Reply to The Standard Output
+     * @param messageID UDP Message ID Shown In JSONL Output
     */    
-    void PrintServerOkReply();
+    void PrintServerOkReply(int32_t messageID = NO_MESSAGE_ID);
   
-    void PrintServerNokReply();
+    void PrintServerNokReply(int32_t messageID = NO_MESSAGE_ID);
     /**
      * @brief Prints External Error Message to The Standard Output
+     * @param messageID UDP Message ID Shown In JSONL Output
     */      
-    void basePrintExternalError();
+    void basePrintExternalError(int32_t messageID = NO_MESSAGE_ID);
     /**
      * @brief Prints Internal Error Message to The Standard Output
      * @param retVal Return Code
@@ -149,6 +190,16 @@ public:
     void basePrintInternalError(int retVal);
     
     void printHelp();
+    /**
+     * @brief Prints Received Messages Matching Query Stored In Content
+    */
+    void printSearch();
+    /**
+     * @brief Appends Sent Message To History
+     * @param type Type of The Sent Message
+     * @param content Content of MSG or ERR, Secret of AUTH Is Never Stored
+    */
+    void recordSent(MessageType_t type, const std::string& content = "");
 };
 
 #endif // BASE_MESSAGES_HPP
@@ -0,0 +1,77 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      capture.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Wire Capture Into pcapng.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           capture.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Wire Capture Into pcapng.
+ * ****************************/
+
+#ifndef CAPTURE_HPP
+#define CAPTURE_HPP
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include "mapped_file.hpp"
+
+/************************************************/
+/*                  pcapng Layout               */
+/************************************************/
+static constexpr uint32_t PCAPNG_SHB            = 0x0A0D0D0A;   //!< Section Header Block
+static constexpr uint32_t PCAPNG_IDB            = 0x00000001;   //!< Interface Description Block
+static constexpr uint32_t PCAPNG_EPB            = 0x00000006;   //!< Enhanced Packet Block
+static constexpr uint32_t PCAPNG_BYTE_ORDER     = 0x1A2B3C4D;   //!< Byte-Order Magic
+static constexpr uint16_t PCAPNG_LINKTYPE_USER0 = 147;          //!< Payload Without Lower Layer Headers
+static constexpr uint16_t PCAPNG_OPT_END        = 0;            //!< opt_endofopt
+static constexpr uint16_t PCAPNG_OPT_IF_NAME    = 2;            //!< if_name, Carries "tcp" or "udp"
+static constexpr uint16_t PCAPNG_OPT_EPB_FLAGS  = 2;            //!< epb_flags, Carries Direction
+
+/**
+ * @brief Records Every Sent And Received Datagram or TCP Segment Into pcapng File
+ *
+ * Records Are Appended Into Memory Mapped File, So The Hot Path Pays Only
+ * For memcpy(). Timestamps Are Taken From Monotonic Clock In Microseconds.
+ */
+class Capture
+{
+    public:
+        enum Direction_t : uint32_t
+        {
+            INBOUND     = 1,        //!< Received From Server (epb_flags Inbound)
+            OUTBOUND    = 2,        //!< Sent To Server (epb_flags Outbound)
+        };
+
+        /**
+         * @brief Creates Capture File And Writes Section And Interface Blocks
+         * @param path Path of The Capture File
+         * @param protocol Transport Protocol ("tcp" or "udp") Stored As Interface Name
+         *
+         * @return SUCCESS If The File Is Ready, Otherwise FAIL
+         */
+        static int open(const std::string& path, const std::string& protocol);
+        /**
+         * @brief Appends Packet Block, Does Nothing If Capture Is Not Open
+         * @param direction Direction of The Packet
+         * @param data Payload
+         * @param length Length of The Payload
+         */
+        static void record(Direction_t direction, const void* data, size_t length);
+        /**
+         * @brief Unmaps Buffer And Truncates File To Written Length
+         */
+        static void close();
+
+    private:
+        static MappedFile file;         //!< Capture File
+};
+
+#endif // CAPTURE_HPP
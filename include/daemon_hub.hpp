@@ -0,0 +1,145 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      daemon_hub.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Unix Socket Hub Sharing One Session With Local Processes.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           daemon_hub.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Unix Socket Hub Sharing One Session With Local Processes.
+ * ****************************/
+
+#ifndef DAEMON_HUB_HPP
+#define DAEMON_HUB_HPP
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include "macros.hpp"
+#include "spsc_queue.hpp"
+
+/**
+ * @brief Type of Frame Local Process Sends To Receive Messages From Server
+ */
+static constexpr uint8_t LOCAL_SUBSCRIBE = 0x10;
+
+/**
+ * @brief Shares The Upstream Session With Processes Connected To Unix Socket
+ *
+ * Frame Is Two Bytes Big-Endian Length And Body. Local Process Sends Records
+ * of --input=binary, They Are Forwarded Whole Into The Client's Input, And
+ * LOCAL_SUBSCRIBE. Subscribers Receive Every Message From Server In The
+ * Format of The Outbound Shared Ring. Hub Thread Owns All Local Sockets,
+ * The Network Loop Only Hands Over Encoded Frames.
+ */
+class DaemonHub
+{
+    public:
+        static constexpr size_t MAX_FRAME = 2 + 1 + LENGHT_DISPLAY_NAME + 1 + LENGHT_CONTENT;  //!< Largest Received Message
+
+        /**
+         * @brief Received Message Encoded Once, Shared By All Subscribers
+         *
+         * refs Is Touched Only By Hub Thread, Frame Is Deleted When The Last
+         * Subscriber Has Sent It.
+         */
+        struct Frame_t
+        {
+            uint32_t refs;                  //!< Subscribers Still Sending The Frame
+            uint16_t length;                //!< Bytes Including Length Prefix
+            uint8_t bytes[MAX_FRAME];
+            uint8_t* body() { return bytes + 2; }
+        };
+
+        /**
+         * @brief Binds Listening Socket, Detaches If Asked, Starts Hub Thread
+         * @param path Path of Unix Socket, Stale Socket Is Replaced
+         * @param detach Continue In Background Process Without Terminal
+         *
+         * @return SUCCESS If Local Processes Can Connect, Otherwise FAIL
+         */
+        static int open(const std::string& path, bool detach);
+        /**
+         * @brief Disconnects Local Processes, Joins Hub Thread And Removes The Socket
+         */
+        static void close();
+
+        static bool isOpen() { return -1 != listenFd; }
+        /**
+         * @brief Descriptor Forwarded Records Are Read From, For InputReader::BINARY
+         */
+        static int getInputFd() { return inputPair[0]; }
+        /**
+         * @brief Allocates Frame And Writes Its Length Prefix, Network Loop Only
+         * @param length Length of The Body, At Most MAX_FRAME - 2
+         */
+        static Frame_t* newFrame(size_t length);
+        /**
+         * @brief Hands Frame Over To Hub Thread, Network Loop Only
+         * @param frame Frame Filled Thru body()
+         */
+        static void publish(Frame_t* frame);
+
+    private:
+        static constexpr size_t QUEUE_CAPACITY = 1024;          //!< Frames Waiting For Hub Thread
+        static constexpr size_t MAX_LOCAL_CLIENTS = 64;
+        static constexpr size_t MAX_PENDING = 4096;             //!< Frames Queued For One Subscriber
+        static constexpr size_t LOCAL_BUFFER = 4096;            //!< Largest Frame From Local Process
+
+        /**
+         * @brief Connected Local Process
+         */
+        struct Local_t
+        {
+            int fd;
+            bool subscribed = false;
+            std::deque<Frame_t*> pending;   //!< Frames Not Yet Sent
+            size_t sent = 0;                //!< Bytes of The First Pending Frame Already Sent
+            uint32_t dropped = 0;           //!< Frames Lost On Full pending
+            std::vector<char> input;        //!< Bytes of Incomplete Frame
+        };
+
+        /**
+         * @brief Body of Hub Thread
+         */
+        static void run();
+        static void acceptLocal();
+        /**
+         * @brief Reads Frames of Local Process
+         * @return False If The Process Left Or Broke The Protocol
+         */
+        static bool readLocal(Local_t& local);
+        /**
+         * @brief Sends Pending Frames With One Gather Write
+         * @return False If The Process Left
+         */
+        static bool writeLocal(Local_t& local);
+        /**
+         * @brief Passes Frames From Network Loop To Every Subscriber
+         */
+        static void fanOut();
+        static void closeLocal(Local_t& local);
+        static void releaseFrame(Frame_t* frame);
+
+        static std::string socketPath;
+        static int listenFd;
+        static int inputPair[2];                //!< Hub Writes Records Into [1], Client Reads [0]
+        static int wakeFd;                      //!< eventfd Signalling Frames Or Stop
+        static SpscQueue<Frame_t*, QUEUE_CAPACITY> queue;
+        static std::vector<Local_t> locals;     //!< Owned By Hub Thread
+        static std::thread worker;
+        static std::atomic<bool> stopping;
+        static std::atomic<uint32_t> dropped;   //!< Frames Lost On Full Queue
+};
+
+#endif // DAEMON_HUB_HPP
@@ -0,0 +1,94 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      file_sender.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Streaming Memory-Mapped File As MSG Messages.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           file_sender.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Streaming Memory-Mapped File As MSG Messages.
+ * ****************************/
+
+#ifndef FILE_SENDER_HPP
+#define FILE_SENDER_HPP
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include <chrono>
+#include "mapped_file.hpp"
+#include "strings.hpp"
+
+/**
+ * @brief Reads Lines of Mapped File, One Line Is One MSG
+ *
+ * Lines Are Validated In The Mapping By The Content Rules, Only The Line
+ * Being Sent Is Copied Into The Message. Client Asks For The Next Line When
+ * Its Flow Control Allows Another Message, So Nothing Is Queued Ahead. Pages
+ * Behind The Cursor Are Dropped, Resident Memory Does Not Grow With The File.
+ */
+class FileSender
+{
+    public:
+        FileSender() = default;
+        FileSender(const FileSender&) = delete;
+        FileSender& operator=(const FileSender&) = delete;
+
+        /**
+         * @brief Maps The File And Starts Sending From Its First Line
+         * @param path Path of The File
+         *
+         * @return SUCCESS If The File Is Mapped, FAIL If It Can Not Be Read Or Another File Is Being Sent
+         */
+        int open(const std::string& path);
+        /**
+         * @brief Determine If The File Still Has Lines To Send
+         * @return True While The File Is Mapped, Otherwise False
+         */
+        bool isActive() const { return file.isOpen(); }
+        /**
+         * @brief Stores Next Valid Line Into Content of The Message
+         * @param content Content of The Message Being Sent
+         *
+         * Empty Lines Are Skipped, Lines Breaking Content Rules Are Reported And
+         * Skipped. Progress Is Printed Once Per REPORT_PERIOD, Summary At The End.
+         * @return True If The Line Was Stored, False After The Last Line (File Is Closed)
+         */
+        bool next(CharBuffer& content);
+        /**
+         * @brief Stops Before The Last Line, Summary Is Printed And The File Is Closed
+         */
+        void stop();
+
+    private:
+        static constexpr size_t RELEASE_CHUNK = 1024 * 1024;    //!< Pages Are Dropped By This Step
+        static constexpr int REPORT_PERIOD = 1000;              //!< Milliseconds Between Progress Lines
+
+        /**
+         * @brief Prints Progress Or Summary To STDERR
+         * @param final Summary After The Last Line
+         */
+        void report(bool final);
+        /**
+         * @brief Drops Pages Already Read, Whole Chunks Only
+         */
+        void release();
+
+        MappedFile file;                //!< File Being Sent
+        std::string path;               //!< Path Shown In Reports
+        size_t cursor = 0;              //!< Start of The Next Line
+        size_t released = 0;            //!< Pages Before This Offset Were Dropped
+        uint64_t lineNumber = 0;        //!< Lines Read So Far
+        uint64_t sentLines = 0;         //!< Lines Handed Over As MSG
+        uint64_t skippedLines = 0;      //!< Lines Breaking Content Rules
+        std::chrono::steady_clock::time_point startedAt;        //!< Start of Sending
+        std::chrono::steady_clock::time_point reportedAt;       //!< Last Progress Line
+};
+
+#endif // FILE_SENDER_HPP
@@ -0,0 +1,120 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      fixed_string.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For String With Inline Storage of Fixed Capacity.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           fixed_string.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For String With Inline Storage of Fixed Capacity.
+ * ****************************/
+
+#ifndef FIXED_STRING_HPP
+#define FIXED_STRING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * @brief String of At Most N Characters Stored Inside The Object
+ * @tparam N Capacity, Protocol Limit of The Field
+ *
+ * Characters Past The Capacity Are Dropped And The String Is Marked As
+ * Overflowed Until It Is Cleared, So Filling The Field Is Its Length
+ * Validation. No Heap, Copy Is Plain memcpy of The Object.
+ */
+template <size_t N>
+class FixedString
+{
+    static_assert(0 != N && N <= UINT16_MAX, "Capacity Must Fit Into 16 Bits");
+
+    public:
+        constexpr FixedString() = default;
+        /**
+         * @brief Constructor From String Literal, Its Length Is Checked At Compile Time
+         * @param text String Literal
+         */
+        template <size_t M>
+        constexpr FixedString(const char (&text)[M])
+        {
+            static_assert(M - 1 <= N, "String Literal Exceeds Capacity");
+            assign(text, text + M - 1);
+        }
+
+        static constexpr size_t capacity() { return N; }
+        constexpr size_t size() const { return length; }
+        constexpr bool empty() const { return 0 == length; }
+        /**
+         * @brief Determine If Some Characters Did Not Fit Since Last clear()
+         * @return True If The Field Exceeded Its Capacity
+         */
+        constexpr bool overflowed() const { return overflow; }
+
+        constexpr const char* data() const { return chars; }
+        constexpr const char* begin() const { return chars; }
+        constexpr const char* end() const { return chars + length; }
+        constexpr char operator[](size_t idx) const { return chars[idx]; }
+        constexpr operator std::string_view() const { return std::string_view(chars, length); }
+
+        constexpr void clear()
+        {
+            length = 0;
+            overflow = false;
+        }
+        /**
+         * @brief Appends Character
+         * @param character Appended Character
+         *
+         * @return False If The Character Did Not Fit
+         */
+        constexpr bool push_back(char character)
+        {
+            if (N == length)
+            {
+                overflow = true;
+                return false;
+            }
+            chars[length++] = character;
+            return true;
+        }
+        constexpr void pop_back()
+        {
+            if (0 != length)
+                length--;
+        }
+        /**
+         * @brief Replaces Content By Range of Characters
+         * @param first Start of The Range
+         * @param last End of The Range
+         *
+         * @return False If The Range Did Not Fit, Stored Part Is Truncated
+         */
+        template <typename Iterator>
+        constexpr bool assign(Iterator first, Iterator last)
+        {
+            clear();
+            for (; first != last; ++first)
+            {
+                if (!push_back(*first))
+                    return false;
+            }
+            return true;
+        }
+
+    private:
+        char chars[N] = {};
+        uint16_t length = 0;
+        bool overflow = false;
+};
+
+static_assert(std::is_trivially_copyable_v<FixedString<1>>, "FixedString Must Be Copyable By memcpy");
+
+#endif // FIXED_STRING_HPP
@@ -0,0 +1,130 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      history.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Append-Only Message History Log.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           history.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Append-Only Message History Log.
+ * ****************************/
+
+#ifndef HISTORY_HPP
+#define HISTORY_HPP
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+#include "mapped_file.hpp"
+
+/************************************************/
+/*                  On-Disk Layout              */
+/************************************************/
+/**
+ * @brief Header of Every Record In The Log File
+ *
+ * Followed By Sender, Channel And Content Bytes, Record Is Padded To 8 Bytes.
+ * length Is Stored Last, Record With Zero Length Or Wrong Checksum Ends The Log.
+ */
+struct HistoryRecord_t
+{
+    uint32_t length;            //!< Whole Record Including Padding
+    uint32_t checksum;          //!< FNV-1a Over Everything After This Field
+    uint64_t timestamp;         //!< Wall Clock In Microseconds Since Epoch
+    uint8_t direction;          //!< History::Direction_t
+    uint8_t type;               //!< BaseMessages::MessageType_t
+    uint8_t result;             //!< REPLY Result (1 OK, 0 NOK)
+    uint8_t senderLength;
+    uint8_t channelLength;
+    uint8_t reserved;
+    uint16_t contentLength;
+};
+
+/**
+ * @brief Entry of Sparse Index, Written For Every HISTORY_INDEX_INTERVAL-th Record
+ */
+struct HistoryIndexEntry_t
+{
+    uint64_t record;            //!< Sequence Number of The Record
+    uint64_t offset;            //!< Offset of The Record In The Log File
+    uint64_t timestamp;         //!< Timestamp of The Record
+};
+
+static constexpr char HISTORY_MAGIC[8]              = {'I','P','K','H','I','S','T','1'};
+static constexpr size_t HISTORY_HEADER_SIZE         = 16;   //!< Magic And Reserved Bytes Before First Record/Entry
+static constexpr uint64_t HISTORY_INDEX_INTERVAL    = 64;   //!< Records Between Index Entries
+
+/**
+ * @brief Records Every Sent And Received Message Into Memory Mapped Log
+ *
+ * Log File Holds Length-Prefixed Records, FILE.idx Holds Sparse Index. After
+ * Crash The Torn Tail Is Found By Checksum And Overwritten By Next Session.
+ */
+class History
+{
+    public:
+        enum Direction_t : uint8_t
+        {
+            RECEIVED    = 1,
+            SENT        = 2,
+        };
+
+        /**
+         * @brief Opens Log For Appending, Recovers Its Tail
+         * @param path Path of The Log File
+         *
+         * @return SUCCESS If The Log Is Ready, Otherwise FAIL
+         */
+        static int open(const std::string& path);
+        /**
+         * @brief Appends Record, Does Nothing If History Is Not Open
+         * @param direction Sent Or Received
+         * @param type Type of The Message
+         * @param result Result of REPLY
+         * @param sender Display Name of Sender
+         * @param channel Channel, Empty To Use The Last Joined Channel
+         * @param content Content of The Message
+         */
+        static void append(Direction_t direction, uint8_t type, uint8_t result, const std::string& sender,
+                           const std::string& channel, const std::string& content);
+        /**
+         * @brief Truncates Log Files To Their Length
+         */
+        static void close();
+        /**
+         * @brief Determine If History Is Recorded
+         * @return True If The Log Is Open
+         */
+        static bool isOpen() { return log.isOpen(); }
+        /**
+         * @brief Prints Records of Log To STDOUT
+         * @param path Path of The Log File
+         * @param last Number of Newest Records To Print, 0 For All
+         *
+         * @return SUCCESS If The Log Could Be Read, Otherwise FAIL
+         */
+        static int dump(const std::string& path, uint64_t last);
+
+    private:
+        /**
+         * @brief Validates Record At Offset
+         * @param file Log File
+         * @param offset Offset of The Record
+         *
+         * @return Length of The Record, 0 If There Is No Valid Record
+         */
+        static size_t validRecord(const MappedFile& file, size_t offset);
+
+        static MappedFile log;              //!< Log File
+        static MappedFile index;            //!< Sparse Index File
+        static uint64_t records;            //!< Number of Records In The Log
+        static std::string joinedChannel;   //!< Last Joined Channel
+};
+
+#endif // HISTORY_HPP
@@ -0,0 +1,108 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      input_reader.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Structured JSONL And Binary Input Records.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           input_reader.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Structured JSONL And Binary Input Records.
+ * ****************************/
+
+#ifndef INPUT_READER_HPP
+#define INPUT_READER_HPP
+
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+#include <unistd.h>
+#include "base_messages.hpp"
+#include "shm_ring.hpp"
+
+/**
+ * @brief Decodes Records Naming Message Type And Fields Straight Into Message
+ *
+ * JSONL Record Is One Flat Object Per Line, {"type":"msg","content":"..."}.
+ * Binary Record Is Two Bytes Big-Endian Length, Type Byte (BaseMessages
+ * Values) And Fields Separated By Zero Byte. Command Grammar Is Not Used,
+ * So Content Looking Like Command Is Sent As It Is. Fields Are Validated
+ * Later By checkMessage() Thru checkLength(), New Name of Rename Waits In
+ * Content Until Then. SHM Reads Binary Records In Place From Inbound Ring
+ * of ShmLink, Descriptor Is Then Its eventfd. TEXT Line Is Only Framed,
+ * Same Buffer And read() Serve It, So No Line Hides In stdio Buffer.
+ */
+class InputReader
+{
+    public:
+        enum Format_t : uint8_t
+        {
+            TEXT,               //!< Lines With Commands, Parsed Later By checkMessage()
+            JSONL,              //!< One JSON Object Per Line
+            BINARY,             //!< Length-Prefixed Records
+            SHM,                //!< Binary Records In Shared Ring
+        };
+
+        enum Result_t : uint8_t
+        {
+            RECORD,             //!< Message Was Filled
+            INVALID,            //!< Record Was Consumed, But Could Not Be Decoded
+            NONE,               //!< No Complete Record Buffered
+        };
+
+        /**
+         * @brief Sets Format And Source of Input
+         * @param inputFormat Format of Records
+         * @param inputFd Descriptor Records Are Read From
+         */
+        void open(Format_t inputFormat, int inputFd);
+        Format_t getFormat() const { return format; }
+        int getFd() const { return fd; }
+        /**
+         * @brief Reads Available Bytes, Call Only When Descriptor Is Readable
+         *
+         * @return False On End of Input, Otherwise True
+         */
+        bool fill();
+        /**
+         * @brief Determine If Complete Record Is Buffered
+         * @return True If next() Returns Without Reading
+         */
+        bool hasRecord() const;
+        /**
+         * @brief Decodes Next Buffered Record
+         * @param msg Message Whose Fields Are Filled, Display Name Is Kept For MSG And JOIN
+         *
+         * @return RECORD, INVALID If The Record Was Skipped, NONE If Nothing Is Buffered
+         */
+        Result_t next(BaseMessages::Message_t& msg);
+
+    private:
+        static constexpr size_t BUFFER_SIZE = 128 * 1024;   //!< Holds Any Binary Record (16-Bit Length)
+
+        /**
+         * @brief Finds Length of Next Complete Record
+         * @return Length Including Framing, 0 If Record Is Not Complete
+         */
+        size_t recordLength() const;
+        Result_t decodeText(std::string_view record, BaseMessages::Message_t& msg);
+        Result_t decodeJson(std::string_view record, BaseMessages::Message_t& msg);
+        Result_t decodeBinary(std::string_view record, BaseMessages::Message_t& msg);
+
+        Format_t format = TEXT;
+        int fd = STDIN_FILENO;
+        ShmRing* ring = nullptr;        //!< Inbound Ring For SHM
+        char buffer[BUFFER_SIZE];
+        size_t start = 0;               //!< First Unread Byte
+        size_t end = 0;                 //!< End of Buffered Bytes
+        bool ended = false;             //!< End of Input Was Read
+        bool discarding = false;        //!< Oversized JSONL Line Is Skipped Up To Its End
+};
+
+#endif // INPUT_READER_HPP
@@ -0,0 +1,135 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      jsonl_writer.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For JSON Lines Writer With Background Flushing.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           jsonl_writer.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For JSON Lines Writer With Background Flushing.
+ * ****************************/
+
+#ifndef JSONL_WRITER_HPP
+#define JSONL_WRITER_HPP
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include "macros.hpp"
+
+/**
+ * @brief Formats JSON Objects Into Double Buffer, Writer Thread Flushes It
+ *
+ * One Thread Formats Records Into The Active Buffer, Full Buffer Is Handed
+ * Over To Writer Thread And Formatting Continues In The Other One. Records
+ * Are Escaped By Hand Directly Into The Buffer, Nothing Is Allocated After
+ * open(). Formatting Thread Waits Only When Both Buffers Are Full.
+ */
+class JsonlWriter
+{
+    public:
+        JsonlWriter() = default;
+        JsonlWriter(const JsonlWriter&) = delete;
+        JsonlWriter& operator=(const JsonlWriter&) = delete;
+        ~JsonlWriter();
+
+        /**
+         * @brief Opens Output And Starts Writer Thread
+         * @param path Output File, Empty For STDOUT
+         * @param wakeFd eventfd Signalled After Every Finished Write, -1 For None
+         *
+         * @return SUCCESS If The Output Is Open And The Thread Runs, Otherwise FAIL
+         */
+        int open(const std::string& path, int wakeFd);
+        /**
+         * @brief Starts New Object, Makes Room For The Largest Record
+         */
+        void beginRecord();
+        /**
+         * @brief Appends Escaped String Field
+         * @param name Name of The Field
+         * @param value Value, Escaped While Copied
+         */
+        void field(std::string_view name, std::string_view value);
+        /**
+         * @brief Appends Number Field
+         * @param name Name of The Field
+         * @param value Value
+         */
+        void field(std::string_view name, int64_t value);
+        /**
+         * @brief Appends Boolean Field
+         * @param name Name of The Field
+         * @param value Value
+         */
+        void booleanField(std::string_view name, bool value);
+        /**
+         * @brief Appends Field With null
+         * @param name Name of The Field
+         */
+        void nullField(std::string_view name);
+        /**
+         * @brief Closes The Object And Ends The Line
+         */
+        void endRecord();
+        /**
+         * @brief Hands Over Formatted Records If Writer Thread Is Idle
+         *
+         * Busy Writer Signals wakeFd When Done, flush() Is Then Called Again.
+         */
+        void flush();
+        /**
+         * @brief Writes Everything Formatted, Joins Writer Thread And Closes Output
+         */
+        void close();
+
+        bool isOpen() const { return -1 != fd; }
+
+    private:
+        static constexpr size_t BUFFER_SIZE = 1024 * 1024;                              //!< Size of Each Half
+        static constexpr size_t MAX_RECORD = 6 * (LENGHT_CONTENT + LENGHT_DISPLAY_NAME + LENGHT_SESSION_NAME) + 512; //!< Every Character Escaped As \u00XX
+
+        /**
+         * @brief Passes Active Buffer To Writer Thread
+         * @param wait Wait Until Writer Finishes The Previous One
+         *
+         * @return True If The Buffer Was Handed Over, Otherwise False
+         */
+        bool handOver(bool wait);
+        /**
+         * @brief Body of Writer Thread
+         */
+        void run();
+        void append(char character) { active[used++] = character; }
+        void append(std::string_view text);
+        void appendName(std::string_view name);
+
+        int fd = -1;                            //!< Output
+        bool ownFd = false;                     //!< Output Was Opened Here, STDOUT Is Not Closed
+        int wakeFd = -1;                        //!< Poked After Every Finished Write
+        std::unique_ptr<char[]> buffers[2];     //!< Double Buffer
+        char* active = nullptr;                 //!< Half Being Formatted
+        size_t used = 0;                        //!< Bytes Formatted In Active Half
+        bool firstField = true;                 //!< No Comma Before The Next Field
+
+        std::thread worker;
+        std::mutex lock;                        //!< Guards Fields Below
+        std::condition_variable ready;
+        char* pending = nullptr;                //!< Half Owned By Writer Thread
+        size_t pendingLength = 0;               //!< Bytes To Write, 0 If Writer Is Idle
+        bool stopping = false;
+        bool failed = false;                    //!< Write Error Was Reported
+};
+
+#endif // JSONL_WRITER_HPP
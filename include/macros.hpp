@@ -14,6 +14,9 @@
  *  @date           11.03.2024
  *  @brief          Defines Used Constants Such As Return Codes In Project.
  * ****************************/
+#ifndef MACROS_HPP
+#define MACROS_HPP
+
 #include <iostream>
 
 /*****************************************************/
@@ -37,6 +40,7 @@ static constexpr int AUTH_FAILED            = -5;   //!< Indicates That Authenti
 static constexpr int EXTERNAL_ERROR         = -6;   //!< Indicates That An External Error Occurred
 static constexpr int NON_VALID_PARAM        = -7;   //!< Indicates That String Contains Non-Alphanumeric Characters
 static constexpr int NON_VALID_MSG_TYPE     = -8;   //!< Indicates That Command Is Invalid
+static constexpr int CONNECT_FAILED         = -9;   //!< Indicates That Server Could Not Be Resolved Or Connected In Time
 /*****************************************************/
 /*                  Message Limits                   */
 /*****************************************************/
@@ -45,9 +49,10 @@ static constexpr int LENGHT_USERNAME        = 20;
 static constexpr int LENGHT_SECRET          = 128;
 static constexpr int LENGHT_CONTENT         = 1400;
 static constexpr int LENGHT_DISPLAY_NAME    = 20;
+static constexpr int LENGHT_SESSION_NAME    = 16;
+static constexpr int32_t NO_MESSAGE_ID      = -1;   //!< Message Without ID (TCP)
+
 
+static constexpr int UNLIMITED_TIMEOUT      = -1;
 
-static constexpr int STDIN                  = 0;
-static constexpr int SOCKET                 = 1;
-static constexpr int NUM_FILE_DESCRIPTORS   = 2;
-static constexpr int UNLIMITED_TIMEOUT      = -1;
\ No newline at end of file
+#endif // MACROS_HPP
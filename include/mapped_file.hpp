@@ -0,0 +1,82 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      mapped_file.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Growable Memory Mapped Append File.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           mapped_file.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Growable Memory Mapped Append File.
+ * ****************************/
+
+#ifndef MAPPED_FILE_HPP
+#define MAPPED_FILE_HPP
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+/**
+ * @brief File Written Thru Shared Mapping, Grows In Chunks
+ *
+ * Length Is The Used Part of The File, The Rest of The Mapping Is Zero.
+ * close() Truncates The File To Length, After Crash The Zero Tail Stays.
+ */
+class MappedFile
+{
+    public:
+        enum Mode_t
+        {
+            TRUNCATE,           //!< Create Empty File
+            APPEND,             //!< Keep Content, Length Is Set By The Owner After Recovery
+            READ_ONLY,          //!< Map Existing File For Reading
+        };
+
+        MappedFile() = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+
+        /**
+         * @brief Opens And Maps The File
+         * @param path Path of The File
+         * @param mode Open Mode
+         *
+         * @return SUCCESS If The File Is Mapped (Empty File Is Mapped On First reserve()), Otherwise FAIL
+         */
+        int open(const std::string& path, Mode_t mode);
+        /**
+         * @brief Makes Room After The Used Part
+         * @param length Number of Bytes Needed
+         *
+         * @return Pointer To Free Space, nullptr If The Mapping Could Not Grow
+         */
+        uint8_t* reserve(size_t length);
+        /**
+         * @brief Unmaps And Truncates Writable File To Its Length
+         */
+        void close();
+
+        bool isOpen() const { return -1 != fd; }
+        uint8_t* data() const { return map; }
+        size_t mappedSize() const { return mapped; }
+        size_t length() const { return used; }
+        void setLength(size_t length) { used = length; }
+
+    private:
+        static constexpr size_t MAP_CHUNK = 1024 * 1024;    //!< Growth Step of The Mapping
+
+        int fd = -1;                    //!< Mapped File
+        bool writable = false;          //!< Opened For Writing
+        uint8_t* map = nullptr;         //!< Mapped Part of The File
+        size_t mapped = 0;              //!< Size of The Mapping
+        size_t used = 0;                //!< Bytes Already Written
+};
+
+#endif // MAPPED_FILE_HPP
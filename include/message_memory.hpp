@@ -0,0 +1,85 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      message_memory.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Memory Resources Backing Messages.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           message_memory.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Memory Resources Backing Messages.
+ * ****************************/
+
+#ifndef MESSAGE_MEMORY_HPP
+#define MESSAGE_MEMORY_HPP
+
+#include <cstddef>
+#include <deque>
+#include <memory_resource>
+#include <queue>
+
+static constexpr size_t MESSAGE_ARENA_SIZE = 4096;     //!< Fits Datagram Or Line And All Fields Parsed From It
+
+/**
+ * @brief Pool For Messages Which Outlive One Loop Round (Queued Lines)
+ *
+ * Unsynchronized, Messages Are Only Touched By The Thread Running The
+ * Client, Renderer Thread Gets Plain Strings.
+ */
+class MessageMemory
+{
+    public:
+        /**
+         * @brief Returns Pool Shared By Queued Messages
+         * @return Pool Resource
+         */
+        static std::pmr::memory_resource* pool();
+};
+
+/**
+ * @brief Queue Whose Nodes Come From MessageMemory::pool()
+ *
+ * Queued Message Has To Be Constructed With The Pool And Then Assigned,
+ * Copy Construction Would Move Its Fields To The Default Resource.
+ */
+template <typename T>
+using MessageQueue = std::queue<T, std::pmr::deque<T>>;
+
+/**
+ * @brief Monotonic Arena For One Received or Sent Message
+ *
+ * Fields Bump A Pointer In Buffer On Stack, Only What Does Not Fit Goes To
+ * MessageMemory::pool(). Everything Is Released At Once When The Arena Goes
+ * Out of Scope, So Message Using It Must Not Live Longer.
+ */
+class MessageArena
+{
+    public:
+        MessageArena() : resource(storage, sizeof(storage), MessageMemory::pool()) {}
+        MessageArena(const MessageArena&) = delete;
+        MessageArena& operator=(const MessageArena&) = delete;
+
+        /**
+         * @brief Returns Resource For Message Constructor
+         * @return Arena Resource
+         */
+        std::pmr::memory_resource* get() { return &resource; }
+        /**
+         * @brief Releases Everything Allocated From The Arena
+         *
+         * Messages Using The Arena Must Be Gone, Next Allocation Starts At
+         * The Beginning of The Buffer Again.
+         */
+        void reset() { resource.release(); }
+
+    private:
+        alignas(std::max_align_t) std::byte storage[MESSAGE_ARENA_SIZE];
+        std::pmr::monotonic_buffer_resource resource;
+};
+
+#endif // MESSAGE_MEMORY_HPP
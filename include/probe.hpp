@@ -0,0 +1,119 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      probe.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Compile-Time Switchable Cycle Probes On Hot-Path Stages.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           probe.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Compile-Time Switchable Cycle Probes On Hot-Path Stages.
+ * ****************************/
+
+#ifndef PROBE_HPP
+#define PROBE_HPP
+
+// 0 - Probes Compile To Nothing, 1 - Cycles, 2 - Cycles And Hardware Counters
+#ifndef PROBE_MACRO
+#define PROBE_MACRO 0
+#endif
+
+#if PROBE_MACRO
+
+#include <cstdint>
+
+/**
+ * @brief Accumulates Cost of Hot-Path Stages, Table Is Printed At Exit
+ *
+ * Cycles Are Read By rdtsc (Nanoseconds On Other Architectures), Level 2
+ * Adds Instructions, Cache Misses And Branch Misses From perf_event_open
+ * Counting User Space of The Network Thread. Costs Are Inclusive, Stage
+ * Called From Another Stage Is Counted In Both. Stages Run On The Network
+ * Thread Only, So The Totals Are Not Atomic.
+ */
+class Probe
+{
+    public:
+        typedef enum
+        {
+            DECODE_LINE,        //!< TextCodec::decode of Line From TCP Server
+            CHECK,
+            SERIALIZE,
+            DECODE_DATAGRAM,    //!< Binary Decode of Datagram From UDP Server
+            DEDUP,              //!< Lookup of Datagram's ID Among Already Handled Ones
+            SEND,
+            STAGES
+        } Stage_t;
+
+        static constexpr int COUNTERS = 3;
+
+        /**
+         * @brief Reading of Time And Counters
+         */
+        typedef struct
+        {
+            uint64_t cycles;
+            uint64_t counters[COUNTERS];
+        } Sample_t;
+
+        /**
+         * @brief Measures Stage Until end() Or End of The Scope
+         */
+        class Scope
+        {
+            public:
+                explicit Scope(Stage_t measured) : stage(measured) { Probe::sample(start, true); }
+                ~Scope() { end(); }
+                Scope(const Scope&) = delete;
+                Scope& operator=(const Scope&) = delete;
+
+                void end()
+                {
+                    if (done)
+                        return;
+                    done = true;
+                    Sample_t stop;
+                    Probe::sample(stop, false);
+                    Probe::add(stage, start, stop);
+                }
+
+            private:
+                Stage_t stage;
+                Sample_t start;
+                bool done = false;
+        };
+
+        static void sample(Sample_t& reading, bool starting);
+        static void add(Stage_t stage, const Sample_t& start, const Sample_t& stop);
+        static void open();
+        static void report();
+        /**
+         * @brief Returns Number of Measured Calls of Stage
+         * @param stage Stage
+         * @return Calls Counted So Far
+         */
+        static uint64_t getCalls(Stage_t stage) { return calls[stage]; }
+
+    private:
+        static int groupFd;                                 //!< Leader of Counter Group, -1 If Not Counting
+        static uint64_t calls[STAGES];
+        static uint64_t cycles[STAGES];
+        static uint64_t counters[STAGES][COUNTERS];
+};
+
+#define PROBE(stage) Probe::Scope probe_##stage(Probe::stage)
+#define PROBE_END(stage) probe_##stage.end()
+
+#else
+
+#define PROBE(stage) ((void)0)
+#define PROBE_END(stage) ((void)0)
+
+#endif // PROBE_MACRO
+
+#endif // PROBE_HPP
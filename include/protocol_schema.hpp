@@ -0,0 +1,609 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      protocol_schema.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Declarative IPK24 Schema And Codecs Generated From It.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           protocol_schema.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Declarative IPK24 Schema And Codecs Generated From It.
+ * ****************************/
+
+#ifndef PROTOCOL_SCHEMA_HPP
+#define PROTOCOL_SCHEMA_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <memory_resource>
+#include "base_messages.hpp"
+
+/**
+ * @brief Field of Message On The Wire
+ */
+enum class Field_t : uint8_t
+{
+    RESULT,             //!< One Byte In UDP, OK/NOK In TCP
+    REF_ID,             //!< Two Bytes In UDP, Not In TCP
+    USERNAME,
+    DISPLAY_NAME,       //!< Own Display Name When Encoded, displayNameOutside When Decoded
+    SECRET,
+    CHANNEL_ID,
+    CONTENT,
+};
+
+/**
+ * @brief One Field In Schema of Message
+ */
+struct FieldSpec_t
+{
+    Field_t field;
+    std::string_view text;      //!< Text Preceding The Field In TCP Line, Empty For Field Only In UDP
+    size_t maxLength;           //!< Protocol Limit of Variable Field, 0 For Fixed-Size Field
+};
+
+/**
+ * @brief Header of UDP Message And Result of REPLY
+ */
+struct WireHeader_t
+{
+    uint16_t messageID = 0;
+    uint8_t result = 0;
+    uint16_t refMessageID = 0;
+};
+
+/**
+ * @brief Defaults Shared By All Schemas
+ */
+struct SchemaBase_t
+{
+    static constexpr bool idIsReference = false;    //!< UDP Header Carries ID of Confirmed Message (CONFIRM)
+    static constexpr std::string_view keyword = ""; //!< First Words of TCP Line, Empty If Message Is Not In TCP
+};
+
+/**
+ * @brief Schema of One Message, Fields Are In Wire Order of Both Formats
+ * @tparam T Type of The Message
+ *
+ * Only Types With Specialization Exist On The Wire.
+ */
+template <BaseMessages::MessageType_t T>
+struct MessageSchema;
+
+template <>
+struct MessageSchema<BaseMessages::CONFIRM> : SchemaBase_t
+{
+    static constexpr bool idIsReference = true;
+    static constexpr std::array<FieldSpec_t, 0> fields = {};
+};
+
+template <>
+struct MessageSchema<BaseMessages::REPLY> : SchemaBase_t
+{
+    static constexpr std::string_view keyword = "REPLY";
+    static constexpr std::array<FieldSpec_t, 3> fields = {{
+        {Field_t::RESULT,       " ",        0},
+        {Field_t::REF_ID,       "",         0},
+        {Field_t::CONTENT,      " IS ",     LENGHT_CONTENT},
+    }};
+};
+
+template <>
+struct MessageSchema<BaseMessages::COMMAND_AUTH> : SchemaBase_t
+{
+    static constexpr std::string_view keyword = "AUTH";
+    static constexpr std::array<FieldSpec_t, 3> fields = {{
+        {Field_t::USERNAME,     " ",        LENGHT_USERNAME},
+        {Field_t::DISPLAY_NAME, " AS ",     LENGHT_DISPLAY_NAME},
+        {Field_t::SECRET,       " USING ",  LENGHT_SECRET},
+    }};
+};
+
+template <>
+struct MessageSchema<BaseMessages::COMMAND_JOIN> : SchemaBase_t
+{
+    static constexpr std::string_view keyword = "JOIN";
+    static constexpr std::array<FieldSpec_t, 2> fields = {{
+        {Field_t::CHANNEL_ID,   " ",        LENGHT_CHANNEL_ID},
+        {Field_t::DISPLAY_NAME, " AS ",     LENGHT_DISPLAY_NAME},
+    }};
+};
+
+template <>
+struct MessageSchema<BaseMessages::MSG> : SchemaBase_t
+{
+    static constexpr std::string_view keyword = "MSG FROM";
+    static constexpr std::array<FieldSpec_t, 2> fields = {{
+        {Field_t::DISPLAY_NAME, " ",        LENGHT_DISPLAY_NAME},
+        {Field_t::CONTENT,      " IS ",     LENGHT_CONTENT},
+    }};
+};
+
+template <>
+struct MessageSchema<BaseMessages::ERROR> : SchemaBase_t
+{
+    static constexpr std::string_view keyword = "ERR FROM";
+    static constexpr std::array<FieldSpec_t, 2> fields = MessageSchema<BaseMessages::MSG>::fields;
+};
+
+template <>
+struct MessageSchema<BaseMessages::COMMAND_BYE> : SchemaBase_t
+{
+    static constexpr std::string_view keyword = "BYE";
+    static constexpr std::array<FieldSpec_t, 0> fields = {};
+};
+
+/**
+ * @brief List of Types Existing On The Wire, Dispatch Tables Are Built From It
+ */
+template <BaseMessages::MessageType_t... Types>
+struct WireTypes_t {};
+
+using WireTypes = WireTypes_t<BaseMessages::CONFIRM, BaseMessages::REPLY, BaseMessages::COMMAND_AUTH, BaseMessages::COMMAND_JOIN,
+                              BaseMessages::MSG, BaseMessages::ERROR, BaseMessages::COMMAND_BYE>;
+
+/**
+ * @brief Field Access Shared By Both Codecs
+ */
+class SchemaFields
+{
+    public:
+        /**
+         * @brief Returns Variable Field of Message Being Sent
+         * @tparam F Field
+         * @param msg Message
+         * @return View of The Field
+         */
+        template <Field_t F>
+        static std::string_view outbound(const BaseMessages::Message_t& msg)
+        {
+            if constexpr (Field_t::USERNAME == F)
+                return msg.login;
+            else if constexpr (Field_t::DISPLAY_NAME == F)
+                return msg.displayName;
+            else if constexpr (Field_t::SECRET == F)
+                return msg.secret;
+            else if constexpr (Field_t::CHANNEL_ID == F)
+                return msg.channelID;
+            else
+            {
+                static_assert(Field_t::CONTENT == F, "Field Is Not Variable");
+                return std::string_view(msg.content.data(), msg.content.size());
+            }
+        }
+        /**
+         * @brief Stores Variable Field of Received Message
+         * @tparam F Field
+         * @param msg Message
+         * @param value Value of The Field
+         *
+         * Too Long Bounded Field Is Marked As Overflowed, checkLength() Refuses It.
+         */
+        template <Field_t F>
+        static void inbound(BaseMessages::Message_t& msg, std::string_view value)
+        {
+            if constexpr (Field_t::USERNAME == F)
+                msg.login.assign(value.begin(), value.end());
+            else if constexpr (Field_t::DISPLAY_NAME == F)
+                msg.displayNameOutside.assign(value.begin(), value.end());
+            else if constexpr (Field_t::SECRET == F)
+                msg.secret.assign(value.begin(), value.end());
+            else if constexpr (Field_t::CHANNEL_ID == F)
+                msg.channelID.assign(value.begin(), value.end());
+            else
+            {
+                static_assert(Field_t::CONTENT == F, "Field Is Not Variable");
+                msg.content.assign(value.begin(), value.end());
+            }
+        }
+};
+
+static_assert(MessageSchema<BaseMessages::COMMAND_AUTH>::fields[0].maxLength == BaseMessages::Username::capacity(), "Username Does Not Match Schema");
+static_assert(MessageSchema<BaseMessages::COMMAND_AUTH>::fields[1].maxLength == BaseMessages::DisplayName::capacity(), "Display Name Does Not Match Schema");
+static_assert(MessageSchema<BaseMessages::COMMAND_AUTH>::fields[2].maxLength == BaseMessages::Secret::capacity(), "Secret Does Not Match Schema");
+static_assert(MessageSchema<BaseMessages::COMMAND_JOIN>::fields[0].maxLength == BaseMessages::ChannelID::capacity(), "Channel ID Does Not Match Schema");
+
+/**
+ * @brief UDP Codec: Type Byte, Big-Endian ID And Fields, Strings End By Zero Byte
+ */
+class BinaryCodec
+{
+    public:
+        using Datagram = std::pmr::vector<uint8_t>;
+        using Encoder = void (*)(const BaseMessages::Message_t&, const WireHeader_t&, Datagram&);
+        using Decoder = bool (*)(std::string_view, BaseMessages::Message_t&, WireHeader_t&);
+
+        static constexpr size_t HEADER_SIZE = 3;
+        static constexpr char TERMINATOR = '\0';
+
+        /**
+         * @brief Computes Exact Size of Encoded Message
+         * @tparam T Type of The Message
+         * @param msg Message
+         * @return Size In Bytes
+         */
+        template <BaseMessages::MessageType_t T>
+        static size_t size(const BaseMessages::Message_t& msg)
+        {
+            return sizeOf<T>(msg, std::make_index_sequence<MessageSchema<T>::fields.size()>());
+        }
+        /**
+         * @brief Appends Encoded Message, Its Whole Size Is Reserved Up Front
+         * @tparam T Type of The Message
+         * @param msg Message
+         * @param header ID (Reference ID For CONFIRM), Result And Reference ID of REPLY
+         * @param out Datagram
+         */
+        template <BaseMessages::MessageType_t T>
+        static void encode(const BaseMessages::Message_t& msg, const WireHeader_t& header, Datagram& out)
+        {
+            out.reserve(out.size() + size<T>(msg));
+            uint16_t id = MessageSchema<T>::idIsReference ? header.refMessageID : header.messageID;
+            out.push_back(static_cast<uint8_t>(T));
+            out.push_back(static_cast<uint8_t>(id >> 8));
+            out.push_back(static_cast<uint8_t>(id & 0xFF));
+            encodeFields<T>(msg, header, out, std::make_index_sequence<MessageSchema<T>::fields.size()>());
+        }
+        /**
+         * @brief Decodes Fields After Header
+         * @tparam T Type of The Message
+         * @param datagram Whole Datagram
+         * @param msg Message Receiving Variable Fields
+         * @param header Receives ID And Fixed Fields
+         *
+         * Last String Without Zero Byte Ends With The Datagram.
+         * @return False If Fixed-Size Field Is Cut Off
+         */
+        template <BaseMessages::MessageType_t T>
+        static bool decode(std::string_view datagram, BaseMessages::Message_t& msg, WireHeader_t& header)
+        {
+            uint16_t id = static_cast<uint16_t>((static_cast<uint8_t>(datagram[1]) << 8) | static_cast<uint8_t>(datagram[2]));
+            if constexpr (MessageSchema<T>::idIsReference)
+                header.refMessageID = id;
+            else
+                header.messageID = id;
+            size_t offset = HEADER_SIZE;
+            return decodeFields<T>(datagram, offset, msg, header, std::make_index_sequence<MessageSchema<T>::fields.size()>());
+        }
+
+        /**
+         * @brief Encodes Message Whose Type Is Known At Runtime Thru Encoder Table
+         * @param msg Message, Its Type Selects The Encoder
+         * @param header ID, Result And Reference ID
+         * @param out Datagram
+         * @return False If The Type Does Not Exist On The Wire
+         */
+        static bool encode(const BaseMessages::Message_t& msg, const WireHeader_t& header, Datagram& out);
+        /**
+         * @brief Decodes Datagram Thru Decoder Table Indexed By Its Type Byte
+         * @param datagram Whole Datagram
+         * @param msg Message, Its Type Is Set
+         * @param header Receives ID And Fixed Fields
+         * @return False For Unknown Type Or Cut Off Datagram, Type Is Then UNKNOWN_MSG_TYPE
+         */
+        static bool decode(std::string_view datagram, BaseMessages::Message_t& msg, WireHeader_t& header);
+
+    private:
+        template <BaseMessages::MessageType_t T, size_t... I>
+        static size_t sizeOf([[maybe_unused]] const BaseMessages::Message_t& msg, std::index_sequence<I...>)
+        {
+            return HEADER_SIZE + (0 + ... + fieldSize<MessageSchema<T>::fields[I].field>(msg));
+        }
+
+        template <Field_t F>
+        static size_t fieldSize(const BaseMessages::Message_t& msg)
+        {
+            if constexpr (Field_t::RESULT == F)
+                return 1;
+            else if constexpr (Field_t::REF_ID == F)
+                return 2;
+            else
+                return SchemaFields::outbound<F>(msg).size() + 1;
+        }
+
+        template <BaseMessages::MessageType_t T, size_t... I>
+        static void encodeFields([[maybe_unused]] const BaseMessages::Message_t& msg, [[maybe_unused]] const WireHeader_t& header, [[maybe_unused]] Datagram& out, std::index_sequence<I...>)
+        {
+            (encodeField<MessageSchema<T>::fields[I].field>(msg, header, out), ...);
+        }
+
+        template <Field_t F>
+        static void encodeField(const BaseMessages::Message_t& msg, const WireHeader_t& header, Datagram& out)
+        {
+            if constexpr (Field_t::RESULT == F)
+                out.push_back(header.result);
+            else if constexpr (Field_t::REF_ID == F)
+            {
+                out.push_back(static_cast<uint8_t>(header.refMessageID >> 8));
+                out.push_back(static_cast<uint8_t>(header.refMessageID & 0xFF));
+            }
+            else
+            {
+                std::string_view value = SchemaFields::outbound<F>(msg);
+                out.insert(out.end(), value.begin(), value.end());
+                out.push_back(TERMINATOR);
+            }
+        }
+
+        template <BaseMessages::MessageType_t T, size_t... I>
+        static bool decodeFields([[maybe_unused]] std::string_view datagram, [[maybe_unused]] size_t& offset, [[maybe_unused]] BaseMessages::Message_t& msg, [[maybe_unused]] WireHeader_t& header, std::index_sequence<I...>)
+        {
+            return (true && ... && decodeField<MessageSchema<T>::fields[I].field>(datagram, offset, msg, header));
+        }
+
+        template <Field_t F>
+        static bool decodeField(std::string_view datagram, size_t& offset, BaseMessages::Message_t& msg, WireHeader_t& header)
+        {
+            if constexpr (Field_t::RESULT == F)
+            {
+                if (datagram.size() < offset + 3)           // RESULT Is Always Followed By REF_ID
+                    return false;
+                header.result = static_cast<uint8_t>(datagram[offset++]);
+            }
+            else if constexpr (Field_t::REF_ID == F)
+            {
+                if (datagram.size() < offset + 2)
+                    return false;
+                header.refMessageID = static_cast<uint16_t>((static_cast<uint8_t>(datagram[offset]) << 8) | static_cast<uint8_t>(datagram[offset + 1]));
+                offset += 2;
+            }
+            else
+            {
+                size_t end = datagram.find(TERMINATOR, offset);
+                if (std::string_view::npos == end)
+                    end = datagram.size();
+                SchemaFields::inbound<F>(msg, datagram.substr(std::min(offset, end), end - std::min(offset, end)));
+                offset = end + 1;
+            }
+            return true;
+        }
+
+        template <BaseMessages::MessageType_t... Types>
+        static constexpr std::array<Encoder, 256> makeEncoders(WireTypes_t<Types...>)
+        {
+            std::array<Encoder, 256> table = {};
+            ((table[Types] = &encode<Types>), ...);
+            return table;
+        }
+
+        template <BaseMessages::MessageType_t... Types>
+        static constexpr std::array<Decoder, 256> makeDecoders(WireTypes_t<Types...>)
+        {
+            std::array<Decoder, 256> table = {};
+            ((table[Types] = &decode<Types>), ...);
+            return table;
+        }
+};
+
+/**
+ * @brief TCP Codec: Keyword, Fields Each After Its Separator, Line Ends By \r\n
+ */
+class TextCodec
+{
+    public:
+        /**
+         * @brief Computes Exact Length of Encoded Line
+         * @tparam T Type of The Message
+         * @param msg Message
+         * @param header Result of REPLY
+         * @return Length Including \r\n
+         */
+        template <BaseMessages::MessageType_t T>
+        static size_t size(const BaseMessages::Message_t& msg, const WireHeader_t& header)
+        {
+            static_assert(!MessageSchema<T>::keyword.empty(), "Message Does Not Exist In TCP");
+            return MessageSchema<T>::keyword.size() + 2 +
+                   sizeOf<T>(msg, header, std::make_index_sequence<MessageSchema<T>::fields.size()>());
+        }
+        /**
+         * @brief Encodes Message Into Line, Its Whole Length Is Reserved Up Front
+         * @tparam T Type of The Message
+         * @param msg Message
+         * @param header Result of REPLY
+         * @param out Line
+         */
+        template <BaseMessages::MessageType_t T>
+        static void encode(const BaseMessages::Message_t& msg, const WireHeader_t& header, std::string& out)
+        {
+            out.reserve(out.size() + size<T>(msg, header));
+            out.append(MessageSchema<T>::keyword);
+            encodeFields<T>(msg, header, out, std::make_index_sequence<MessageSchema<T>::fields.size()>());
+            out.append("\r\n");
+        }
+        /**
+         * @brief Decodes Line Whose Keyword Belongs To Type T
+         * @tparam T Type of The Message
+         * @param line Line Without Its Keyword, Ending By \r\n Or Not
+         * @param msg Message Receiving Variable Fields
+         * @param header Receives Result of REPLY
+         *
+         * Each Field Ends Where The Separator of The Next One Starts, The Last One At The Line End.
+         * @return False If Separator Is Missing Or Result Is Not OK/NOK
+         */
+        template <BaseMessages::MessageType_t T>
+        static bool decode(std::string_view line, BaseMessages::Message_t& msg, WireHeader_t& header)
+        {
+            size_t lineEnd = line.find_first_of("\r\n");
+            if (std::string_view::npos != lineEnd)
+                line = line.substr(0, lineEnd);
+            size_t offset = 0;
+            bool decoded = decodeFields<T>(line, offset, msg, header, std::make_index_sequence<MessageSchema<T>::fields.size()>());
+            return decoded && offset == line.size();
+        }
+        /**
+         * @brief Decodes Line Thru Keyword Table
+         * @param line Line Received From Server
+         * @param msg Message, Its Type Is Set
+         * @param header Receives Result of REPLY
+         * @return Type of The Message, UNKNOWN_MSG_TYPE If The Line Does Not Match Any Schema
+         */
+        static BaseMessages::MessageType_t decode(std::string_view line, BaseMessages::Message_t& msg, WireHeader_t& header);
+        static BaseMessages::MessageType_t decode(const CharBuffer& line, BaseMessages::Message_t& msg, WireHeader_t& header)
+        {
+            return decode(std::string_view(line.data(), line.size()), msg, header);
+        }
+
+    private:
+        using Decoder = bool (*)(std::string_view, BaseMessages::Message_t&, WireHeader_t&);
+
+        struct Entry_t
+        {
+            std::string_view keyword;
+            BaseMessages::MessageType_t type;
+            Decoder decoder;
+        };
+
+        static constexpr std::string_view OK = "OK";
+        static constexpr std::string_view NOK = "NOK";
+
+        template <BaseMessages::MessageType_t T, size_t... I>
+        static size_t sizeOf([[maybe_unused]] const BaseMessages::Message_t& msg, [[maybe_unused]] const WireHeader_t& header, std::index_sequence<I...>)
+        {
+            return (0 + ... + fieldSize<T, I>(msg, header));
+        }
+
+        template <BaseMessages::MessageType_t T, size_t I>
+        static size_t fieldSize(const BaseMessages::Message_t& msg, const WireHeader_t& header)
+        {
+            constexpr FieldSpec_t S = MessageSchema<T>::fields[I];
+            if constexpr (S.text.empty())
+                return 0;
+            else if constexpr (Field_t::RESULT == S.field)
+                return S.text.size() + (header.result ? OK.size() : NOK.size());
+            else
+                return S.text.size() + SchemaFields::outbound<S.field>(msg).size();
+        }
+
+        template <BaseMessages::MessageType_t T, size_t... I>
+        static void encodeFields([[maybe_unused]] const BaseMessages::Message_t& msg, [[maybe_unused]] const WireHeader_t& header, [[maybe_unused]] std::string& out, std::index_sequence<I...>)
+        {
+            (encodeField<T, I>(msg, header, out), ...);
+        }
+
+        template <BaseMessages::MessageType_t T, size_t I>
+        static void encodeField(const BaseMessages::Message_t& msg, const WireHeader_t& header, std::string& out)
+        {
+            constexpr FieldSpec_t S = MessageSchema<T>::fields[I];
+            if constexpr (!S.text.empty())
+            {
+                out.append(S.text);
+                if constexpr (Field_t::RESULT == S.field)
+                    out.append(header.result ? OK : NOK);
+                else
+                    out.append(SchemaFields::outbound<S.field>(msg));
+            }
+        }
+
+        /**
+         * @brief Returns Separator of The Next Field In Line, Empty For The Last One
+         */
+        template <BaseMessages::MessageType_t T>
+        static constexpr std::string_view nextSeparator(size_t idx)
+        {
+            for (size_t next = idx + 1; next < MessageSchema<T>::fields.size(); next++)
+            {
+                if (!MessageSchema<T>::fields[next].text.empty())
+                    return MessageSchema<T>::fields[next].text;
+            }
+            return "";
+        }
+
+        template <BaseMessages::MessageType_t T, size_t... I>
+        static bool decodeFields([[maybe_unused]] std::string_view line, [[maybe_unused]] size_t& offset, [[maybe_unused]] BaseMessages::Message_t& msg, [[maybe_unused]] WireHeader_t& header, std::index_sequence<I...>)
+        {
+            return (true && ... && decodeField<T, I>(line, offset, msg, header));
+        }
+
+        template <BaseMessages::MessageType_t T, size_t I>
+        static bool decodeField(std::string_view line, size_t& offset, BaseMessages::Message_t& msg, WireHeader_t& header)
+        {
+            constexpr FieldSpec_t S = MessageSchema<T>::fields[I];
+            constexpr std::string_view Next = nextSeparator<T>(I);
+            if constexpr (S.text.empty())
+                return true;
+            else
+            {
+                if (line.substr(offset, S.text.size()) != S.text)
+                    return false;
+                offset += S.text.size();
+                size_t end = Next.empty() ? line.size() : line.find(Next, offset);
+                if (std::string_view::npos == end)
+                    return false;
+                std::string_view value = line.substr(offset, end - offset);
+                offset = end;
+                if constexpr (Field_t::RESULT == S.field)
+                {
+                    if (OK != value && NOK != value)
+                        return false;
+                    header.result = (OK == value) ? 1 : 0;
+                }
+                else
+                    SchemaFields::inbound<S.field>(msg, value);
+                return true;
+            }
+        }
+
+        template <BaseMessages::MessageType_t T>
+        static constexpr Entry_t entry()
+        {
+            return {MessageSchema<T>::keyword, T, &decode<T>};
+        }
+
+};
+
+// Dispatch Tables Are Built Once Both Classes Are Complete
+
+inline bool BinaryCodec::encode(const BaseMessages::Message_t& msg, const WireHeader_t& header, Datagram& out)
+{
+    static constexpr std::array<Encoder, 256> encoders = makeEncoders(WireTypes());
+    Encoder encoder = encoders[msg.type];
+    if (nullptr == encoder)
+        return false;
+    encoder(msg, header, out);
+    return true;
+}
+
+inline bool BinaryCodec::decode(std::string_view datagram, BaseMessages::Message_t& msg, WireHeader_t& header)
+{
+    static constexpr std::array<Decoder, 256> decoders = makeDecoders(WireTypes());
+    Decoder decoder = (HEADER_SIZE <= datagram.size()) ? decoders[static_cast<uint8_t>(datagram[0])] : nullptr;
+    if (nullptr == decoder || !decoder(datagram, msg, header))
+    {
+        msg.type = BaseMessages::UNKNOWN_MSG_TYPE;
+        return false;
+    }
+    msg.type = static_cast<BaseMessages::MessageType_t>(datagram[0]);
+    return true;
+}
+
+inline BaseMessages::MessageType_t TextCodec::decode(std::string_view line, BaseMessages::Message_t& msg, WireHeader_t& header)
+{
+    // Longer Keywords Sharing Prefix Would Have To Come First, None Do
+    static constexpr std::array<Entry_t, 6> entries = {{
+        entry<BaseMessages::MSG>(), entry<BaseMessages::REPLY>(), entry<BaseMessages::ERROR>(),
+        entry<BaseMessages::COMMAND_BYE>(), entry<BaseMessages::COMMAND_AUTH>(), entry<BaseMessages::COMMAND_JOIN>(),
+    }};
+    for (const Entry_t& entry : entries)
+    {
+        if (line.substr(0, entry.keyword.size()) == entry.keyword && entry.decoder(line.substr(entry.keyword.size()), msg, header))
+        {
+            msg.type = entry.type;
+            return entry.type;
+        }
+    }
+    msg.type = BaseMessages::UNKNOWN_MSG_TYPE;
+    return BaseMessages::UNKNOWN_MSG_TYPE;
+}
+
+#endif // PROTOCOL_SCHEMA_HPP
@@ -0,0 +1,188 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      renderer.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Terminal Rendering Thread.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           renderer.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Terminal Rendering Thread.
+ * ****************************/
+
+#ifndef RENDERER_HPP
+#define RENDERER_HPP
+
+#include <string>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <deque>
+#include <cstdint>
+#include "macros.hpp"
+#include "spsc_queue.hpp"
+#include "jsonl_writer.hpp"
+#include "shm_ring.hpp"
+#include "daemon_hub.hpp"
+
+/**
+ * @brief Prints Messages From Server On Its Own Thread
+ *
+ * Network Loop Only Copies Decoded Message Into Lock-Free Queue, So Slow
+ * Terminal Or Blocked STDOUT Pipe Does Not Delay CONFIRM Or Retransmits.
+ * When The Queue Is Full, Messages Wait In Overflow Buffer Of OVERFLOW_CAPACITY
+ * Messages. Once That Is Full Too, The Newest Message Is Dropped And Counted,
+ * Rendering Thread Reports The Count On STDERR When It Catches Up. Network
+ * Loop Never Waits For The Output.
+ */
+class Renderer
+{
+    public:
+        enum Kind_t : uint8_t
+        {
+            CHAT_MESSAGE,       //!< "DisplayName: Content" On STDOUT
+            REPLY_OK,           //!< "Success: Content" On STDOUT
+            REPLY_NOK,          //!< "Failure: Content" On STDOUT
+            SERVER_ERROR,       //!< "ERR FROM DisplayName: Content" On STDERR
+            SEARCH_MATCH,       //!< "[#Document] DisplayName: Content" On STDOUT, Result of Local /search
+            SEARCH_SUMMARY,     //!< Content On STDERR After Results of Local /search
+        };
+
+        enum Output_t : uint8_t
+        {
+            TEXT,               //!< Lines For Human On STDOUT And STDERR
+            JSONL,              //!< One JSON Object Per Message, All Kinds Into One Output
+            SHM,                //!< Binary Record Per Message Into Outbound Ring of ShmLink
+            DAEMON,             //!< Same Record Fanned Out To Subscribers of DaemonHub
+        };
+
+        /**
+         * @brief Decoded Message Passed To Rendering Thread
+         */
+        struct Event_t
+        {
+            Kind_t kind;
+            char session[LENGHT_SESSION_NAME + 1];      //!< Tag of Session, Empty For Single Session
+            char displayName[LENGHT_DISPLAY_NAME + 1];
+            char content[LENGHT_CONTENT + 1];
+            int32_t messageID;                          //!< UDP Message ID, NO_MESSAGE_ID For TCP
+            int64_t receivedAt;                         //!< Wall Clock of publish() In Microseconds, JSONL Only
+            uint32_t traceMessage;                      //!< Number of The Message In Trace
+            uint64_t publishedAt;                       //!< Trace Time of publish(), 0 If Trace Is Disabled
+            uint64_t document;                          //!< Number of Matched Message, SEARCH_MATCH Only
+        };
+
+        /**
+         * @brief Starts Rendering Thread
+         * @param format Output Format
+         * @param outputFile File For JSONL, Empty For STDOUT
+         *
+         * Until Started, Messages Are Printed Directly By The Caller.
+         * @return SUCCESS If The Thread Runs, Otherwise FAIL
+         */
+        static int start(Output_t format = TEXT, const std::string& outputFile = "");
+        /**
+         * @brief Passes Message To Rendering Thread
+         * @param kind Kind of The Message
+         * @param displayName Display Name of Sender, Empty If Not Used
+         * @param content Content of The Message
+         * @param messageID UDP Message ID, NO_MESSAGE_ID If Not Known
+         */
+        static void publish(Kind_t kind, const std::string& displayName, const std::string& content, int32_t messageID = NO_MESSAGE_ID);
+        /**
+         * @brief Passes Result of Local /search To Rendering Thread
+         * @param kind SEARCH_MATCH or SEARCH_SUMMARY
+         * @param document Number of Matched Message, 0 For SEARCH_SUMMARY
+         * @param displayName Display Name of Sender, Empty For SEARCH_SUMMARY
+         * @param content Content of Matched Message or Summary Line
+         */
+        static void publishLocal(Kind_t kind, uint64_t document, const std::string& displayName, const std::string& content);
+        /**
+         * @brief Sets Session Whose Messages Are Published Next
+         * @param name Name of The Session, Printed As "[name] " Before Its Messages
+         */
+        static void setSession(const std::string& name);
+        /**
+         * @brief Prints Remaining Messages And Joins Rendering Thread
+         */
+        static void stop();
+
+    private:
+        static constexpr size_t QUEUE_CAPACITY = 256;   //!< Messages Waiting For Terminal
+        static constexpr size_t OVERFLOW_CAPACITY = 4096; //!< Messages Waiting Behind Full Queue, Newer Are Dropped
+
+        /**
+         * @brief Body of Rendering Thread
+         */
+        static void run();
+        /**
+         * @brief Fills Message Passed To Rendering Thread
+         * @param event Destination
+         * @param kind Kind of The Message
+         * @param displayName Display Name of Sender
+         * @param content Content of The Message
+         */
+        static void fill(Event_t& event, Kind_t kind, const std::string& displayName, const std::string& content);
+        /**
+         * @brief Hands Message Over To Rendering Thread Or Prints It Directly
+         * @param event Message To Print
+         */
+        static void enqueue(const Event_t& event);
+        /**
+         * @brief Takes Messages Waiting In Overflow Buffer
+         * @param batch Receives The Messages In Order of publish()
+         */
+        static void takeOverflow(std::deque<Event_t>& batch);
+        /**
+         * @brief Prints Single Message
+         * @param event Message To Print
+         */
+        static void render(const Event_t& event);
+        /**
+         * @brief Formats Single Message As JSON Object
+         * @param event Message To Format
+         */
+        static void renderJsonl(const Event_t& event);
+        /**
+         * @brief Computes Length of Binary Record For Message
+         * @param kind Kind of The Message
+         * @param displayName Display Name of Sender
+         * @param content Content of The Message
+         */
+        static size_t recordLength(Kind_t kind, const std::string& displayName, const std::string& content);
+        /**
+         * @brief Encodes Message As Binary Record
+         * @param body Destination, recordLength() Bytes
+         * @param kind Kind of The Message
+         * @param displayName Display Name of Sender
+         * @param content Content of The Message
+         */
+        static void encodeRecord(uint8_t* body, Kind_t kind, const std::string& displayName, const std::string& content);
+        /**
+         * @brief Writes Message Into Outbound Shared Ring Or Hub On The Calling Thread
+         * @param kind Kind of The Message
+         * @param displayName Display Name of Sender
+         * @param content Content of The Message
+         */
+        static void publishRecord(Kind_t kind, const std::string& displayName, const std::string& content);
+
+        static SpscQueue<Event_t, QUEUE_CAPACITY> queue;
+        static std::thread worker;
+        static int wakeFd;                              //!< eventfd Signalling New Messages
+        static std::atomic<bool> running;
+        static std::atomic<uint32_t> dropped;           //!< Messages Lost On Full Shared Ring
+        static std::atomic<uint32_t> lagged;            //!< Messages Lost On Full Overflow Buffer
+        static std::deque<Event_t> overflow;            //!< Messages Published While The Queue Was Full
+        static std::mutex overflowLock;                 //!< Guards overflow, Taken Only While It Is In Use
+        static std::atomic<bool> overflowing;           //!< overflow Is Not Empty, Later Messages Follow It
+        static char session[LENGHT_SESSION_NAME + 1];   //!< Tag of Currently Dispatched Session
+        static Output_t output;                         //!< Format Chosen By --output
+        static JsonlWriter jsonl;                       //!< Double-Buffered JSONL Output
+};
+
+#endif // RENDERER_HPP
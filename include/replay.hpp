@@ -0,0 +1,88 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      replay.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Deterministic Replay of Captured Traffic.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           replay.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Deterministic Replay of Captured Traffic.
+ * ****************************/
+
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include "capture.hpp"
+
+/**
+ * @brief Plays Server Side of Captured Session From Loopback Socket
+ *
+ * Client Connects To The Replay Port As To Normal Server, So The Captured
+ * Traffic Passes Thru The Same Parsers And State Machines As Live Traffic.
+ */
+class Replay
+{
+    public:
+        /**
+         * @brief Captured Packet
+         */
+        struct Record_t
+        {
+            uint64_t timestamp;                 //!< Monotonic Time In Microseconds
+            Capture::Direction_t direction;     //!< Direction of The Packet
+            std::vector<uint8_t> data;          //!< Payload
+        };
+
+        /**
+         * @brief Constructor of Replay Class
+         */
+        Replay();
+        /**
+         * @brief Loads Records From pcapng File Written By Capture
+         * @param path Path of The Capture File
+         *
+         * @return SUCCESS If The File Was Parsed, Otherwise FAIL
+         */
+        int load(const std::string& path);
+        /**
+         * @brief Binds Loopback Socket And Starts Replay Thread
+         * @param maxSpeed True To Send Records Without Recorded Gaps
+         *
+         * @return SUCCESS If The Replay Server Runs, Otherwise FAIL
+         */
+        int start(bool maxSpeed);
+        /**
+         * @brief Returns Protocol Stored In The Capture
+         * @return "tcp" or "udp"
+         */
+        const std::string& getProtocol() const;
+        /**
+         * @brief Returns Loopback Port of The Replay Server
+         * @return Port Number
+         */
+        uint16_t getPort() const;
+
+    private:
+        struct State_t;
+        /**
+         * @brief Plays Inbound Records To The Client, Runs On Replay Thread
+         * @param state Shared Replay State
+         */
+        static void serve(std::shared_ptr<State_t> state);
+
+        std::shared_ptr<State_t> state;     //!< State Shared With The Replay Thread
+        std::string protocol;               //!< Protocol Stored In The Capture
+        uint16_t port = 0;                  //!< Port of The Replay Server
+};
+
+#endif // REPLAY_HPP
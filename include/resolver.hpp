@@ -0,0 +1,90 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      resolver.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Asynchronous Host Name Resolution.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           resolver.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Asynchronous Host Name Resolution.
+ * ****************************/
+
+#ifndef RESOLVER_HPP
+#define RESOLVER_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <sys/socket.h>
+
+class Resolver
+{
+    public:
+        /**
+         * @brief Resolved Server Address
+         */
+        struct Address_t
+        {
+            struct sockaddr_storage addr;   //!< Address Including Port
+            socklen_t len;                  //!< Length of The Used Part of addr
+        };
+
+        /**
+         * @brief Constructor of Resolver Class
+         *
+         * Creates Resolver Without Any Pending Request.
+         */
+        Resolver();
+        /**
+         * @brief Destructor of Resolver Class
+         *
+         * Pending Resolution Is Abandoned, Resolver Thread Finishes On Its Own.
+         */
+        ~Resolver();
+        /**
+         * @brief Starts Resolution of Host Name On Resolver Thread
+         * @param host Host Name or IP Address
+         * @param port Server's Port
+         * @param family Address Family (AF_INET, AF_INET6 or AF_UNSPEC)
+         * @param socktype Socket Type (SOCK_STREAM or SOCK_DGRAM)
+         *
+         * @return SUCCESS If The Resolver Thread Was Started, Otherwise FAIL
+         */
+        int start(const std::string& host, int port, int family, int socktype);
+        /**
+         * @brief Returns File Descriptor Which Becomes Readable When Resolution Is Done
+         * @return Pollable File Descriptor
+         */
+        int getFd() const;
+        /**
+         * @brief Collects Result of Finished Resolution
+         * @param addresses Vector To Which Resolved Addresses Are Stored
+         *
+         * @return SUCCESS If At Least One Address Was Resolved, Otherwise FAIL
+         */
+        int collect(std::vector<Address_t>& addresses);
+        /**
+         * @brief Returns Error Message of Failed Resolution
+         * @return Error Message
+         */
+        const char* getError() const;
+        /**
+         * @brief Orders Resolved Addresses For Connection Racing
+         * @param addresses Addresses In Order Returned By getaddrinfo()
+         *
+         * Interleaves Address Families As Described In RFC 8305, Section 4.
+         */
+        static void orderAddresses(std::vector<Address_t>& addresses);
+
+    private:
+        struct State_t;
+        std::shared_ptr<State_t> state;     //!< State Shared With The Resolver Thread
+};
+
+#endif // RESOLVER_HPP
@@ -0,0 +1,213 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      scheduler.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Scheduler Resuming Coroutines On Sockets And Timers.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           scheduler.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Scheduler Resuming Coroutines On Sockets And Timers.
+ * ****************************/
+
+#ifndef SCHEDULER_HPP
+#define SCHEDULER_HPP
+
+#include <chrono>
+#include <coroutine>
+#include <map>
+#include <unordered_map>
+#include <vector>
+#include <poll.h>
+
+/**
+ * @brief Single Threaded Scheduler, One poll() Resumes All Waiting Coroutines
+ *
+ * Coroutine Suspends On Readable or Writable File Descriptor, On Deadline
+ * Or On Both. Whichever Comes First Resumes It And The Other One Is Cancelled.
+ */
+class Scheduler
+{
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Registration of One Suspended Coroutine, Lives In Its Frame
+         */
+        struct Wait
+        {
+            std::coroutine_handle<> handle;
+            int fd = -1;                                                //!< Watched Descriptor, -1 If None
+            short events = POLLIN;                                      //!< POLLIN or POLLOUT
+            bool timed = false;                                         //!< timer Is Valid
+            bool expired = false;                                       //!< Resumed By timer, Not By Descriptor
+            std::multimap<Clock::time_point, Wait*>::iterator timer;
+        };
+
+        /**
+         * @brief Awaiter Suspending Until File Descriptor Is Ready or Deadline, Yields True If Ready
+         */
+        class Ready
+        {
+            public:
+                Ready(Scheduler& owner, int descriptor, short polled, Clock::time_point when) : scheduler(owner), fd(descriptor), events(polled), deadline(when) {}
+                Ready(const Ready&) = delete;
+                ~Ready() { scheduler.cancel(wait); }
+
+                bool await_ready() const noexcept { return false; }
+                void await_suspend(std::coroutine_handle<> handle)
+                {
+                    wait.handle = handle;
+                    scheduler.watch(wait, fd, events);
+                    if (Clock::time_point::max() != deadline)
+                        scheduler.arm(wait, deadline);
+                }
+                bool await_resume() const noexcept { return !wait.expired; }
+
+            private:
+                Scheduler& scheduler;
+                int fd;
+                short events;
+                Clock::time_point deadline;
+                Wait wait;
+        };
+
+        /**
+         * @brief Awaiter Suspending Until Deadline
+         */
+        class Sleep
+        {
+            public:
+                Sleep(Scheduler& owner, Clock::time_point when) : scheduler(owner), deadline(when) {}
+                Sleep(const Sleep&) = delete;
+                ~Sleep() { scheduler.cancel(wait); }
+
+                bool await_ready() const noexcept { return Clock::now() >= deadline; }
+                void await_suspend(std::coroutine_handle<> handle) { wait.handle = handle; scheduler.arm(wait, deadline); }
+                void await_resume() const noexcept {}
+
+            private:
+                Scheduler& scheduler;
+                Clock::time_point deadline;
+                Wait wait;
+        };
+
+        /**
+         * @brief Suspends Coroutine Until File Descriptor Is Readable or Deadline
+         * @param fd Watched File Descriptor
+         * @param deadline Time Limit, time_point::max() Waits Forever
+         *
+         * @return Awaiter For co_await, Yields False If Deadline Came First
+         */
+        Ready readable(int fd, Clock::time_point deadline = Clock::time_point::max()) { return Ready(*this, fd, POLLIN, deadline); }
+        /**
+         * @brief Suspends Coroutine Until File Descriptor Is Writable or Deadline
+         * @param fd Watched File Descriptor, e.g. Connecting Socket or Socket With Full Send Buffer
+         * @param deadline Time Limit, time_point::max() Waits Forever
+         *
+         * @return Awaiter For co_await, Yields False If Deadline Came First
+         */
+        Ready writable(int fd, Clock::time_point deadline = Clock::time_point::max()) { return Ready(*this, fd, POLLOUT, deadline); }
+        /**
+         * @brief Suspends Coroutine Until Deadline
+         * @param deadline Time of Resumption
+         *
+         * @return Awaiter For co_await
+         */
+        Sleep sleepUntil(Clock::time_point deadline) { return Sleep(*this, deadline); }
+
+        /**
+         * @brief Resumes Coroutine When File Descriptor Is Ready
+         * @param wait Registration of The Coroutine
+         * @param fd Watched File Descriptor
+         * @param events POLLIN or POLLOUT
+         */
+        void watch(Wait& wait, int fd, short events = POLLIN);
+        /**
+         * @brief Resumes Coroutine At Deadline
+         * @param wait Registration of The Coroutine
+         * @param deadline Time of Resumption
+         */
+        void arm(Wait& wait, Clock::time_point deadline);
+        /**
+         * @brief Removes Descriptor And Timer of Registration, Safe To Call Twice
+         * @param wait Registration of The Coroutine
+         */
+        void cancel(Wait& wait);
+        /**
+         * @brief Waits Once For Descriptors And Timers, Resumes Ready Coroutines
+         *
+         * @return SUCCESS, FAIL If poll() Failed (errno Is Kept)
+         */
+        int runOnce();
+
+    private:
+        std::unordered_map<int, Wait*> readers;                         //!< One Reading Coroutine Per Descriptor
+        std::unordered_map<int, Wait*> writers;                         //!< One Writing Coroutine Per Descriptor
+        std::multimap<Clock::time_point, Wait*> timers;                 //!< Ordered By Deadline
+        std::vector<struct pollfd> pfds;                                //!< Reused Between Rounds
+};
+
+/**
+ * @brief Auto-Reset Event Waited For By One Coroutine
+ *
+ * set() Resumes The Waiting Coroutine Right Away, Without Waiting Coroutine
+ * The Event Stays Raised And The Next wait() Passes Through.
+ */
+class Signal
+{
+    public:
+        explicit Signal(Scheduler& owner) : scheduler(owner) {}
+
+        /**
+         * @brief Awaiter Of Signal, Yields True If Signal Came Before Deadline
+         */
+        class Awaiter
+        {
+            public:
+                Awaiter(Signal& owner, Scheduler::Clock::time_point when) : signal(owner), deadline(when) {}
+                Awaiter(const Awaiter&) = delete;
+                ~Awaiter()
+                {
+                    if (&wait == signal.waiter)
+                        signal.waiter = nullptr;
+                    signal.scheduler.cancel(wait);
+                }
+
+                bool await_ready() const noexcept { return signal.raised; }
+                void await_suspend(std::coroutine_handle<> handle);
+                bool await_resume();
+
+            private:
+                Signal& signal;
+                Scheduler::Clock::time_point deadline;
+                Scheduler::Wait wait;
+        };
+
+        /**
+         * @brief Raises The Signal, Resumes Waiting Coroutine
+         */
+        void set();
+        /**
+         * @brief Suspends Coroutine Until Signal or Deadline
+         * @param deadline Time Limit, time_point::max() Waits Forever
+         *
+         * @return Awaiter For co_await
+         */
+        Awaiter wait(Scheduler::Clock::time_point deadline = Scheduler::Clock::time_point::max())
+        {
+            return Awaiter(*this, deadline);
+        }
+
+    private:
+        Scheduler& scheduler;
+        bool raised = false;
+        Scheduler::Wait* waiter = nullptr;
+};
+
+#endif // SCHEDULER_HPP
@@ -0,0 +1,134 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      search_index.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Full-Text Index Over Received Messages.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           search_index.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Full-Text Index Over Received Messages.
+ * ****************************/
+
+#ifndef SEARCH_INDEX_HPP
+#define SEARCH_INDEX_HPP
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+
+static constexpr size_t SEARCH_DEFAULT_MEMORY   = 16 * 1024 * 1024;     //!< Default Memory Cap of The Index In Bytes
+static constexpr size_t SEARCH_MAX_RESULTS      = 20;                   //!< Matches Printed By /search
+
+/**
+ * @brief Inverted Index Over Sender And Content of Received Messages
+ *
+ * Every Term Maps To Posting List of Message Numbers, Stored As Varint Deltas.
+ * Messages Are Numbered In Arrival Order, So Index Is Built By Appending Only.
+ * When Memory Cap Is Exceeded, Oldest Messages And Their Postings Are Evicted.
+ */
+class SearchIndex
+{
+    public:
+        /**
+         * @brief Message Found By Search
+         */
+        struct Match_t
+        {
+            uint64_t document;          //!< Number of The Message
+            std::string sender;
+            std::string content;
+        };
+
+        /**
+         * @brief Sets Memory Cap, Evicts Oldest Messages Above It
+         * @param bytes Cap In Bytes, 0 Disables Indexing
+         */
+        static void setMemoryCap(size_t bytes);
+        /**
+         * @brief Indexes Received Message
+         * @param sender Display Name of Sender
+         * @param content Content of The Message
+         */
+        static void add(const std::string& sender, const std::string& content);
+        /**
+         * @brief Finds Messages Containing All Terms of Query
+         * @param query Terms Separated By Non-Alphanumeric Characters
+         * @param limit Maximum Number of Matches
+         *
+         * @return Matches Ordered From The Newest
+         */
+        static std::vector<Match_t> search(const std::string& query, size_t limit);
+        /**
+         * @brief Drops All Messages And Postings
+         */
+        static void clear();
+        /**
+         * @brief Estimated Memory Used By The Index
+         * @return Bytes Accounted Against The Cap
+         */
+        static size_t memoryUsed() { return used; }
+        /**
+         * @brief Number of Messages Kept In The Index
+         * @return Number of Messages
+         */
+        static size_t documents() { return stored.size(); }
+
+    private:
+        /**
+         * @brief Message Numbers of Single Term
+         *
+         * First Number Is Kept Whole, Others As Varint Deltas From Predecessor.
+         * Evicted Prefix Is Skipped By head And Compacted Once It Dominates.
+         */
+        struct PostingList_t
+        {
+            uint64_t first = 0;                 //!< Oldest Message In The List
+            uint64_t last = 0;                  //!< Newest Message In The List
+            uint64_t count = 0;
+            size_t head = 0;                    //!< Offset of Delta Following first
+            std::vector<uint8_t> deltas;
+        };
+
+        /**
+         * @brief Stored Message
+         */
+        struct Document_t
+        {
+            std::string sender;
+            std::string content;
+        };
+
+        /**
+         * @brief Splits Text Into Lowercase Alphanumeric Terms
+         * @param text Text To Split
+         * @param words Output, Unique Terms of Text
+         */
+        static void tokenize(const std::string& text, std::vector<std::string>& words);
+        /**
+         * @brief Evicts The Oldest Message And Its Postings
+         */
+        static void evictOldest();
+        /**
+         * @brief Decodes Posting List
+         * @param list Posting List
+         * @param out Output, Message Numbers In Ascending Order
+         */
+        static void decode(const PostingList_t& list, std::vector<uint64_t>& out);
+
+        static std::unordered_map<std::string, PostingList_t> terms;
+        static std::deque<Document_t> stored;   //!< Messages From firstDocument On
+        static uint64_t firstDocument;          //!< Number of The Oldest Stored Message
+        static size_t used;                     //!< Accounted Bytes
+        static size_t cap;                      //!< Memory Cap In Bytes
+};
+
+#endif // SEARCH_INDEX_HPP
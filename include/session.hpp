@@ -0,0 +1,262 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      session.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Session Running As Coroutines On Shared Scheduler.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           session.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Session Running As Coroutines On Shared Scheduler.
+ * ****************************/
+
+#ifndef SESSION_HPP
+#define SESSION_HPP
+
+#include <string>
+#include <functional>
+#include <vector>
+#include "base_client.hpp"
+#include "base_messages.hpp"
+#include "message_memory.hpp"
+#include "scheduler.hpp"
+#include "task.hpp"
+
+/**
+ * @brief One Chat Session, Alone or Multiplexed With Others In Single Thread
+ *
+ * Session Owns No Loop. It Runs As Two Coroutines On Scheduler Of
+ * SessionMux: receive() Waits For The Socket And Handles What Server
+ * Sends, converse() Reads Straight Through AUTH, JOIN, Messages And BYE,
+ * co_awaiting REPLY, CONFIRM And Timers. receive() Wakes converse() By
+ * wakeup. Both Start Once connectToServer() Resolved And Connected The
+ * Server Without Blocking The Scheduler, Lines Handed Over Meanwhile Wait
+ * In Queue. Session Never Calls exit(), It Only Marks Itself Finished And
+ * Keeps Exit Code For The Process.
+ */
+class Session : public Client
+{
+    public:
+        using Clock = Scheduler::Clock;
+
+        /**
+         * @brief Constructor of Session
+         * @param scheduler Scheduler Running Coroutines of The Session
+         * @param name Name Used For Routing Input And Tagging Output
+         * @param addr Server's Host Name or Address
+         * @param port Server's Port
+         * @param protocol Protocol Used For Communication
+         * @param connectTimeOut Deadline For Resolution And Connection In Milliseconds
+         */
+        Session(Scheduler& scheduler, const std::string& name, const std::string& addr, int port, uint protocol, int connectTimeOut);
+        virtual ~Session();
+        /**
+         * @brief Starts Coroutine Connecting To The Server, Returns At Once
+         *
+         * Session Which Could Not Connect Finishes With CONNECT_FAILED.
+         */
+        void start();
+        /**
+         * @brief Hands User's Line Routed To This Session To converse()
+         * @param line Line Without Session Prefix
+         */
+        void handleLine(const std::string& line);
+        /**
+         * @brief Hands Line Or Structured Record of InputReader To converse()
+         * @param record Record With Its Trace Number
+         */
+        void handleRecord(const BaseMessages& record);
+        /**
+         * @brief Says BYE Once Waiting Lines Are Processed
+         */
+        void requestLeave();
+        /**
+         * @brief Starts Drain After Signal, BYE Follows The Last Waiting Line
+         */
+        void drain();
+        /**
+         * @brief Drops Waiting Lines And Says BYE As Soon As Possible
+         */
+        void leave();
+        /**
+         * @brief Returns Number of Lines Waiting For converse()
+         * @return Number of Waiting Lines And Records
+         */
+        size_t queuedRecords() const { return queuedInput.size(); }
+        /**
+         * @brief Determine If The Session Ended
+         * @return True If Nothing Is Left To Do
+         */
+        bool isFinished() const { return finished; }
+        /**
+         * @brief Returns Exit Code of The Session
+         * @return SUCCESS, EXTERNAL_ERROR If Server Sent ERR, Otherwise FAIL
+         */
+        int getExitCode() const { return exitCode; }
+        /**
+         * @brief Returns Name of The Session
+         * @return Name of The Session
+         */
+        const std::string& getName() const { return name; }
+
+    protected:
+        /**
+         * @brief Prepares The Session Once The Server Is Connected, Before converse() Starts
+         */
+        virtual void prepare() {}
+        /**
+         * @brief Coroutine Handling Everything Server Sends
+         */
+        virtual Task<> receive() = 0;
+        /**
+         * @brief Coroutine Running User's Lines From AUTH Up To BYE
+         */
+        virtual Task<> converse() = 0;
+        /**
+         * @brief Resolves Server's Host Name And Connects Without Blocking The Scheduler
+         *
+         * @return SUCCESS If The Session Is Ready, Otherwise CONNECT_FAILED
+         */
+        Task<int> connectToServer();
+        /**
+         * @brief Waits Until Condition Holds or Deadline Passes
+         * @param ready Condition, Checked Whenever wakeup Is Set
+         * @param deadline Time Limit, time_point::max() Waits Forever
+         *
+         * @return True If The Condition Holds
+         */
+        Task<bool> until(std::function<bool()> ready, Clock::time_point deadline = Clock::time_point::max());
+        /**
+         * @brief Waits For Next User's Line or Line of Sent File
+         * @param record Destination of The Record
+         *
+         * @return False If The Conversation Has To End
+         */
+        Task<bool> nextRecord(BaseMessages& record);
+        /**
+         * @brief Copies Record Into User's Message, Keeps Current Display Name
+         * @param message User's Message Sent By converse()
+         * @param record Record Returned By nextRecord()
+         */
+        void takeRecord(BaseMessages& message, const BaseMessages& record);
+        /**
+         * @brief Waits For REPLY To AUTH or JOIN
+         * @return True If The Server Accepted The Request
+         */
+        Task<bool> reply();
+        /**
+         * @brief Sleeps Until pacing Has Token For One Message And Takes It
+         * @return False If The Session Ended Meanwhile
+         */
+        Task<bool> pace();
+        /**
+         * @brief Starts Span Measuring Wait For REPLY of Just Sent AUTH or JOIN
+         */
+        void markReplyAwaited();
+        /**
+         * @brief Returns Prefix of Output Lines of The Session
+         * @return "[name] ", Empty For The Only Session
+         */
+        std::string tag() const;
+        /**
+         * @brief Prints Error Tagged By Name of The Session
+         * @param text Error Description
+         */
+        void reportError(const std::string& text) const;
+        /**
+         * @brief Reports Result of The Drain Before BYE Is Sent
+         */
+        void reportDrain() const;
+        /**
+         * @brief Marks Session As Ended, Drops Waiting Lines And Wakes converse()
+         * @param code Exit Code, The First Failure Is Kept
+         */
+        void finish(int code = SUCCESS);
+        /**
+         * @brief Destroys Both Coroutines, Called By Destructor of Derived Session
+         *
+         * Coroutine May Wait For Member of Derived Session, Which Is Destroyed
+         * Before Members of Session.
+         */
+        void stop();
+
+        Scheduler& scheduler;
+        Signal wakeup;                              //!< Set By Every Change converse() May Wait For
+        Signal halt;                                //!< Set By drain() And leave(), receive() Waits For It Between Reconnects
+        Signal progress;                            //!< Set When Resolution or Connect Attempt Ends, Or drain() And leave() Give Connecting Up
+        std::string name;                           //!< Name of The Session, Empty For The Only Session
+        ClientState state = Authentication;         //!< State of The Session
+        bool finished = false;                      //!< Session Ended
+        bool closing = false;                       //!< No More Lines, converse() Goes To BYE
+        bool awaitingReply = false;                 //!< AUTH or JOIN Waits For REPLY
+        bool replyAccepted = false;                 //!< Result of The Last REPLY
+        bool reconnecting = false;                  //!< Socket Is Down, Sending Waits For Rebuilt Session
+        bool draining = false;                      //!< Signal Arrived, BYE Follows The Last Waiting Line
+        bool hurried = false;                       //!< Drain Deadline Passed, Message In Flight Is Not Waited For
+        size_t unsent = 0;                          //!< Lines Dropped By leave() or Left Without CONFIRM
+        int exitCode = SUCCESS;                     //!< Exit Code of The Process When The Session Runs Alone
+
+    private:
+        /**
+         * @brief TCP Connect Attempt Racing For The Session
+         */
+        struct Attempt_t
+        {
+            int sock;                   //!< Connecting Socket, NOT_CONNECTED Once Closed or Adopted
+            size_t address;             //!< Index of Server's Address
+            int error;                  //!< Result of The Attempt, Valid When done
+            bool done;                  //!< Socket Became Writable, watcher Already Ended
+            Task<> watcher;             //!< watchAttempt() of The Attempt
+        };
+
+        /**
+         * @brief Connects, Then Runs converse() And Keeps Receiving
+         */
+        Task<> establish();
+        /**
+         * @brief Races Staggered TCP Connection Attempts (RFC 8305)
+         * @param addresses Ordered Server's Addresses
+         * @param deadline Deadline For The Whole Connection
+         *
+         * @return SUCCESS If One of The Attempts Succeeded, Otherwise CONNECT_FAILED
+         */
+        Task<int> raceTcpConnect(const std::vector<Resolver::Address_t>& addresses, Clock::time_point deadline);
+        /**
+         * @brief Coroutine Waiting Until Resolver Thread Is Done
+         * @param fd Descriptor of The Resolver
+         */
+        Task<> watchResolver(int fd);
+        /**
+         * @brief Coroutine Waiting Until Connect Attempt Ends
+         * @param index Index of The Attempt
+         */
+        Task<> watchAttempt(size_t index);
+        /**
+         * @brief Stops Waiting For Attempts Still Connecting, Closes Their Sockets
+         */
+        void closeAttempts();
+        /**
+         * @brief Determine If Line of Sent File May Follow
+         * @return True After Authentication While The File Is Being Sent
+         */
+        bool fileReady() const { return Open == state && fileSender.isActive(); }
+        /**
+         * @brief Drops Waiting Lines
+         */
+        void dropQueued();
+
+        MessageQueue<BaseMessages> queuedInput{std::pmr::deque<BaseMessages>(MessageMemory::pool())};  //!< Lines Waiting For converse()
+        bool leaveRequested = false;                //!< Input Ended, BYE Follows Last Waiting Line
+        bool resolved = false;                      //!< Resolver Thread Is Done
+        Task<> resolving;                           //!< watchResolver() of The Current Connect
+        std::vector<Attempt_t> racing;              //!< TCP Attempts of The Current Connect
+        Task<> receiving;                           //!< establish(), Which Ends In receive()
+        Task<> conversing;
+};
+
+#endif // SESSION_HPP
@@ -0,0 +1,116 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      session_mux.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Scheduler Loop Shared By Many Sessions.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           session_mux.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Scheduler Loop Shared By Many Sessions.
+ * ****************************/
+
+#ifndef SESSION_MUX_HPP
+#define SESSION_MUX_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include "arguments.hpp"
+#include "input_reader.hpp"
+#include "scheduler.hpp"
+#include "session.hpp"
+#include "signal_drain.hpp"
+#include "task.hpp"
+
+/**
+ * @brief Runs Many TCP And UDP Sessions On One Scheduler
+ *
+ * Sessions Are Listed In File, One Per Line:
+ *     name tcp|udp host port [username secret displayname [channel]]
+ * Optional Credentials And Channel Are Sent As /auth And /join After Start.
+ * Input Line "@name text" Goes To Session name, "@name" Alone Makes It
+ * Default For Lines Without Prefix. Output Is Tagged By "[name] ".
+ * Without Session File add() Creates The Only Session, Untagged, Which Also
+ * Takes Structured Input Records. Input And signalfd Are Read By Two More
+ * Coroutines On The Same Scheduler.
+ */
+class SessionMux
+{
+    public:
+        /**
+         * @brief Reads Session File And Creates Sessions
+         * @param path Path of The Session File
+         * @param args Arguments With Timeouts, Retries And Socket Options
+         *
+         * @return SUCCESS If At Least One Session Was Created, Otherwise FAIL
+         */
+        int load(const std::string& path, const arguments& args);
+        /**
+         * @brief Creates The Only Session From Command Line Arguments
+         * @param args Parsed Arguments
+         * @param format Format of Input Records
+         * @param fd Descriptor of Structured Input, STDIN Is Used For TEXT
+         *
+         * @return SUCCESS If The Session Was Created, Otherwise FAIL
+         */
+        int add(const arguments& args, InputReader::Format_t format, int fd);
+        /**
+         * @brief Sets How Long Queued Messages May Be Sent After Signal
+         * @param timeout Deadline In Milliseconds, 0 Sends BYE At Once
+         */
+        void setDrainTimeout(uint32_t timeout) { signals.setDrainTimeout(timeout); }
+        /**
+         * @brief Connects Sessions And Runs Event Loop Until All Sessions End
+         * @return Exit Code of The Only Session, With Session File SUCCESS If The Loop Ended Normally, Otherwise FAIL or CONNECT_FAILED
+         */
+        int run();
+
+    private:
+        /**
+         * @brief Coroutine Reading Input And Dispatching Complete Records
+         */
+        Task<> readInput();
+        /**
+         * @brief Coroutine Reading signalfd, Drains Sessions And Cuts The Drain Short
+         */
+        Task<> handleSignals();
+        /**
+         * @brief Hands Record To The Only Session, Or Routes Line By Its Prefix
+         * @param record Line or Structured Record With Its Trace Number
+         */
+        void dispatch(const BaseMessages& record);
+        /**
+         * @brief Routes Line To Session By Its Prefix
+         * @param line Line Without Line Ending
+         */
+        void route(const std::string& line);
+        /**
+         * @brief Says BYE In Every Session
+         */
+        void leaveAll();
+        /**
+         * @brief Finds Session By Name
+         * @param name Name of The Session
+         *
+         * @return Index of The Session, sessions.size() If There Is None
+         */
+        size_t find(const std::string& name) const;
+
+        Scheduler scheduler;                                    //!< Outlives Sessions, Their Awaiters Unregister On Destruction
+        std::vector<std::unique_ptr<Session>> sessions;
+        std::vector<std::vector<std::string>> startupLines;    //!< /auth And /join of Each Session
+        size_t current = 0;                                     //!< Session For Lines Without Prefix
+        SignalDrain signals;                                    //!< SIGINT And SIGTERM Read From signalfd
+        InputReader input;                                      //!< Lines of STDIN or Structured Records
+        bool routed = true;                                     //!< Lines Are Routed By Prefix, False For The Only Session
+        Task<> reading;                                         //!< readInput(), Dropped On The First Signal
+        Task<> watching;                                        //!< handleSignals()
+};
+
+#endif // SESSION_MUX_HPP
@@ -0,0 +1,191 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      shm_ring.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Shared Memory Rings Exchanging Messages With Local Process.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           shm_ring.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Shared Memory Rings Exchanging Messages With Local Process.
+ * ****************************/
+
+#ifndef SHM_RING_HPP
+#define SHM_RING_HPP
+
+#include <string>
+#include <string_view>
+#include <thread>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+/************************************************/
+/*                  Shared Layout               */
+/************************************************/
+/**
+ * @brief Control Block of One Ring, Producer And Consumer Live In Different Processes
+ *
+ * Positions Only Grow, Offset In Data Is Position Modulo Capacity. Futex
+ * Words Are Set To 1 By The Side Going To Sleep And Cleared By The Side
+ * Waking It, So Running Sides Do Not Enter The Kernel.
+ */
+struct ShmRingHeader_t
+{
+    alignas(64) std::atomic<uint64_t> head;             //!< Bytes Published By Producer
+    alignas(64) std::atomic<uint64_t> tail;             //!< Bytes Released By Consumer
+    alignas(64) std::atomic<uint32_t> dataWaiting;      //!< Futex, Consumer Sleeps Until head Moves
+    std::atomic<uint32_t> spaceWaiting;                 //!< Futex, Producer Sleeps Until tail Moves
+    std::atomic<uint32_t> closed;                       //!< Set When The Client Leaves, Sleepers Are Woken
+};
+
+/**
+ * @brief Start of The Shared Object, Rings Follow
+ *
+ * Object Is Created By The Client, magic Is Written Last. Peer Maps It,
+ * Checks magic And version, Produces Into "inbound" And Consumes "outbound".
+ */
+struct ShmLinkHeader_t
+{
+    char magic[8];                  //!< SHM_LINK_MAGIC
+    uint32_t version;               //!< SHM_LINK_VERSION
+    uint32_t capacity;              //!< Data Bytes of Each Ring, Power of Two
+    uint32_t ownerPid;              //!< Process of The Client
+    uint32_t reserved;
+    alignas(64) ShmRingHeader_t inbound;     //!< Records For Server, Written By Peer
+    alignas(64) ShmRingHeader_t outbound;    //!< Received Messages, Written By Client
+};
+
+static constexpr char SHM_LINK_MAGIC[8]         = {'I','P','K','R','I','N','G','1'};
+static constexpr uint32_t SHM_LINK_VERSION      = 1;
+static constexpr size_t SHM_RING_CAPACITY       = 1024 * 1024;      //!< Data Bytes of Each Ring
+static constexpr size_t SHM_DATA_OFFSET         = 4096;             //!< Inbound Data, Outbound Data Follows It
+static constexpr size_t SHM_MAX_RECORD          = 0xFFFF;           //!< Largest Record Body
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Ring Positions Must Be Lock-Free Across Processes");
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Futex Words Must Be Plain 32-Bit Integers");
+static_assert(sizeof(ShmLinkHeader_t) <= SHM_DATA_OFFSET, "Header Must Fit Before Ring Data");
+
+/**
+ * @brief Single Producer Single Consumer Byte Ring In Shared Memory
+ *
+ * Record Is Two Bytes Big-Endian Length And Body (Same As --input=binary),
+ * Padded To Even Length. Record Never Wraps, Zero Length Marks Skipped End
+ * of Data Area. Bodies Are Read And Written In Place.
+ */
+class ShmRing
+{
+    public:
+        /**
+         * @brief Binds The View To Control Block And Data
+         * @param ringHeader Control Block
+         * @param ringData Data Area
+         * @param ringCapacity Size of Data Area, Power of Two
+         */
+        void attach(ShmRingHeader_t* ringHeader, uint8_t* ringData, size_t ringCapacity);
+
+        /**
+         * @brief Makes Room For Record Body, Producer Side
+         * @param length Length of The Body
+         *
+         * @return Pointer To The Body, nullptr If The Ring Is Full
+         */
+        uint8_t* reserve(size_t length);
+        /**
+         * @brief Publishes Reserved Record And Wakes Sleeping Consumer
+         * @param length Length of The Body, Same As In reserve()
+         */
+        void commit(size_t length);
+        /**
+         * @brief Finds Oldest Record, Consumer Side
+         * @param record Body of The Record, Valid Until release()
+         *
+         * @return True If Record Is Available, Otherwise False
+         */
+        bool peek(std::string_view& record);
+        /**
+         * @brief Frees Record Returned By peek() And Wakes Sleeping Producer
+         * @param length Length of The Body
+         */
+        void release(size_t length);
+        /**
+         * @brief Sleeps Until Producer Publishes Beyond Position Or Ring Is Closed
+         * @param seen Position of head Already Handled
+         */
+        void waitForData(uint64_t seen);
+        /**
+         * @brief Marks Ring Closed And Wakes Both Sides
+         */
+        void close();
+
+        bool isEmpty() const { return header->head.load(std::memory_order_acquire) == header->tail.load(std::memory_order_acquire); }
+        uint64_t head() const { return header->head.load(std::memory_order_acquire); }
+
+    private:
+        /**
+         * @brief Space Taken By Record With Body of Length
+         */
+        static size_t recordSize(size_t length) { return (2 + length + 1) & ~static_cast<size_t>(1); }
+        /**
+         * @brief Stores Position And Wakes Other Side If It Sleeps On Its Futex
+         */
+        static void publish(std::atomic<uint64_t>& position, uint64_t value, std::atomic<uint32_t>& waiting);
+
+        ShmRingHeader_t* header = nullptr;
+        uint8_t* data = nullptr;
+        size_t capacity = 0;
+        uint64_t reservedAt = 0;        //!< Position of Reserved Record, After Skipped End
+};
+
+/**
+ * @brief Shared Object With Inbound And Outbound Ring, Created By The Client
+ *
+ * Bridge Thread Sleeps On Futex of Inbound Ring And Signals eventfd, So
+ * The Network Loop Keeps Waiting In poll(). Outbound Records Are Written
+ * By The Network Loop Directly Into The Ring.
+ */
+class ShmLink
+{
+    public:
+        /**
+         * @brief Creates /name Shared Object And Starts Bridge Thread
+         * @param name Name of The Object, Without Leading Slash
+         *
+         * @return SUCCESS If Both Rings Are Ready, Otherwise FAIL
+         */
+        static int open(const std::string& name);
+        /**
+         * @brief Closes Rings, Joins Bridge Thread And Removes The Object
+         */
+        static void close();
+
+        static bool isOpen() { return nullptr != link; }
+        static ShmRing& inbound() { return inboundRing; }
+        static ShmRing& outbound() { return outboundRing; }
+        /**
+         * @brief eventfd Readable When Inbound Ring Got Records
+         */
+        static int getWakeFd() { return wakeFd; }
+
+    private:
+        /**
+         * @brief Body of Bridge Thread
+         */
+        static void bridge();
+
+        static ShmLinkHeader_t* link;           //!< Mapped Shared Object
+        static size_t mappedSize;
+        static std::string objectName;          //!< Name Passed To shm_unlink()
+        static ShmRing inboundRing;
+        static ShmRing outboundRing;
+        static int wakeFd;                      //!< eventfd Polled By Network Loop
+        static std::thread worker;
+        static std::atomic<bool> stopping;
+};
+
+#endif // SHM_RING_HPP
@@ -0,0 +1,90 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      signal_drain.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For SIGINT And SIGTERM Read From signalfd And Drain Deadline.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           signal_drain.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For SIGINT And SIGTERM Read From signalfd And Drain Deadline.
+ * ****************************/
+
+#ifndef SIGNAL_DRAIN_HPP
+#define SIGNAL_DRAIN_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Turns SIGINT And SIGTERM Into Readable Descriptor And Tracks Drain
+ *
+ * Signals Are Blocked And Read From signalfd Between Two Events of The
+ * Loop, No Handler Interrupts Sending. The First Signal Starts The Drain
+ * With Deadline, The Second One Moves The Deadline To Now.
+ */
+class SignalDrain
+{
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        SignalDrain() = default;
+        SignalDrain(const SignalDrain&) = delete;
+        SignalDrain& operator=(const SignalDrain&) = delete;
+        ~SignalDrain();
+        /**
+         * @brief Blocks SIGINT And SIGTERM And Opens signalfd Receiving Them
+         *
+         * Must Be Called Before Resolver Thread Is Started, So Signals Are
+         * Blocked In Every Thread And Only Read From signalfd.
+         * @return SUCCESS If signalfd Is Open, Otherwise FAIL
+         */
+        int watchSignals();
+        /**
+         * @brief Returns signalfd, Readable When Signal Is Pending
+         * @return File Descriptor, -1 Before watchSignals()
+         */
+        int getFd() const { return signalFd; }
+        /**
+         * @brief Reads Signal From signalfd And Starts Or Cuts Short The Drain
+         * @param queued Messages Still Waiting In Queues
+         *
+         * The First Signal Sets The Deadline, Second Signal Moves It To Now.
+         * @return True If Signal Was Read, Otherwise False
+         */
+        bool beginDrain(size_t queued);
+        /**
+         * @brief Determine If Signal Already Started The Drain
+         * @return True When Draining
+         */
+        bool isDraining() const { return draining; }
+        /**
+         * @brief Determine If BYE Must Be Sent Without Waiting For The Queue
+         * @return True When Draining And The Deadline Passed, Otherwise False
+         */
+        bool drainExpired() const;
+        /**
+         * @brief Returns Time When BYE Is Sent At Latest
+         * @return Deadline of The Drain, time_point::max() Before The First Signal
+         */
+        Clock::time_point getDeadline() const { return drainDeadline; }
+        /**
+         * @brief Sets How Long Queued Messages May Be Sent After Signal
+         * @param timeout Deadline In Milliseconds, 0 Sends BYE At Once
+         */
+        void setDrainTimeout(uint32_t timeout) { drainTimeout = timeout; }
+
+    private:
+        int signalFd = -1;                                          //!< signalfd of SIGINT And SIGTERM
+        uint32_t drainTimeout = 0;                                  //!< Milliseconds Queued Messages May Take After Signal
+        bool draining = false;                                      //!< Signal Arrived, Input Is Closed And Queues Are Flushed
+        Clock::time_point drainDeadline = Clock::time_point::max(); //!< BYE Is Sent At Latest At This Time
+};
+
+#endif // SIGNAL_DRAIN_HPP
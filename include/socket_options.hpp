@@ -0,0 +1,66 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      socket_options.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Socket Tuning Profiles.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           socket_options.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Socket Tuning Profiles.
+ * ****************************/
+
+#ifndef SOCKET_OPTIONS_HPP
+#define SOCKET_OPTIONS_HPP
+
+#include <string>
+
+static constexpr int OPTION_UNSET = -1;     //!< Option Is Left On Kernel Default
+
+/**
+ * @brief Socket Options Requested By User
+ *
+ * Every Option Set To OPTION_UNSET Is Not Touched.
+ */
+struct SocketOptions_t
+{
+    std::string profile;                    //!< Name of The Profile (latency, throughput, custom), Empty For Defaults
+    int sendBuffer      = OPTION_UNSET;     //!< SO_SNDBUF In Bytes
+    int recvBuffer      = OPTION_UNSET;     //!< SO_RCVBUF In Bytes
+    int noDelay         = OPTION_UNSET;     //!< TCP_NODELAY (0/1)
+    int quickAck        = OPTION_UNSET;     //!< TCP_QUICKACK (0/1), Re-Armed After Every recv()
+    int tos             = OPTION_UNSET;     //!< IP_TOS / IPV6_TCLASS Value
+    int notSentLowat    = OPTION_UNSET;     //!< TCP_NOTSENT_LOWAT In Bytes
+    int cork            = OPTION_UNSET;     //!< TCP_CORK (0/1)
+};
+
+/**
+ * @brief Fills Options Of The Selected Profile
+ * @param options Options With Profile Name, Explicitly Set Options Are Kept
+ *
+ * @return SUCCESS If The Profile Is Known, Otherwise FAIL
+ */
+int resolveSocketProfile(SocketOptions_t& options);
+
+/**
+ * @brief Applies Options To The Socket And Logs Values Read Back From Kernel
+ * @param fd Socket
+ * @param family Address Family of The Socket
+ * @param stream True For TCP Socket, TCP Level Options Are Skipped Otherwise
+ * @param options Options To Apply
+ */
+void applySocketOptions(int fd, int family, bool stream, const SocketOptions_t& options);
+
+/**
+ * @brief Re-Arms TCP_QUICKACK Which Kernel Clears After Delayed ACK
+ * @param fd Socket
+ * @param options Applied Options
+ */
+void rearmQuickAck(int fd, const SocketOptions_t& options);
+
+#endif // SOCKET_OPTIONS_HPP
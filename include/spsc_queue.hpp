@@ -0,0 +1,79 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      spsc_queue.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Bounded Lock-Free Single Producer Single Consumer Queue.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           spsc_queue.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Bounded Lock-Free Single Producer Single Consumer Queue.
+ * ****************************/
+
+#ifndef SPSC_QUEUE_HPP
+#define SPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @brief Ring Buffer Shared By Exactly One Producer And One Consumer Thread
+ * @tparam T Type of Item, Copied In And Out
+ * @tparam Capacity Number of Slots, Power of Two
+ *
+ * Indexes Only Grow, Slot Is Index Masked By Capacity. Each Index Is
+ * Written By One Side Only, So No Locks Or Compare-And-Swap Are Needed.
+ */
+template <typename T, size_t Capacity>
+class SpscQueue
+{
+    static_assert(0 != Capacity && 0 == (Capacity & (Capacity - 1)), "Capacity Must Be Power of Two");
+
+    public:
+        /**
+         * @brief Appends Item, Called By Producer Only
+         * @param item Item To Copy Into The Queue
+         *
+         * @return False If The Queue Is Full
+         */
+        bool push(const T& item)
+        {
+            size_t write = writeIndex.load(std::memory_order_relaxed);
+            if (write - readIndex.load(std::memory_order_acquire) == Capacity)
+            {
+                return false;
+            }
+            slots[write & (Capacity - 1)] = item;
+            writeIndex.store(write + 1, std::memory_order_release);
+            return true;
+        }
+        /**
+         * @brief Removes Oldest Item, Called By Consumer Only
+         * @param item Destination of The Item
+         *
+         * @return False If The Queue Is Empty
+         */
+        bool pop(T& item)
+        {
+            size_t read = readIndex.load(std::memory_order_relaxed);
+            if (read == writeIndex.load(std::memory_order_acquire))
+            {
+                return false;
+            }
+            item = slots[read & (Capacity - 1)];
+            readIndex.store(read + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        alignas(64) std::atomic<size_t> readIndex{0};     //!< Next Slot To Pop, Owned By Consumer
+        alignas(64) std::atomic<size_t> writeIndex{0};    //!< Next Slot To Push, Owned By Producer
+        T slots[Capacity];                                  //!< Items
+};
+
+#endif // SPSC_QUEUE_HPP
@@ -19,11 +19,18 @@
 #define STRINGS_H
 
 #include <string>
+#include <string_view>
 #include <cstring>
 #include <vector>
+#include <memory_resource>
 #include <algorithm>
 #include <regex>
 
+    /**
+     * @brief Character Buffer of Message Fields, Allocated From Memory Resource of The Message
+     */
+    using CharBuffer = std::pmr::vector<char>;
+
     /**
      * @brief Compares Content Of Vector And String
      * @param vec Vector To Compare
@@ -31,7 +38,7 @@
      * 
      * @return True If The Content Of Vector And String Are The Same, Otherwise False
     */
-    bool compareVectorAndString(const std::vector<char>& vec, const std::string& str); 
+    bool compareVectorAndString(const CharBuffer& vec, const std::string& str); 
 
     /**
      * @brief Checks If All Characters In Vector Are Digits, Letters Or Dash
@@ -39,35 +46,42 @@
      * 
      * @return True If All Characters In Vector Are Digits, Letters Or Dash, Otherwise False
     */
-    bool areAllDigitsOrLettersOrDash(const std::vector<char>& vec);
+    bool areAllDigitsOrLettersOrDash(std::string_view vec);
     /**
      * @brief Checks If All Characters In Vector Are Digits, Letters, Dash Or Dot
      * @param vec Vector To Check
      * 
      * @return True If All Characters In Vector Are Digits, Letters, Dash Or Dot, Otherwise False
     */    
-    bool areAllDigitsOrLettersOrDashOrDot(const std::vector<char>& vec);
+    bool areAllDigitsOrLettersOrDashOrDot(std::string_view vec);
     /**
      * @brief Checks If All Characters In Vector Are Printable Characters
      * @param vec Vector To Check
      * 
      * @return True If All Characters In Vector Are Printable Characters, Otherwise False
     */    
-    bool areAllPrintableCharacters(const std::vector<char>& vec);
+    bool areAllPrintableCharacters(std::string_view vec);
     /**
      * @brief Checks If All Characters In Vector Are Printable Characters Or Space
      * @param vec Vector To Check
      * 
      * @return True If All Characters In Vector Are Printable Characters Or Space, Otherwise False
     */
-    bool areAllPrintableCharactersOrSpace(const std::vector<char>& vec);
+    bool areAllPrintableCharactersOrSpace(const CharBuffer& vec);
+    /**
+     * @brief Checks If All Characters Are Printable Or Space, Text Is Not Copied
+     * @param text Text To Check
+     *
+     * @return True If All Characters Are Printable Characters Or Space, Otherwise False
+    */
+    bool areAllPrintableCharactersOrSpace(std::string_view text);
     /**
      * @brief Converts Vector Of Characters To String
      * @param inputVector Vector To Convert
      * 
      * @return String Created From Vector
     */
-    std::string convertToString(const std::vector<char>& inputVector);
+    std::string convertToString(const CharBuffer& inputVector);
     /**
      * @brief Compares Content Of Vector And String
      * @param vec Vector To Compare
@@ -75,7 +89,7 @@
      * 
      * @return True If The Content Of Vector And String Are The Same, Otherwise False
     */
-    bool compare(const std::vector<char>& vec, const std::string& pattern);
+    bool compare(const CharBuffer& vec, const std::string& pattern);
     
     
 #endif // STRINGS_H
@@ -0,0 +1,168 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      task.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Coroutine Task Awaitable By Other Coroutines.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           task.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Coroutine Task Awaitable By Other Coroutines.
+ * ****************************/
+
+#ifndef TASK_HPP
+#define TASK_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include "message_memory.hpp"
+
+template <typename T = void>
+class Task;
+
+/**
+ * @brief Part of Promise Shared By All Result Types
+ *
+ * Task Starts Suspended. When It Ends, Control Goes Straight To The
+ * Coroutine Which Awaited It, Root Task Just Returns To Its Resumer.
+ * Frames Come From MessageMemory::pool(), So Coroutine Started For Every
+ * Message Reuses Freed Block Instead of Calling Global operator new. Like
+ * The Pool, Tasks Are Created Only On The Thread Running The Sessions.
+ */
+struct TaskPromiseBase
+{
+    static void* operator new(std::size_t size)
+    {
+        return MessageMemory::pool()->allocate(size, alignof(std::max_align_t));
+    }
+    static void operator delete(void* frame, std::size_t size)
+    {
+        MessageMemory::pool()->deallocate(frame, size, alignof(std::max_align_t));
+    }
+
+    struct FinalAwaiter
+    {
+        bool await_ready() noexcept { return false; }
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+        {
+            std::coroutine_handle<> next = handle.promise().continuation;
+            return next ? next : std::noop_coroutine();
+        }
+        void await_resume() noexcept {}
+    };
+
+    std::suspend_always initial_suspend() noexcept { return {}; }
+    FinalAwaiter final_suspend() noexcept { return {}; }
+    void unhandled_exception() { std::terminate(); }
+
+    std::coroutine_handle<> continuation;           //!< Coroutine Awaiting This Task
+};
+
+template <typename T>
+struct TaskPromise : TaskPromiseBase
+{
+    Task<T> get_return_object();
+    void return_value(T result) { value = std::move(result); }
+
+    T value{};                                      //!< Result of co_return
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase
+{
+    Task<void> get_return_object();
+    void return_void() {}
+};
+
+/**
+ * @brief Coroutine Owned By Task Object, Its Frame Dies With The Object
+ * @tparam T Type of co_return Value
+ *
+ * Nested Task Runs When It Is co_awaited And Hands Its Result Back. Root
+ * Task Is Kicked Off By start() And Then Only Resumed By Scheduler. Task
+ * Destroyed While Suspended Destroys Its Frame, Awaiters In The Frame
+ * Unregister Themselves, So Dropping Task Cancels It.
+ *
+ * GCC 12 Miscompiles co_await Inside if/while Condition (The Coroutine
+ * Never Starts), So Result Is Always Stored In Local Variable First.
+ */
+template <typename T>
+class Task
+{
+    public:
+        using promise_type = TaskPromise<T>;
+
+        Task() = default;
+        explicit Task(std::coroutine_handle<promise_type> coroutine) : handle(coroutine) {}
+        Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)) {}
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                if (handle)
+                    handle.destroy();
+                handle = std::exchange(other.handle, nullptr);
+            }
+            return *this;
+        }
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+        ~Task()
+        {
+            if (handle)
+                handle.destroy();
+        }
+
+        /**
+         * @brief Runs Root Task Until Its First Suspension
+         */
+        void start()
+        {
+            handle.resume();
+        }
+        /**
+         * @brief Determine If The Coroutine Reached Its End
+         * @return True If The Coroutine Ended
+         */
+        bool done() const
+        {
+            return !handle || handle.done();
+        }
+
+        bool await_ready() const noexcept { return false; }
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+        {
+            handle.promise().continuation = awaiting;
+            return handle;
+        }
+        T await_resume()
+        {
+            if constexpr (!std::is_void_v<T>)
+                return std::move(handle.promise().value);
+        }
+
+    private:
+        std::coroutine_handle<promise_type> handle;
+};
+
+template <typename T>
+Task<T> TaskPromise<T>::get_return_object()
+{
+    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+}
+
+inline Task<void> TaskPromise<void>::get_return_object()
+{
+    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+}
+
+#endif // TASK_HPP
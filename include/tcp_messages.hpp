@@ -22,6 +22,7 @@
 #include <iostream>
 #include <regex>
 #include <cstring>
+#include <cerrno>
 #include <sys/socket.h>
 #include "base_messages.hpp" 
 
@@ -32,6 +33,11 @@ class TcpMessages : public BaseMessages
          * @brief Default Constructor
          */        
         TcpMessages();
+        /**
+         * @brief Construct a new Tcp Messages object In Memory Resource
+         * @param resource Arena or Pool For All Fields of The Message
+         */
+        explicit TcpMessages(std::pmr::memory_resource* resource);
         /**
          * @brief Construct a new Tcp Messages object
          * @param type Type Of Message
@@ -42,54 +48,70 @@ class TcpMessages : public BaseMessages
         /**
          * @brief Sends Authentication Message.
          * @param server_socket Client Socket
+         * @param unsent Bytes The Socket Did Not Take Yet
          */
-        void sendAuthMessage(int client_socket);
+        void sendAuthMessage(int client_socket, std::string& unsent);
         /**
-         * @brief Checks If Incomming Message Includes Join Pattern.
+         * @brief Checks If Incomming Message Is REPLY To JOIN Or Message From Server
+         * @param accepted Set To Result of REPLY
+         *
+         * @return SUCCESS For REPLY Or Valid Message, Otherwise JOIN_FAILED
         */        
-        int checkJoinReply();
+        int checkJoinReply(bool& accepted);
         /**
          * @brief Sends Join Message To Server
          * @param server_socket Server Socket
+         * @param unsent Bytes The Socket Did Not Take Yet
          * 
          * @return None
         */        
-        void sendJoinMessage(int client_socket);
+        void sendJoinMessage(int client_socket, std::string& unsent);
         /**
          * @brief Sends Bye Message To Server
          * @param server_socket Server Socket
+         * @param unsent Bytes The Socket Did Not Take Yet
          * 
          * @return None
         */        
-        void sentByeMessage(int clientSocket);
+        void sentByeMessage(int clientSocket, std::string& unsent);
         /**
          * @brief Sends Users Message To Server
          * @param server_socket Server Socket
+         * @param unsent Bytes The Socket Did Not Take Yet
         */        
-        void sentUsersMessage(int clientSocket);
-        /**
-         * @brief Checks If Error Or Bye Message Was Received
-         * @param server_socket Server Socket
-         * 
-         * @return 0 If Everything Went Well, -1 If The Reply Is Not OK, -2 If Error Occurs
-        */        
-        int checkIfErrorOrBye(int clientSocket);
+        void sentUsersMessage(int clientSocket, std::string& unsent);
         /**
          * @brief Sends Error Message To Server
          * @param server_socket Server Socket
          * @param type Type Of Error
+         * @param unsent Bytes The Socket Did Not Take Yet
          * 
          * @return None
         */        
-        void sendErrorMessage(int clientSocket, MessageType_t type);
+        void sendErrorMessage(int clientSocket, MessageType_t type, std::string& unsent);
         /**
          * @brief Handles Reply From Server
          * 
-         * @return 0 If The Reply Is OK, -1 If The Reply Is Not OK, -2 If Error Occurs 
+         * @return SUCCESS For REPLY OK, AUTH_FAILED For REPLY NOK Or Invalid Line, JUST_A_MESSAGE For Message
         */        
         int handleAuthReply();
+        /**
+         * @brief Sends Bytes Waiting For Non-Blocking Socket, Keeps What It Did Not Take
+         * @param clientSocket Client Socket
+         * @param unsent Bytes The Socket Did Not Take Yet
+         *
+         * @return SUCCESS If The Socket Took Bytes or Was Full, FAIL If The Connection Failed
+         */
+        static int flush(int clientSocket, std::string& unsent);
 
-        void StoreDisplayNameAndContent();
+    private:
+        /**
+         * @brief Sends Message To The Server
+         * @param clientSocket Client Socket
+         * @param msgToSend Message Terminated By \r\n
+         * @param unsent Bytes The Socket Did Not Take Yet, msgToSend Queues Behind Them
+         */
+        static void transmit(int clientSocket, const std::string& msgToSend, std::string& unsent);
 };
 
 #endif // TCP_MESSAGES_HPP
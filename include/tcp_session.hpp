@@ -0,0 +1,124 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      tcp_session.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For TCP Session Run As Coroutines.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           tcp_session.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For TCP Session Run As Coroutines.
+ * ****************************/
+
+#ifndef TCP_SESSION_HPP
+#define TCP_SESSION_HPP
+
+#include <string>
+#include "session.hpp"
+#include "tcp_messages.hpp"
+#include "backoff.hpp"
+
+/**
+ * @brief IPK24 Session Over TCP, Run As Coroutines
+ *
+ * When The Server Drops The Connection, receive() May Reconnect With
+ * Backoff And Rebuild The Session, converse() Meanwhile Keeps Lines Queued.
+ * Socket Is Non-Blocking, Bytes The Kernel Did Not Take Are Sent By
+ * write() And The Next Message Waits For Them.
+ */
+class TcpSession : public Session
+{
+    public:
+        /**
+         * @brief Constructor of TcpSession
+         * @param scheduler Scheduler Running Coroutines of The Session
+         * @param name Name Used For Routing Input And Tagging Output
+         * @param addr Server's Host Name or Address
+         * @param port Server's Port
+         * @param connectTimeOut Deadline For Resolution And Connection In Milliseconds
+         */
+        TcpSession(Scheduler& scheduler, const std::string& name, const std::string& addr, int port, int connectTimeOut);
+        ~TcpSession() override;
+        /**
+         * @brief Enables Reconnect After Server Drops The Session
+         * @param attempts Attempts Per Outage, 0 Disables Reconnect
+         * @param delay First Backoff Step In Milliseconds
+         */
+        void setReconnect(uint32_t attempts, uint32_t delay);
+
+    protected:
+        Task<> receive() override;
+        Task<> converse() override;
+
+    private:
+        static constexpr int BUFSIZE = 1536;
+        static constexpr int MAX_RECONNECT_DELAY = 30000;   //!< Cap of Backoff Step In Milliseconds
+        static constexpr int REPLY_TIMEOUT = 5000;          //!< Wait For REPLY While Rebuilding Session In Milliseconds
+
+        /**
+         * @brief Receives Segment And Appends It To stream
+         * @return Number of Received Bytes, 0 or Less If The Connection Dropped
+         */
+        ssize_t receiveSegment();
+        /**
+         * @brief Handles Every Complete Line In stream
+         */
+        void handleStream();
+        /**
+         * @brief Reconnects With Exponential Backoff And Rebuilds The Session
+         *
+         * @return True If The Session Was Rebuilt, Otherwise False
+         */
+        Task<bool> reconnect();
+        /**
+         * @brief Authenticates Again And Rejoins Channel On New Connection
+         * @param joinInFlight JOIN Was Sent But Not Answered Before The Drop
+         *
+         * @return SUCCESS, AUTH_FAILED If Server Refused Credentials, FAIL If Connection Dropped Again
+         */
+        Task<int> rebuildSession(bool joinInFlight);
+        /**
+         * @brief Waits For REPLY While Rebuilding, Messages Coming Before It Are Printed
+         *
+         * @return SUCCESS For REPLY OK, AUTH_FAILED For REPLY NOK, FAIL If Connection Dropped Or Timed Out
+         */
+        Task<int> awaitReply();
+        /**
+         * @brief Handles Single Line From Server
+         * @param inbound Line Stored In Buffer, Allocated In Arena of receive()
+         */
+        void handleServerLine(TcpMessages& inbound);
+        /**
+         * @brief Sends ERR And BYE, Ends The Session
+         * @param text Description Printed Locally
+         */
+        void protocolError(const std::string& text);
+        /**
+         * @brief Starts write() For Bytes The Socket Did Not Take At Once
+         */
+        void writeLater();
+        /**
+         * @brief Sends unsent Whenever The Socket Becomes Writable
+         */
+        Task<> write();
+
+        TcpMessages message;                //!< User's Input
+        std::string stream;                 //!< Received Bytes Without Complete Line Yet
+        std::string unsent;                 //!< Sent Bytes Non-Blocking Socket Did Not Take Yet
+        Task<> writing;                     //!< write() While unsent Is Not Empty
+
+        TcpMessages credentials;                        //!< Last AUTH Sent, Replayed After Reconnect
+        BaseMessages::ChannelID joinedChannel;          //!< Channel Confirmed By Server
+        BaseMessages::ChannelID pendingChannel;         //!< Channel of The Last JOIN Sent
+        uint32_t reconnectAttempts = 0;                 //!< Reconnects Per Outage, 0 Disables Reconnect
+        Backoff backoff{std::chrono::milliseconds(500), std::chrono::milliseconds(MAX_RECONNECT_DELAY)};
+        bool rebuilding = false;                        //!< REPLY Belongs To rebuildSession(), Not To converse()
+        bool rebuildAccepted = false;                   //!< Result of REPLY While Rebuilding
+};
+
+#endif // TCP_SESSION_HPP
@@ -0,0 +1,87 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      timestamps.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Kernel Receive And Transmit Timestamps.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           timestamps.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Kernel Receive And Transmit Timestamps.
+ * ****************************/
+
+#ifndef TIMESTAMPS_HPP
+#define TIMESTAMPS_HPP
+
+#include <cstdint>
+#include <ctime>
+#include <sys/types.h>
+#include <sys/socket.h>
+
+class KernelTimestamps
+{
+    public:
+        /**
+         * @brief Enables SO_TIMESTAMPING Software RX/TX Timestamps On The Socket
+         * @param sock UDP Socket
+         *
+         * Kernel Numbers Datagrams Transmitted On The Socket From Zero Since This Call.
+         * @return SUCCESS If The Kernel Accepted The Option, Otherwise FAIL
+         */
+        int enable(int sock);
+        /**
+         * @brief Determine If Timestamping Is Enabled
+         * @return True If Enabled
+         */
+        bool isEnabled() const;
+        /**
+         * @brief Receives Datagram Together With Its Kernel RX Timestamp
+         * @param sock Socket
+         * @param buffer Buffer For The Datagram
+         * @param size Size of The Buffer
+         * @param from Sender's Address
+         * @param fromLen Length of Sender's Address
+         *
+         * @return Number of Received Bytes, Or -1 On Error or When Nothing Is Waiting
+         */
+        ssize_t receive(int sock, char* buffer, size_t size, struct sockaddr_storage* from, socklen_t* fromLen);
+        /**
+         * @brief Reads TX Timestamps From Socket's Error Queue
+         * @param sock Socket
+         */
+        void drainErrorQueue(int sock);
+        /**
+         * @brief Counts Datagram Sent On The Socket, Including CONFIRM
+         */
+        void countTransmit() { sent++; }
+        /**
+         * @brief Marks The Last Counted Datagram As The One Whose CONFIRM Is Awaited
+         */
+        void expectConfirm();
+        /**
+         * @brief Computes Network RTT of The Awaited Datagram
+         * @param sock Socket, Its Error Queue Is Drained First
+         * @param rttMs Round Trip Time Between Kernel TX And RX Timestamps In Milliseconds
+         *
+         * @return True If Both Timestamps Are Known
+         */
+        bool networkRtt(int sock, double& rttMs);
+
+    private:
+        static constexpr uint32_t TX_HISTORY = 16;  //!< Remembered TX Timestamps
+
+        bool enabled = false;
+        uint32_t sent = 0;                          //!< Datagrams Sent On The Socket Since enable()
+        uint32_t awaitedId = 0;                     //!< Kernel ID of Datagram Whose CONFIRM Is Awaited
+        struct timespec lastRx = {0, 0};            //!< RX Timestamp of The Last Datagram
+        uint32_t txIds[TX_HISTORY] = {};            //!< Kernel IDs of Remembered TX Timestamps
+        struct timespec txTimes[TX_HISTORY] = {};   //!< Remembered TX Timestamps
+        bool txValid[TX_HISTORY] = {};              //!< Slot Holds TX Timestamp
+};
+
+#endif // TIMESTAMPS_HPP
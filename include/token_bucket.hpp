@@ -0,0 +1,80 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      token_bucket.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Token Bucket Pacing Outgoing Messages.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           token_bucket.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Token Bucket Pacing Outgoing Messages.
+ * ****************************/
+
+#ifndef TOKEN_BUCKET_HPP
+#define TOKEN_BUCKET_HPP
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Token Bucket Limiting Messages Put On The Wire
+ *
+ * Bucket Holds Up To burst Tokens And Gains rate Tokens Per Second, Every
+ * Sent Message Takes One. Loop Which Has Nothing Left To Send Sleeps Until
+ * readyAt(), So Bursts of Input Leave Evenly Spaced. Rate 0 Means No Limit.
+ */
+class TokenBucket
+{
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief Sets Rate And Burst, Bucket Starts Full
+         * @param ratePerSecond Messages Per Second, 0 Disables Pacing
+         * @param burstSize Messages Which May Leave Back To Back
+         * @param now Current Time
+         */
+        void configure(double ratePerSecond, uint32_t burstSize, Clock::time_point now = Clock::now());
+        /**
+         * @brief Determine If Pacing Is Enabled
+         * @return True If Rate Is Limited
+         */
+        bool isLimited() const { return 0.0 < rate; }
+        /**
+         * @brief Determine If One Message May Be Sent Now
+         * @param now Current Time
+         *
+         * @return True If Whole Token Is In The Bucket
+         */
+        bool available(Clock::time_point now = Clock::now());
+        /**
+         * @brief Takes Token For Sent Message
+         */
+        void take();
+        /**
+         * @brief Returns Time When The Next Token Is In The Bucket
+         * @param now Current Time
+         *
+         * @return now If Token Is Available Already
+         */
+        Clock::time_point readyAt(Clock::time_point now = Clock::now());
+
+    private:
+        /**
+         * @brief Adds Tokens Gained Since The Last Refill, Up To burst
+         * @param now Current Time
+         */
+        void refill(Clock::time_point now);
+
+        double rate     = 0.0;          //!< Tokens Gained Per Second
+        double capacity = 1.0;          //!< Burst, Maximum Number of Tokens
+        double tokens   = 1.0;          //!< Tokens In The Bucket
+        Clock::time_point refilledAt;   //!< Time of The Last Refill
+};
+
+#endif // TOKEN_BUCKET_HPP
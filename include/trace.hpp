@@ -0,0 +1,196 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      trace.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For Per-Message Lifecycle Tracing In Chrome Trace Format.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           trace.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For Per-Message Lifecycle Tracing In Chrome Trace Format.
+ * ****************************/
+
+#ifndef TRACE_HPP
+#define TRACE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "spsc_queue.hpp"
+
+/**
+ * @brief Records Stages of Every Message As Spans Viewable In Perfetto Or chrome://tracing
+ *
+ * Each Thread Pushes Spans Into Its Own Lock-Free Queue, Flushing Thread
+ * Drains The Queues Into JSON File, So The Hot Path Pays For Two Clock
+ * Reads And One Push. Spans Carry Number of The Message Being Handled By
+ * The Thread, Outbound And Inbound Messages Are Numbered From One Counter.
+ * Disabled Trace Costs One Relaxed Load Per Span.
+ */
+class Trace
+{
+    public:
+        /**
+         * @brief Span Passed To Flushing Thread
+         */
+        struct Event_t
+        {
+            const char* name;       //!< Stage, String Literal
+            uint64_t start;         //!< Nanoseconds of Monotonic Clock
+            uint64_t end;
+            uint32_t message;       //!< Number of The Message, 0 Outside of Any Message
+            bool inbound;           //!< Message Came From Server
+        };
+
+        /**
+         * @brief Times One Stage of Current Message Until end() Or Scope Exit
+         */
+        class Scope
+        {
+            public:
+                explicit Scope(const char* stageName) : name(stageName), start(enabled() ? now() : 0) {}
+                ~Scope() { end(); }
+                Scope(const Scope&) = delete;
+                Scope& operator=(const Scope&) = delete;
+                /**
+                 * @brief Ends The Span Before Scope Exit
+                 */
+                void end()
+                {
+                    if (0 != start)
+                        span(name, start, now());
+                    start = 0;
+                }
+
+            private:
+                const char* name;
+                uint64_t start;             //!< 0 If Trace Is Disabled Or Span Already Ended
+        };
+
+        /**
+         * @brief Creates Trace File And Starts Flushing Thread
+         * @param path Path of The Trace File
+         *
+         * @return SUCCESS If Tracing Runs, Otherwise FAIL
+         */
+        static int open(const std::string& path);
+        /**
+         * @brief Determine If Tracing Runs
+         * @return True If Spans Are Recorded
+         */
+        static bool enabled() { return active.load(std::memory_order_relaxed); }
+        /**
+         * @brief Returns Time of Monotonic Clock In Nanoseconds
+         */
+        static uint64_t now();
+        /**
+         * @brief Starts Span Which Ends Elsewhere, e.g. Waiting For REPLY
+         * @return Current Time, 0 If Trace Is Disabled
+         */
+        static uint64_t startSpan() { return enabled() ? now() : 0; }
+        /**
+         * @brief Ends Span Started By startSpan(), Does Nothing For Start 0
+         * @param name Stage, String Literal
+         * @param start Value Returned By startSpan()
+         * @param message Number of The Message
+         * @param inbound Message Came From Server
+         */
+        static void endSpan(const char* name, uint64_t start, uint32_t message, bool inbound)
+        {
+            if (0 != start)
+                span(name, start, now(), message, inbound);
+        }
+        /**
+         * @brief Starts New Message On Calling Thread
+         * @param inbound Message Came From Server
+         *
+         * @return Number of The Message
+         */
+        static uint32_t beginMessage(bool inbound);
+        /**
+         * @brief Returns Message Handled By Calling Thread
+         * @return Number of The Message, 0 If There Is None
+         */
+        static uint32_t currentMessage();
+        /**
+         * @brief Continues Message Started On Other Thread Or Earlier
+         * @param message Number of The Message
+         * @param inbound Message Came From Server
+         */
+        static void resumeMessage(uint32_t message, bool inbound);
+        /**
+         * @brief Records Span of Current Message
+         * @param name Stage, String Literal
+         * @param start Start In Nanoseconds
+         * @param end End In Nanoseconds
+         */
+        static void span(const char* name, uint64_t start, uint64_t end);
+        /**
+         * @brief Records Span of Given Message, Used When Waiting Ends On Other Message
+         * @param name Stage, String Literal
+         * @param start Start In Nanoseconds
+         * @param end End In Nanoseconds
+         * @param message Number of The Message
+         * @param inbound Message Came From Server
+         */
+        static void span(const char* name, uint64_t start, uint64_t end, uint32_t message, bool inbound);
+        /**
+         * @brief Names Calling Thread In The Timeline
+         * @param name Name, String Literal
+         */
+        static void nameThread(const char* name);
+        /**
+         * @brief Stops Flushing Thread, Writes Remaining Spans And Closes The File
+         */
+        static void close();
+
+    private:
+        static constexpr size_t BUFFER_CAPACITY = 8192;     //!< Spans Waiting For Flush Per Thread
+        static constexpr int FLUSH_PERIOD = 20;             //!< Flushing Thread Wakes Up This Often In Milliseconds
+
+        /**
+         * @brief Spans of One Thread
+         */
+        struct Buffer
+        {
+            SpscQueue<Event_t, BUFFER_CAPACITY> queue;
+            uint32_t tid;
+            std::atomic<const char*> name{nullptr};
+            bool named = false;                             //!< Name Was Written, Touched By Flushing Thread Only
+        };
+
+        /**
+         * @brief Returns Buffer of Calling Thread, Registers It On First Use
+         */
+        static Buffer* threadBuffer();
+        /**
+         * @brief Body of Flushing Thread
+         */
+        static void run();
+        /**
+         * @brief Writes Queued Spans of All Threads Into The File
+         */
+        static void flush();
+
+        static std::atomic<bool> active;
+        static std::atomic<bool> running;
+        static std::atomic<uint32_t> nextMessage;
+        static std::atomic<uint32_t> dropped;               //!< Spans Lost On Full Queue
+        static std::mutex registry;                         //!< Guards buffers, Taken Once Per Thread And By Flush
+        static std::vector<std::unique_ptr<Buffer>> buffers;
+        static std::thread flusher;
+        static FILE* file;
+        static thread_local Buffer* ownBuffer;              //!< Buffer of Calling Thread
+};
+
+#endif // TRACE_HPP
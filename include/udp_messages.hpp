@@ -21,27 +21,33 @@
 #include <iostream>
 #include <string>
 #include <unistd.h>             // For close
-#include <unordered_set>
 #include <chrono>
 #include <thread>
 #include <netinet/in.h>         // For sockaddr_in, AF_INET, SOCK_DGRAM
+#include <sys/socket.h>         // For sockaddr_storage
 #include <arpa/inet.h>          // For Debug
 #include <iomanip> 
 #include "base_messages.hpp"
+#include "protocol_schema.hpp"
 
 class UdpMessages : public BaseMessages {
 public:
+    using Datagram = BinaryCodec::Datagram;
 
 
     uint16_t messageID;
     uint16_t refMessageID;
     uint8_t result;
-    uint16_t internalMsgId;
-    std::unordered_set<uint16_t> receivedMessageIDs;
+    static std::chrono::high_resolution_clock::time_point lastTransmitAt;   //!< Time Just Before The Last sendto()
    /**
      * @brief Construct a new Udp Messages object
      */
     UdpMessages();
+    /**
+     * @brief Construct a new Udp Messages object In Memory Resource
+     * @param resource Arena or Pool For All Fields of The Message
+     */
+    explicit UdpMessages(std::pmr::memory_resource* resource);
     /**
      * @brief Construct a new Udp Messages object
      * @param type Type Of Message
@@ -49,44 +55,11 @@ public:
     */
     UdpMessages(MessageType_t type, Message_t content);
     /**
-     * @brief Apppend Vector To Serialized Message
-     * @param serialized Serialized Message
-     * @param contentBuffer Content Buffer
-     */
-    void appendContent(std::vector<uint8_t>& serialized, const std::vector<char>& contentBuffer);
-    /**
-     * @brief Checks Timer
-     * @param startTime Start Time
-     * @param endTime End Time
-    */    
-    int checkTimer(std::chrono::high_resolution_clock::time_point startTime, std::chrono::high_resolution_clock::time_point endTime);
-    /**
-     * @brief Increment Udp Message ID
-    */    
-    void incrementUdpMsgId();
-    /**
-     * @brief Set Udp Message ID
-    */    
-    void setUdpMsgId();
-    /**
-     * @brief Get Udp Message ID
-    */    
-    uint16_t getUdpMsgId();
-    /**
-     * @brief Set Display Name
-     * @param displayNameVec Display Name Vector
-    */    
-    void setUdpDisplayName(const std::vector<char>& displayNameVec);
-    /**
-     * @brief Set Channel ID
-     * @param channelIDVec Channel ID Vector
-    */    
-    void setUdpChannelID(const std::vector<char>& channelIDVec);
-    /**
-     * @brief Serialize Message
-     * @return std::vector<uint8_t> Serialized Message
+     * @brief Serialize Message Thru Encoder Generated From Protocol Schema
+     * @param resource Memory For The Datagram, Usually MessageArena of The Sender
+     * @return Datagram Serialized Message, Empty If The Type Is Not Sent To Server
      */    
-    std::vector<uint8_t> serializeMessage();
+    Datagram serializeMessage(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
     /**
      * @brief Deserialize Byte Array To Message
      * @param serialized Byte Array
@@ -94,63 +67,35 @@ public:
      * Deserialize Byte Array To Message
      * @return Message
     */    
-    void deserializeMessage(const std::vector<char>& serializedMsg);
-    /**
-     * @brief Checks if Message is Reply
-     * @return int
-    */    
-    int recvUpdIncomingReply();
+    void deserializeMessage(const CharBuffer& serializedMsg);
     /**
-     * @brief Send UDP Auth Message
+     * @brief Confirms Received Datagram Straight From Its Header
      * @param sock Socket
      * @param server Server
-    */    
-    void sendUdpAuthMessage(int sock, const struct sockaddr_in& server);
-    /**
-     * @brief Send UDP Message
-     * @param sock Socket
-     * @param server Server
-    */    
-    void sendUdpMessage(int sock, const struct sockaddr_in& server);
-    /**
-     * @brief Checks UDP Message
-     * @return int
-    */    
-    int recvUdpMessage();
-    /**
-     * @brief Send UDP Confirm
-     * @param sock Socket
-     * @param server Server
-    */    
-    void sendUdpConfirm(int sock, const struct sockaddr_in& server);
-    /**
-     * @brief Checks UDP Confirm
-     * @return int
+     * @param datagram Received Datagram
+     * @param length Length of The Datagram
+     *
+     * Called Before The Datagram Is Decoded, So The Server Gets CONFIRM
+     * Without Waiting For Validation And Printing.
+     * @return True If CONFIRM Was Sent, False For CONFIRM Or Truncated Datagram
     */
-    int recvUpdConfirm();
+    static bool confirmFromHeader(int sock, const struct sockaddr_storage& server, const char* datagram, size_t length);
     /**
-     * @brief Send UDP Error
+     * @brief Send UDP Bye Message
      * @param sock Socket
      * @param server Server
-     * @param errorMsg Error Message
+     * @param recordHistory False For BYE To Losing Racing Address
     */
-    void sendUdpError(int sock, const struct sockaddr_in& server, const std::string& errorMsg);
+    void sendByeMessage(int sock,const struct sockaddr_storage& server, bool recordHistory = true);
     /**
-     * @brief Send UDP Bye Message
+     * @brief Sends Serialized Datagram To The Server
      * @param sock Socket
-     * @param server Server
+     * @param data Serialized Message
+     * @param length Length of The Message
+     * @param server Server's Address
+     * @return True If The Datagram Was Handed To Kernel
     */
-    void sendByeMessage(int sock,const struct sockaddr_in& server);
-    /**
-     * @brief Receives UDP Error
-     * @return void
-    */    
-    void recvUdpError();
-
-private:
-    static constexpr int8_t NULL_BYTE = 0x00;
-    uint16_t lastSentMessageID;
-    uint16_t lastReceivedMessageID;
+    static bool transmit(int sock, const uint8_t* data, size_t length, const struct sockaddr_storage& server);
 };
 
 #endif // UDP_MESSAGES_HPP
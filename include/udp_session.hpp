@@ -0,0 +1,164 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      udp_session.hpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Header File For UDP Session Run As Coroutines.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           udp_session.hpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Header File For UDP Session Run As Coroutines.
+ * ****************************/
+
+#ifndef UDP_SESSION_HPP
+#define UDP_SESSION_HPP
+
+#include <string>
+#include <vector>
+#include <unordered_set>
+#include "session.hpp"
+#include "udp_messages.hpp"
+#include "timestamps.hpp"
+
+/**
+ * @brief IPK24 Session Over UDP, Run As Coroutines
+ *
+ * Only One Message Is In Flight. deliver() Sends It And co_awaits CONFIRM
+ * With Deadline, Retransmitting Kept Bytes Until Retries Run Out. When The
+ * Server Has More Addresses, AUTH Races Them (RFC 8305) And One Coroutine
+ * Per Candidate Waits For The First Answer.
+ */
+class UdpSession : public Session
+{
+    public:
+        /**
+         * @brief Constructor of UdpSession
+         * @param scheduler Scheduler Running Coroutines of The Session
+         * @param name Name Used For Routing Input And Tagging Output
+         * @param addr Server's Host Name or Address
+         * @param port Server's Port
+         * @param retryCount Maximum Number of Retransmissions
+         * @param confirmTimeOut Time For CONFIRM In Milliseconds
+         * @param connectTimeOut Deadline For Resolution In Milliseconds
+         */
+        UdpSession(Scheduler& scheduler, const std::string& name, const std::string& addr, int port, int retryCount, int confirmTimeOut, int connectTimeOut);
+        ~UdpSession() override;
+        /**
+         * @brief Enables Kernel RX/TX Timestamps And Per CONFIRM RTT Report
+         * @param enable True To Enable
+         */
+        void setKernelTimestamps(bool enable);
+
+    protected:
+        /**
+         * @brief Resolved Server Sets peer, More Addresses Start The Race
+         */
+        void prepare() override;
+        Task<> receive() override;
+        Task<> converse() override;
+
+    private:
+        static constexpr int BUFSIZE = 1536;
+
+        /**
+         * @brief Sends Message And Waits Until It Is Confirmed
+         * @param type Type of The Message
+         *
+         * @return True If CONFIRM Came, False If Retries Ran Out or Session Ended
+         */
+        Task<bool> deliver(BaseMessages::MessageType_t type);
+        /**
+         * @brief Sends ERR If Something Was Wrong And BYE, Then Ends The Session
+         */
+        Task<> goodbye();
+        /**
+         * @brief Sends Datagram To The Server, While Racing To Every Started Address
+         * @param datagram Serialized Message
+         */
+        void transmit(const UdpMessages::Datagram& datagram);
+        /**
+         * @brief Sends Datagram To The Next Racing Address
+         * @param datagram Serialized AUTH
+         */
+        void startNextCandidate(const UdpMessages::Datagram& datagram);
+        /**
+         * @brief Returns Time To Wake Up While Waiting For CONFIRM
+         * @param deadline Deadline of Retransmission
+         *
+         * @return Start of The Next Racing Address If It Comes Earlier, Otherwise deadline
+         */
+        Clock::time_point wakeAt(Clock::time_point deadline) const;
+        /**
+         * @brief Coroutine Waiting For The First Datagram From One Candidate
+         * @param index Index of The Candidate
+         */
+        Task<> watchCandidate(size_t index);
+        /**
+         * @brief Keeps The Candidate Which Answered First
+         * @param index Index of The Winning Candidate
+         */
+        void adoptCandidate(size_t index);
+        /**
+         * @brief Sends BYE To Racing Address Which Is Left
+         * @param candidate Losing Candidate
+         */
+        void sendBye(const Candidate_t& candidate);
+        /**
+         * @brief Receives Datagram, Kernel RX Timestamp Is Taken When Enabled
+         * @param buf Buffer For The Datagram
+         * @param size Size of The Buffer
+         * @param from Sender's Address
+         *
+         * @return Number of Received Bytes, -1 If Nothing Was Waiting
+         */
+        ssize_t receiveDatagram(char* buf, size_t size, struct sockaddr_storage& from);
+        /**
+         * @brief Reports Network And Application RTT of Confirmed Message
+         */
+        void reportConfirmRtt();
+        /**
+         * @brief Handles Received Datagram
+         * @param inbound Datagram Stored In Buffer, Allocated In Arena of receive()
+         */
+        void handleDatagram(UdpMessages& inbound);
+        /**
+         * @brief Reports Invalid Datagram, goodbye() Then Sends ERR
+         * @param text Content of ERR
+         */
+        void protocolError(const std::string& text);
+
+        UdpMessages message;                        //!< User's Input, Serialized For Sending
+        MessageArena outbound;                      //!< Holds Datagram In Flight, Reset By deliver()
+        struct sockaddr_storage peer;               //!< Server's Address, Port Follows The Server's Answers
+        int maxRetries;
+        int confirmationTimeout;
+
+        uint16_t inFlightID = 0;                    //!< ID of Datagram Waiting For CONFIRM
+        bool awaitingConfirm = false;
+        uint16_t replyFor = 0;                      //!< ID of Message Which REPLY Refers To
+        std::string errorText;                      //!< Content of ERR Sent By goodbye()
+
+        uint16_t nextMessageID = 0;
+        std::unordered_set<uint16_t> receivedIDs;   //!< Already Handled Datagrams, Duplicates Are Only Confirmed
+
+        /* Address Racing */
+        size_t nextCandidate = 0;                   //!< Index of The Next Candidate To Receive AUTH
+        Clock::time_point nextAttemptAt;            //!< Time When The Next Candidate Receives AUTH
+        std::vector<Task<>> racers;                 //!< watchCandidate() of Every Candidate
+        Signal adopted;                             //!< Set When The Winning Candidate Became sock
+
+        /* Timestamps */
+        KernelTimestamps timestamps;                //!< Kernel Timestamps of The Session Socket
+        bool kernelTimestamps = false;              //!< Kernel Timestamps Were Requested
+        std::chrono::high_resolution_clock::time_point sentAt;      //!< Time When The Awaited Datagram Was Handed To Kernel
+        std::chrono::high_resolution_clock::time_point receivedAt;  //!< Time When The Last Datagram Was Read
+        uint64_t confirmAwaitedSince = 0;           //!< Trace Start of Waiting For CONFIRM, 0 If Not Traced
+        uint32_t confirmMessage = 0;                //!< Trace Number of The Message Awaiting CONFIRM
+};
+
+#endif // UDP_SESSION_HPP
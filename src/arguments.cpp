@@ -26,6 +26,7 @@
 #include <arpa/inet.h>
 #include <cstdlib>
 #include "../include/arguments.hpp"
+#include "../include/macros.hpp"
 /************************************************/
 /*                  Class                       */
 /************************************************/
@@ -41,13 +42,39 @@ arguments::arguments(int argc, char* argv[])
 */
 void arguments::printHelp()
 {
-    fprintf(stdout,"Usage: ./ipk24chat-client -t <Protocol> -s <HostName/IP> -p <Port> -d <Timeout> -r <MaxRetransmits> \n");
+    fprintf(stdout,"Usage: ./ipk24chat-client -t <Protocol> -s <HostName/IP> -p <Port> -d <Timeout> -r <MaxRetransmits> -c <ConnectTimeout> \n");
     fprintf(stdout,"-help, help message, can not be combined with other arguments\n");
     fprintf(stdout,"-t [tcp, udp] Mandatory Argument Specifying Transport Protocol Used For Connection\n");
     fprintf(stdout,"-s, Mandatory Argument Specifying Host Name or IP Address\n");
     fprintf(stdout,"-p, Optional Argument Specifying Server Port                            (Default Value: 4567)\n");
     fprintf(stdout,"-d, Optional Argument Specifying UDP Confirmation Timeout               (Default Value: 250)\n");
     fprintf(stdout,"-r, Optional Argument Specifying Maximum Number of UDP Retransmits      (Default Value: 3)\n");
+    fprintf(stdout,"-c, Optional Argument Specifying Resolve And Connect Deadline In ms     (Default Value: 5000)\n");
+    fprintf(stdout,"--socket-profile=[latency, throughput, custom] Optional Socket Tuning  (Default: Kernel Defaults)\n");
+    fprintf(stdout,"--sndbuf, --rcvbuf, --nodelay, --quickack, --tos, --notsent-lowat, --cork Custom Socket Options\n");
+    fprintf(stdout,"--kernel-timestamps, Reports Network And Application RTT For Each UDP CONFIRM\n");
+    fprintf(stdout,"--capture FILE, Records Sent And Received Packets Into pcapng File\n");
+    fprintf(stdout,"--trace FILE, Writes Stages of Every Message As Chrome Trace JSON (Perfetto)\n");
+    fprintf(stdout,"--replay FILE, Replays Server Traffic of Capture, Replaces -t, -s And -p\n");
+    fprintf(stdout,"--replay-speed=[recorded, max] Optional Pacing of Replay                (Default: recorded)\n");
+    fprintf(stdout,"--record-history FILE, Appends Every Sent And Received Message To History Log\n");
+    fprintf(stdout,"--history FILE, Prints History Log And Exits, --history-last N Prints Only N Newest\n");
+    fprintf(stdout,"--search-memory MiB, Memory Cap of /search Index, 0 Disables It   (Default Value: 16)\n");
+    fprintf(stdout,"--sessions FILE, Runs Sessions Listed In FILE In One Process, Replaces -t, -s And -p\n");
+    fprintf(stdout,"--rate MSGS, Paces Outgoing Messages To MSGS Per Second, 0 Disables It (Default Value: 0)\n");
+    fprintf(stdout,"--burst N, Messages Which May Leave Back To Back When Paced      (Default Value: 1)\n");
+    fprintf(stdout,"--retransmit-budget=[bypass, share] UDP Retransmissions Paced Too   (Default: bypass)\n");
+    fprintf(stdout,"--reconnect N, Reconnects Dropped TCP Session Up To N Times, 0 Disables It (Default Value: 0)\n");
+    fprintf(stdout,"--reconnect-delay MS, First Backoff Step Before Reconnect         (Default Value: 500)\n");
+    fprintf(stdout,"--drain-timeout MS, Queued Messages Sent After SIGINT/SIGTERM Before BYE, 0 Sends BYE At Once (Default Value: 2000)\n");
+    fprintf(stdout,"--send-file FILE, Sends Every Line of FILE As Message After Authentication\n");
+    fprintf(stdout,"--output=[text, jsonl] Format of Received Messages, jsonl Is One JSON Object Per Line (Default: text)\n");
+    fprintf(stdout,"--output-file FILE, Writes jsonl Output Into FILE Instead of STDOUT\n");
+    fprintf(stdout,"--input=[text, jsonl, binary] Format of Input, jsonl And binary Records Name Type And Fields (Default: text)\n");
+    fprintf(stdout,"--input-fd N, Reads jsonl Or binary Input From Descriptor N       (Default Value: 0)\n");
+    fprintf(stdout,"--shm-ring NAME, Exchanges Binary Records With Local Process Thru /dev/shm/NAME Instead of STDIN/STDOUT\n");
+    fprintf(stdout,"--listen PATH, Shares The Session With Local Processes Connected To Unix Socket PATH\n");
+    fprintf(stdout,"--daemon, Runs In Background After --listen Socket Is Bound\n");
     fprintf(stdout,"Order of the arguments can be changed\n");
 
     fprintf(stdout,"Example: ./ipk24chat-client -t tcp -s localhost -p 1234\n\n");
@@ -83,29 +110,162 @@ void arguments::processArguments(int argc, char* argv[]) {
 bool arguments::parseArguments(int argc, char* argv[]) {
 for (int i = 1; i < argc; i++) { // Změna typu na int pro kompatibilitu s argc
     std::string flag(argv[i]);
+    std::string value;
 
     if ("-h" == flag) {
         printHelp();
         exit(0);
+    } else if ("--kernel-timestamps" == flag) {
+        kernelTimestamps = true;
+        continue;
+    } else if ("--daemon" == flag) {
+        daemon = true;
+        continue;
+    }
+
+    // Long Options Can Carry The Value After '=' (--socket-profile=latency)
+    size_t separator = flag.find('=');
+    if (0 == flag.rfind("--", 0) && std::string::npos != separator) {
+        value = flag.substr(separator + 1);
+        flag = flag.substr(0, separator);
     } else if (i + 1 < argc) { // Opravená podmínka pro zpracování argumentů
-        if ("-t" == flag) {
-            transferProtocol = argv[++i]; // Přeskočení na hodnotu flagu
-        } else if ("-s" == flag) {
-            hostName = argv[++i];
-        } else if ("-p" == flag) {
-            port = static_cast<uint16_t>(std::stoi(argv[++i]));
-        } else if ("-d" == flag) {
-            confirmTimeOutUDP = static_cast<uint16_t>(std::stoi(argv[++i]));
-        } else if ("-r" == flag) {
-            confirmRetriesUDP = static_cast<uint8_t>(std::stoi(argv[++i]));
-        } else {
-            std::cerr << "Unknown flag: " << flag << std::endl;
-            return false; // Vrátí false, pokud narazí na neznámý flag
-        }
+        value = argv[++i]; // Přeskočení na hodnotu flagu
     } else {
         std::cerr << "Missing value for flag: " << flag << std::endl;
         return false; // Vrátí false, pokud flag nemá hodnotu
     }
+
+    if ("-t" == flag) {
+        transferProtocol = value;
+    } else if ("-s" == flag) {
+        hostName = value;
+    } else if ("-p" == flag) {
+        port = static_cast<uint16_t>(std::stoi(value));
+    } else if ("-d" == flag) {
+        confirmTimeOutUDP = static_cast<uint16_t>(std::stoi(value));
+    } else if ("-r" == flag) {
+        confirmRetriesUDP = static_cast<uint8_t>(std::stoi(value));
+    } else if ("-c" == flag) {
+        connectTimeOut = static_cast<uint32_t>(std::stoul(value));
+    } else if ("--socket-profile" == flag) {
+        socketOptions.profile = value;
+    } else if ("--sndbuf" == flag) {
+        socketOptions.sendBuffer = std::stoi(value);
+    } else if ("--rcvbuf" == flag) {
+        socketOptions.recvBuffer = std::stoi(value);
+    } else if ("--nodelay" == flag) {
+        socketOptions.noDelay = std::stoi(value);
+    } else if ("--quickack" == flag) {
+        socketOptions.quickAck = std::stoi(value);
+    } else if ("--tos" == flag) {
+        socketOptions.tos = std::stoi(value, nullptr, 0);
+    } else if ("--notsent-lowat" == flag) {
+        socketOptions.notSentLowat = std::stoi(value);
+    } else if ("--cork" == flag) {
+        socketOptions.cork = std::stoi(value);
+    } else if ("--capture" == flag) {
+        captureFile = value;
+    } else if ("--trace" == flag) {
+        traceFile = value;
+    } else if ("--replay" == flag) {
+        replayFile = value;
+    } else if ("--replay-speed" == flag) {
+        if ("max" != value && "recorded" != value) {
+            std::cerr << "Unknown replay speed: " << value << std::endl;
+            return false;
+        }
+        replayMaxSpeed = ("max" == value);
+    } else if ("--record-history" == flag) {
+        recordHistoryFile = value;
+    } else if ("--history" == flag) {
+        historyFile = value;
+    } else if ("--history-last" == flag) {
+        historyLast = std::stoull(value);
+    } else if ("--search-memory" == flag) {
+        searchMemory = std::stoull(value);
+    } else if ("--sessions" == flag) {
+        sessionsFile = value;
+    } else if ("--rate" == flag) {
+        sendRate = std::stod(value);
+    } else if ("--burst" == flag) {
+        sendBurst = static_cast<uint32_t>(std::stoul(value));
+    } else if ("--retransmit-budget" == flag) {
+        if ("share" != value && "bypass" != value) {
+            std::cerr << "Unknown retransmit budget: " << value << std::endl;
+            return false;
+        }
+        retransmitsPaced = ("share" == value);
+    } else if ("--reconnect" == flag) {
+        reconnectAttempts = static_cast<uint32_t>(std::stoul(value));
+    } else if ("--reconnect-delay" == flag) {
+        reconnectDelay = static_cast<uint32_t>(std::stoul(value));
+    } else if ("--drain-timeout" == flag) {
+        drainTimeout = static_cast<uint32_t>(std::stoul(value));
+    } else if ("--send-file" == flag) {
+        sendFile = value;
+    } else if ("--output" == flag) {
+        if ("jsonl" != value && "text" != value) {
+            std::cerr << "Unknown output format: " << value << std::endl;
+            return false;
+        }
+        jsonlOutput = ("jsonl" == value);
+    } else if ("--output-file" == flag) {
+        outputFile = value;
+    } else if ("--input" == flag) {
+        if ("text" != value && "jsonl" != value && "binary" != value) {
+            std::cerr << "Unknown input format: " << value << std::endl;
+            return false;
+        }
+        inputFormat = value;
+    } else if ("--input-fd" == flag) {
+        inputFd = std::stoi(value);
+    } else if ("--shm-ring" == flag) {
+        if (value.empty() || std::string::npos != value.find('/')) {
+            std::cerr << "Invalid shared ring name: " << value << std::endl;
+            return false;
+        }
+        shmRing = value;
+    } else if ("--listen" == flag) {
+        listenPath = value;
+    } else {
+        std::cerr << "Unknown flag: " << flag << std::endl;
+        return false; // Vrátí false, pokud narazí na neznámý flag
+    }
+}
+
+if (!outputFile.empty() && !jsonlOutput) {
+    std::cerr << "--output-file Requires --output=jsonl" << std::endl;
+    return false;
+}
+if (0 != inputFd && "text" == inputFormat) {
+    std::cerr << "--input-fd Requires --input=jsonl Or --input=binary" << std::endl;
+    return false;
+}
+if (!shmRing.empty() && ("text" != inputFormat || jsonlOutput)) {
+    std::cerr << "--shm-ring Replaces --input And --output" << std::endl;
+    return false;
+}
+if (!shmRing.empty() && !sessionsFile.empty()) {
+    std::cerr << "--shm-ring Is Not Supported With --sessions" << std::endl;
+    return false;
+}
+if (daemon && listenPath.empty()) {
+    std::cerr << "--daemon Requires --listen" << std::endl;
+    return false;
+}
+if (!listenPath.empty() && ("text" != inputFormat || jsonlOutput || !shmRing.empty() || !sessionsFile.empty())) {
+    std::cerr << "--listen Replaces --input, --output And --shm-ring, Not Supported With --sessions" << std::endl;
+    return false;
+}
+// Individual Socket Options Without Profile Mean Custom Profile
+if (socketOptions.profile.empty() && (OPTION_UNSET != socketOptions.sendBuffer || OPTION_UNSET != socketOptions.recvBuffer ||
+    OPTION_UNSET != socketOptions.noDelay || OPTION_UNSET != socketOptions.quickAck || OPTION_UNSET != socketOptions.tos ||
+    OPTION_UNSET != socketOptions.notSentLowat || OPTION_UNSET != socketOptions.cork)) {
+    socketOptions.profile = "custom";
+}
+if (SUCCESS != resolveSocketProfile(socketOptions)) {
+    std::cerr << "Unknown socket profile: " << socketOptions.profile << std::endl;
+    return false;
 }
 return true; // Všechny argumenty byly zpracovány úspěšně
 }
@@ -113,35 +273,15 @@ return true; // Všechny argumenty byly zpracovány úspěšně
 /**
  * @brief Resolves Host Name
  * 
- * Resolves Host Name To IP Address
+ * Stores IP Address If The Host Name Is Already IP Address. Other Host Names
+ * Are Resolved Asynchronously By Session::connectToServer(), So Slow Resolver
+ * Does Not Block The Start of The Program.
 */
 void arguments::resolveHostName() {
-    struct sockaddr_in sa;
-    if (isIpAddress(hostName)) {
-        // Korektní použití inet_pton
-        int result = inet_pton(AF_INET, hostName.c_str(), &(sa.sin_addr));
-        if(result != 1) {
-            std::cerr << "Invalid IP address format." << std::endl;
-            exit(1);
-        }
-        // ipAddress již není potřeba převádět, hostName je již ve správném formátu
+    if (isIpAddress(hostName)) 
+    {
         ipAddress = hostName;
-        } 
-        else 
-        {
-            // Transfer Host Name To IP Address
-            struct hostent *host;
-            host = gethostbyname(hostName.c_str());
-            if (nullptr == host)
-            {
-                std::cerr << "Host Not Found" << std::endl;
-                exit(1);    
-            }
-            // Convert the First IP Address to String
-            char ipStr[INET_ADDRSTRLEN];
-            inet_ntop(AF_INET, host->h_addr_list[0], ipStr, sizeof(ipStr));
-            ipAddress = ipStr;
-        }
+    }
 }
 
 /**
@@ -153,7 +293,7 @@ void arguments::resolveHostName() {
 */
 bool arguments::isIpAddress(std::string& potentialAddress)
 {
-    struct sockaddr_in sa;
-    return inet_pton(AF_INET, potentialAddress.c_str(), &(sa.sin_addr)) != 0;
+    struct in6_addr sa;
+    return inet_pton(AF_INET, potentialAddress.c_str(), &sa) == 1 || inet_pton(AF_INET6, potentialAddress.c_str(), &sa) == 1;
 }
 
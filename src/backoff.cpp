@@ -0,0 +1,55 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      backoff.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Exponential Backoff With Jitter.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           backoff.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Exponential Backoff With Jitter.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <algorithm>
+#include "../include/backoff.hpp"
+/************************************************/
+/*                  Class                       */
+/************************************************/
+/**
+ * @brief Constructor of Backoff
+ * @param initial Step Before The First Attempt
+ * @param maximum Cap of The Step
+ */
+Backoff::Backoff(std::chrono::milliseconds initial, std::chrono::milliseconds maximum)
+    : initialDelay(std::max(initial, std::chrono::milliseconds(1))), maxDelay(std::max(maximum, initialDelay)),
+      step(initialDelay), generator(std::random_device{}())
+{
+}
+
+/**
+ * @brief Returns Delay Before The Next Attempt And Doubles The Step
+ * @return Delay With Jitter, Between Half And Whole of The Step
+ */
+std::chrono::milliseconds Backoff::next()
+{
+    std::uniform_int_distribution<long long> jitter(step.count() / 2, step.count());
+    std::chrono::milliseconds delay(jitter(generator));
+    step = std::min(step * 2, maxDelay);
+    return delay;
+}
+
+/**
+ * @brief Starts Again From The Initial Step
+ */
+void Backoff::reset()
+{
+    step = initialDelay;
+}
@@ -1,25 +1,27 @@
 /******************************
  *  Project:        IPK Project 1 - Client for Chat Servers
- *  File Name:      tcp_messages.cpp
+ *  File Name:      base_client.cpp
  *  Author:         Tomas Dolak
- *  Date:           21.02.2024
- *  Description:    Implements Serialization & Deserialization of Messages For TCP Protocol.
+ *  Date:           27.03.2024
+ *  Description:    Implements Connection And Input Shared By TCP And UDP Clients.
  *
  * ****************************/
 
 /******************************
  *  @package        IPK Project 1 - Client for Chat Servers
- *  @file           tcp_messages.cpp
+ *  @file           base_client.cpp
  *  @author         Tomas Dolak
- *  @date           21.02.2024
- *  @brief          Implements Serialization & Deserialization of Messages For TCP Protocol.
+ *  @date           27.03.2024
+ *  @brief          Implements Connection And Input Shared By TCP And UDP Clients.
  * ****************************/
 
 /************************************************/
 /*                  Libraries                   */
 /************************************************/
+#include <cerrno>
+#include <chrono>
 #include "../include/base_client.hpp"
-#include "../include/macros.hpp"
+#include "../include/resolver.hpp"
 /************************************************/
 /*                  Constants                   */
 /************************************************/
@@ -31,52 +33,17 @@
 /************************************************/
 /**
  * @brief Constructor of TcpClient Class 
- * @param addr Server's Address 
+ * @param addr Server's Host Name or Address 
  * @param port Server's Port
+ * @param connectTimeOut Deadline For Resolution And Connection In Milliseconds
  *
  * Constructor Initialize Client With Server's Address And Port.
  * Default State of Socket Is Set To NOT_CONNECTED.
  */
-Client::Client(const std::string& addr, int port, uint prot) 
-    : _serverAddress(addr), _port(port), _protocol(prot), sock(NOT_CONNECTED)
+Client::Client(const std::string& addr, int port, uint prot, int connectTimeOut) 
+    : _serverAddress(addr), _port(port), _protocol(prot), _connectTimeOut(connectTimeOut), sock(NOT_CONNECTED)
 {
-
-    if (TCP == _protocol)
-    {
-        sock = socket(AF_INET, SOCK_STREAM, 0);
-    }
-    else if (UDP == _protocol)
-    {
-        sock = socket(AF_INET, SOCK_DGRAM, 0);
-    }
-
-    if (NOT_CONNECTED == sock)
-    {
-        fprintf(stderr,"ERR: Not Possible To Create Socket\n");
-        exit(FAIL);
-    }
-
-    // Set Server's Address Information
     memset(&server, 0, sizeof(server));
-    server.sin_family = AF_INET;
-    server.sin_port = htons(this->_port);
-
-    if (inet_pton(AF_INET, _serverAddress.c_str(), &server.sin_addr) <= 0)
-    {
-        fprintf(stderr,"ERR: Invalid address/ Address not supported\n");
-        exit(FAIL);
-    }
-
-    if (TCP == _protocol)
-    {
-        if (connect(sock, (struct sockaddr *)&server, sizeof(server)) < 0)
-        {
-            fprintf(stderr,"ERR: Socket Creation Failed\n");
-            exit(FAIL);
-        }            
-    }
-
-    // Connection Was Successful
 }
 /**
  * @brief Destructor of TcpClient Class 
@@ -86,6 +53,13 @@ Client::Client(const std::string& addr, int port, uint prot)
  */
 Client::~Client()
 {
+    for (const Candidate_t& candidate : candidates)
+    {
+        if (candidate.sock != sock)
+        {
+            close(candidate.sock);
+        }
+    }
     if (sock != NOT_CONNECTED)
     {
         close(sock);
@@ -105,13 +79,165 @@ bool Client::isConnected() {
 }
 
 // Return server's struct 
-const struct sockaddr_in& Client::getServerAddr() const 
+const struct sockaddr_storage& Client::getServerAddr() const 
 {
     return server;
 }
+
+/**
+ * @brief Starts Resolution of Server's Host Name On Resolver Thread
+ * @param resolver Resolver Whose Descriptor Is Awaited By The Session
+ *
+ * @return SUCCESS If The Resolver Thread Was Started, Otherwise CONNECT_FAILED
+ */
+int Client::startResolution(Resolver& resolver)
+{
+    if (SUCCESS != resolver.start(_serverAddress, _port, AF_UNSPEC, (TCP == _protocol) ? SOCK_STREAM : SOCK_DGRAM))
+    {
+        fprintf(stderr,"ERR: Not Possible To Start Resolver\n");
+        return CONNECT_FAILED;
+    }
+    return SUCCESS;
+}
+
+/**
+ * @brief Collects Resolved Addresses Ordered For Racing
+ * @param resolver Resolver Whose Descriptor Became Readable
+ * @param addresses Destination of The Addresses
+ *
+ * Address Families Are Interleaved As Described In RFC 8305.
+ * @return SUCCESS If At Least One Address Was Resolved, Otherwise CONNECT_FAILED
+ */
+int Client::collectAddresses(Resolver& resolver, std::vector<Resolver::Address_t>& addresses)
+{
+    if (SUCCESS != resolver.collect(addresses))
+    {
+        fprintf(stderr,"ERR: %s: %s\n", _serverAddress.c_str(), resolver.getError());
+        return CONNECT_FAILED;
+    }
+    Resolver::orderAddresses(addresses);
+    return SUCCESS;
+}
+
+/**
+ * @brief Starts Non-Blocking TCP Connect To One Address
+ * @param address Server's Address
+ * @param established Set If The Connection Was Established At Once
+ *
+ * @return Connecting Socket, NOT_CONNECTED If The Attempt Failed At Once (errno Is Kept)
+ */
+int Client::startAttempt(const Resolver::Address_t& address, bool& established)
+{
+    established = false;
+    int attemptSock = socket(address.addr.ss_family, SOCK_STREAM | SOCK_NONBLOCK, 0);
+    if (NOT_CONNECTED == attemptSock)
+    {
+        return NOT_CONNECTED;
+    }
+    applySocketOptions(attemptSock, address.addr.ss_family, true, socketOptions);
+    if (0 == connect(attemptSock, (struct sockaddr *)&address.addr, address.len))
+    {
+        established = true;
+        return attemptSock;
+    }
+    if (EINPROGRESS != errno)
+    {
+        int lastError = errno;
+        close(attemptSock);
+        errno = lastError;
+        return NOT_CONNECTED;
+    }
+    return attemptSock;
+}
+
 /**
- * @brief Connects The Client To The Server
- * @return True If The Connection Was Successful, False Otherwise
+ * @brief Returns Result of Connect Attempt Whose Socket Became Writable
+ * @param attemptSock Connecting Socket
+ *
+ * @return 0 If Connected, Otherwise errno of The Attempt
  */
+int Client::attemptError(int attemptSock)
+{
+    int sockError = 0;
+    socklen_t errLen = sizeof(sockError);
+    if (FAIL == getsockopt(attemptSock, SOL_SOCKET, SO_ERROR, &sockError, &errLen))
+    {
+        return errno;
+    }
+    return sockError;
+}
 
+/**
+ * @brief Keeps Connected Socket As sock
+ * @param attemptSock Socket Which Won The Race
+ * @param address Its Server's Address
+ */
+void Client::adoptConnection(int attemptSock, const Resolver::Address_t& address)
+{
+    // Socket Stays Non-Blocking, TcpSession Waits For Writability of Bytes Kernel Did Not Take
+    sock = attemptSock;
+    memcpy(&server, &address.addr, sizeof(server));
+}
 
+/**
+ * @brief Creates Socket For Every UDP Address, The First One Becomes sock
+ * @param addresses Ordered Server's Addresses
+ *
+ * UDP Has No Handshake, Every Address Gets Its Socket And The First One
+ * Answering AUTH Wins.
+ * @return SUCCESS If At Least One Socket Was Created, Otherwise CONNECT_FAILED
+ */
+int Client::prepareCandidates(const std::vector<Resolver::Address_t>& addresses)
+{
+    for (const Resolver::Address_t& address : addresses)
+    {
+        int candidateSock = socket(address.addr.ss_family, SOCK_DGRAM, 0);
+        if (NOT_CONNECTED != candidateSock)
+        {
+            applySocketOptions(candidateSock, address.addr.ss_family, false, socketOptions);
+            candidates.push_back({candidateSock, address, false});
+        }
+    }
+    if (candidates.empty())
+    {
+        fprintf(stderr,"ERR: Not Possible To Create Socket\n");
+        return CONNECT_FAILED;
+    }
+    sock = candidates.front().sock;
+    memcpy(&server, &candidates.front().address.addr, sizeof(server));
+    return SUCCESS;
+}
+
+/**
+ * @brief Closes The Socket, The Session May Connect Again
+ */
+void Client::disconnect()
+{
+    if (sock != NOT_CONNECTED)
+    {
+        close(sock);
+        sock = NOT_CONNECTED;
+    }
+}
+
+void Client::setSocketOptions(const SocketOptions_t& options)
+{
+    socketOptions = options;
+}
+
+/**
+ * @brief Sets Pacing of Outgoing Messages
+ * @param rate Messages Per Second, 0 Disables Pacing
+ * @param burst Messages Which May Leave Back To Back
+ * @param pacedRetransmits Retransmissions Take Tokens Too
+ */
+void Client::setPacing(double rate, uint32_t burst, bool pacedRetransmits)
+{
+    pacing.configure(rate, burst);
+    retransmitsPaced = pacedRetransmits;
+}
+
+int Client::sendFile(const std::string& path)
+{
+    return fileSender.open(path);
+}
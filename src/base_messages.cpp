@@ -24,11 +24,18 @@
 #include <vector>
 #include <cstdint>
 #include <algorithm>
+#include <chrono>
 #include <cctype> // For isdigit and isalpha
 #include <iostream>
 #include <regex>
 #include <sys/socket.h>
 #include "../include/base_messages.hpp"
+#include "../include/renderer.hpp"
+#include "../include/history.hpp"
+#include "../include/search_index.hpp"
+#include "../include/trace.hpp"
+#include "../include/probe.hpp"
+#include "../include/protocol_schema.hpp"
 
 //#include "strings.cpp"
 /************************************************/
@@ -38,6 +45,13 @@
 BaseMessages::BaseMessages() : msgType(UNKNOWN_MSG_TYPE) {
     // Initialize Attributes
 }
+
+/**
+ * @brief Constructor of Message Allocated From Memory Resource
+ * @param resource Arena or Pool For All Fields of The Message
+ */
+BaseMessages::BaseMessages(std::pmr::memory_resource* resource) : msgType(UNKNOWN_MSG_TYPE), msg(Message_t::allocator_type(resource)) {}
+
 /**
  * @brief Constructor of TcpMessages Class 
  * @param type Type of The Message
@@ -73,7 +87,7 @@ void BaseMessages::cleanMessage()
 /**
  * @brief Check If The Message Components Are Valid (ID, Display Name, Content, Secret Length)
  * 
- * 
+ * Bounded Fields Are Too Long If They Overflowed While Being Filled.
  * @return SUCCESS If The Message Is Valid, Otherwise Returns NON_VALID_PARAM
  */
 int BaseMessages::checkLength()
@@ -81,7 +95,7 @@ int BaseMessages::checkLength()
     if (msg.type == COMMAND_AUTH)
     {
         // Check Username
-        if (msg.login.size() > LENGHT_USERNAME || (!areAllDigitsOrLettersOrDash(msg.login)))
+        if (msg.login.overflowed() || (!areAllDigitsOrLettersOrDash(msg.login)))
         {
             return NON_VALID_PARAM;
         }
@@ -89,7 +103,7 @@ int BaseMessages::checkLength()
     if (msg.type == COMMAND_JOIN)
     {
         // Check Channel ID
-        if (msg.channelID.size() > LENGHT_CHANNEL_ID || (!areAllDigitsOrLettersOrDashOrDot(msg.channelID)))
+        if (msg.channelID.overflowed() || (!areAllDigitsOrLettersOrDashOrDot(msg.channelID)))
         {
             return NON_VALID_PARAM;
         }
@@ -97,7 +111,7 @@ int BaseMessages::checkLength()
     if (msg.type == COMMAND_AUTH)
     {
         // Check Secret
-        if (msg.secret.size() > LENGHT_SECRET || (!areAllDigitsOrLettersOrDash(msg.secret)))
+        if (msg.secret.overflowed() || (!areAllDigitsOrLettersOrDash(msg.secret)))
         {
             return NON_VALID_PARAM;
         }
@@ -105,7 +119,7 @@ int BaseMessages::checkLength()
     if (msg.type == MSG || msg.type == COMMAND_AUTH || msg.type == COMMAND_JOIN || msg.type == ERROR || msg.type == COMMAND_RENAME)
     {
         // Check Display Name
-        if (msg.displayName.size() > LENGHT_DISPLAY_NAME || (!areAllPrintableCharacters(msg.displayName)))
+        if (msg.displayName.overflowed() || (!areAllPrintableCharacters(msg.displayName)))
         {
             return NON_VALID_PARAM;
         }
@@ -113,7 +127,7 @@ int BaseMessages::checkLength()
     if (!msg.displayNameOutside.empty() || msg.type == REPLY || msg.type == MSG || msg.type == ERROR)
     {
         // Check Display Name From Outside (Another Client)
-        if (msg.displayNameOutside.size() > LENGHT_DISPLAY_NAME || (!areAllPrintableCharacters(msg.displayNameOutside)))
+        if (msg.displayNameOutside.overflowed() || (!areAllPrintableCharacters(msg.displayNameOutside)))
         {
             return NON_VALID_PARAM;
         }
@@ -142,6 +156,7 @@ void BaseMessages::readAndStoreContent(const char* buffer)
 {
     // Clear The Message Content
     msg.buffer.clear();
+    msg.structured = false;
 
     // Find The Lenght Of Buffer
     size_t len = strlen(buffer);
@@ -160,14 +175,8 @@ void BaseMessages::readAndStoreContent(const char* buffer)
 
 void BaseMessages::readAndStoreBytes(const char* buffer, size_t bytesRx)
 {
-    // Clear The Message Content
-    msg.buffer.clear();
-    for (size_t i = 0; i < bytesRx; i++)
-    {
-        
-        msg.buffer.push_back(buffer[i]);
-
-    }
+    msg.buffer.assign(buffer, buffer + bytesRx);
+    msg.structured = false;
 }
 
 /**
@@ -178,6 +187,23 @@ void BaseMessages::readAndStoreBytes(const char* buffer, size_t bytesRx)
  */
 int BaseMessages::checkMessage()
 {
+    Trace::Scope checking("checkMessage");
+    PROBE(CHECK);
+    // Structured Input Already Named Type And Fields, Only Their Values Are Checked
+    if (msg.structured)
+    {
+        if (COMMAND_RENAME == msg.type)
+        {
+            DisplayName renamed;
+            renamed.assign(msg.content.begin(), msg.content.end());
+            if (renamed.overflowed())
+            {
+                return NON_VALID_PARAM;
+            }
+            msg.displayName = renamed;
+        }
+        return checkLength();
+    }
     size_t idx = 0;
     int retVal = FAIL;
     InputType_t inputType = INPUT_UNKNOWN;
@@ -208,6 +234,18 @@ int BaseMessages::checkMessage()
         msg.buffer.erase(msg.buffer.begin(), msg.buffer.begin() + 6);
         inputType = INPUT_HELP;
     }
+    else if (msg.buffer.size() >= 8 && compare(msg.buffer,"^/search "))
+    {
+        // delete first 7 characters + 1 space
+        msg.buffer.erase(msg.buffer.begin(), msg.buffer.begin() + 8);
+        inputType = INPUT_SEARCH;
+    }
+    else if (msg.buffer.size() >= 10 && compare(msg.buffer,"^/sendfile "))
+    {
+        // delete first 9 characters + 1 space
+        msg.buffer.erase(msg.buffer.begin(), msg.buffer.begin() + 10);
+        inputType = INPUT_SENDFILE;
+    }
     else 
     {
         inputType = INPUT_MSG;
@@ -273,21 +311,48 @@ int BaseMessages::checkMessage()
     {
         msg.type = COMMAND_HELP;
     }
-    else if (inputType == INPUT_RENAME)
+    else if (inputType == INPUT_SEARCH)
     {
+        // Query Is Kept In Content, It Is Never Sent To The Server
+        msg.content.clear();
         idx = 0;
-        msg.type = COMMAND_RENAME;
-        // Process New Display Name
-        if (msg.buffer.size() > LENGHT_DISPLAY_NAME)
+        while (idx < msg.buffer.size() && msg.buffer[idx] != '\n' && msg.buffer[idx] != '\r')
         {
-            return NON_VALID_PARAM;
+            msg.content.push_back(msg.buffer[idx]);
+            idx++;
         }
-        msg.displayName.clear();
+        msg.type = COMMAND_SEARCH;
+        return SUCCESS;
+    }
+    else if (inputType == INPUT_SENDFILE)
+    {
+        // Path Is Kept In Content, Lines of The File Are Sent Instead
+        msg.content.clear();
+        idx = 0;
+        while (idx < msg.buffer.size() && msg.buffer[idx] != '\n' && msg.buffer[idx] != '\r')
+        {
+            msg.content.push_back(msg.buffer[idx]);
+            idx++;
+        }
+        msg.type = COMMAND_SENDFILE;
+        return msg.content.empty() ? NON_VALID_PARAM : SUCCESS;
+    }
+    else if (inputType == INPUT_RENAME)
+    {
+        idx = 0;
+        msg.type = COMMAND_RENAME;
+        // Process New Display Name, Too Long Name Keeps The Old One
+        DisplayName renamed;
         while (idx < msg.buffer.size() && msg.buffer[idx] != '\n' && msg.buffer[idx] != '\r')  // '\n' should not be in content
         {
-            msg.displayName.push_back(msg.buffer[idx]);   
+            renamed.push_back(msg.buffer[idx]);   
             idx++;
         }
+        if (renamed.overflowed())
+        {
+            return NON_VALID_PARAM;
+        }
+        msg.displayName = renamed;
     }
     else 
     {
@@ -309,80 +374,32 @@ int BaseMessages::checkMessage()
 /**
  * @brief Parse Messages From Incoming Packet
  * 
- * 
- * @return None, Exits If Something Goes Wrong
+ * Line Is Decoded By Text Decoder Generated From Protocol Schema, Only MSG
+ * And BYE Are Accepted Here.
+ * @return SUCCESS, NON_VALID_PARAM For Too Long Fields, MSG_PARSE_FAILED For Other Lines
 */
 int BaseMessages::parseMessage()
 {
-    int retVal = 0;
-    size_t idx = 0;
-    std::regex msgIsRegex("^IS");
+    WireHeader_t header;
 
     // Prepaire Attributes
     msg.content.clear();
     msg.displayNameOutside.clear();
 
-    // Check if Content Is a Message 
-    if (compare(msg.buffer,"^MSG FROM")) 
+    MessageType_t type = TextCodec::decode(msg.buffer, msg, header);
+    if (MSG == type) 
     {
-        size_t prefixLength = std::string("MSG FROM ").length();
-        msg.buffer.erase(msg.buffer.begin(), msg.buffer.begin() + prefixLength); 
-        
-        idx = 0;
-        // Loop until the substring starting at the current idx does not start with "IN"
-        // and ensure we're not at the last character
-        while (idx < msg.buffer.size() - 1)
-        {
-            // Convert current substring to string for regex search
-            std::string currentSubStr(msg.buffer.begin() + idx, msg.buffer.end());
-            if (std::regex_search(currentSubStr, msgIsRegex)) {
-                break; // Exit the loop if "IN" is found at the beginning of the current substring
-            }
-            msg.displayNameOutside.push_back(msg.buffer[idx]);
-            idx++;
-        
-        }
-
-        // Check and Remove the Last Character if Needed (It's a Space)
-        if (!msg.displayNameOutside.empty()) 
-        {
-            msg.displayNameOutside.pop_back();
-        }
-        /* Process The Content */
-        int isPlusSpace = 3;                                                    // 1. Get Rid of "IS "
-        msg.buffer.erase(msg.buffer.begin(), msg.buffer.begin() + idx + isPlusSpace);
-
-        // Store The Content From Buffer
-        idx = 0;
-        while (idx < msg.buffer.size()) 
-        {   
-            if (msg.buffer[idx] == '\n' || msg.buffer[idx] == '\r')
-                break;
-            msg.content.push_back(msg.buffer[idx]);
-            idx++;
-        }
         // Check The Message And User Name Length
-        retVal = checkLength();
-        msg.type = MSG;
-        return retVal;
+        return checkLength();
     }
-    else if (compare(msg.buffer, "^BYE\r\n"))
+    else if (COMMAND_BYE == type)
     {
-        idx = 0;
-        while (idx < msg.buffer.size()) 
-        {   
-            if (msg.buffer[idx] == '\n' || msg.buffer[idx] == '\r')
-                break;
-            msg.content.push_back(msg.buffer[idx]);
-            idx++;
-        }
-        msg.type = COMMAND_BYE;
         return SUCCESS;
     }
     return MSG_PARSE_FAILED;
 }
 
-void BaseMessages::printMessage()
+void BaseMessages::printMessage(int32_t messageID)
 {
     std::string content(msg.content.begin(), msg.content.end());
     std::string displayNameOutside(msg.displayNameOutside.begin(), msg.displayNameOutside.end());
@@ -390,29 +407,30 @@ void BaseMessages::printMessage()
     {
         if (!displayNameOutside.empty() && !content.empty())
         {
-            fprintf(stdout,"%s: %s\n", displayNameOutside.c_str(), content.c_str());
+            Renderer::publish(Renderer::CHAT_MESSAGE, displayNameOutside, content, messageID);
+            SearchIndex::add(displayNameOutside, content);
         }
 
     }
 }
 
-void BaseMessages::PrintServerOkReply()
+void BaseMessages::PrintServerOkReply(int32_t messageID)
 {
     std::string serverSay(msg.content.begin(),msg.content.end());
-    fprintf(stdout,"Success: %s\n",serverSay.c_str());
+    Renderer::publish(Renderer::REPLY_OK, "", serverSay, messageID);
 }
 
-void BaseMessages::PrintServerNokReply()
+void BaseMessages::PrintServerNokReply(int32_t messageID)
 {
     std::string serverSay(msg.content.begin(),msg.content.end());
-    fprintf(stdout,"Failure: %s\n",serverSay.c_str());
+    Renderer::publish(Renderer::REPLY_NOK, "", serverSay, messageID);
 }
 
-void BaseMessages::basePrintExternalError()
+void BaseMessages::basePrintExternalError(int32_t messageID)
 {
     std::string errDisplayName(msg.displayNameOutside.begin(),msg.displayNameOutside.end());
     std::string errContent(msg.content.begin(),msg.content.end());
-    fprintf(stderr,"ERR FROM %s: %s\n",errDisplayName.c_str(),errContent.c_str());
+    Renderer::publish(Renderer::SERVER_ERROR, errDisplayName, errContent, messageID);
 }
 
 void BaseMessages::basePrintInternalError(int retVal)
@@ -422,6 +440,43 @@ void BaseMessages::basePrintInternalError(int retVal)
     fprintf(stderr,"ERR: %s (Return Value: %d)\n",errContent.c_str(),retVal);
 }
 
+/**
+ * @brief Appends Sent Message To History
+ * @param type Type of The Sent Message
+ * @param content Content of MSG or ERR, Secret of AUTH Is Never Stored
+ */
+void BaseMessages::recordSent(MessageType_t type, const std::string& content)
+{
+    if (!History::isOpen())
+    {
+        return;
+    }
+    std::string channel = (COMMAND_JOIN == type) ? std::string(msg.channelID.begin(), msg.channelID.end()) : "";
+    History::append(History::SENT, type, 0, std::string(msg.displayName.begin(), msg.displayName.end()), channel, content);
+}
+
+/**
+ * @brief Prints Received Messages Matching Query Stored In Content
+ *
+ * Matches Go To STDOUT Thru Rendering Thread Like Received Messages, Duration
+ * And Size of The Index Are Reported On STDERR After Them.
+ */
+void BaseMessages::printSearch()
+{
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<SearchIndex::Match_t> matches = SearchIndex::search(std::string(msg.content.begin(), msg.content.end()), SEARCH_MAX_RESULTS);
+    auto micros = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count();
+
+    for (const SearchIndex::Match_t& match : matches)
+    {
+        Renderer::publishLocal(Renderer::SEARCH_MATCH, match.document, match.sender, match.content);
+    }
+    char summary[128];
+    snprintf(summary, sizeof(summary), "INFO: Search Found %zu Matches In %lld us (%zu Messages, %zu KiB Indexed)",
+             matches.size(), static_cast<long long>(micros), SearchIndex::documents(), SearchIndex::memoryUsed() / 1024);
+    Renderer::publishLocal(Renderer::SEARCH_SUMMARY, 0, "", summary);
+}
+
 void BaseMessages::printHelp()
 {
     fprintf(stdout,"Commands:\n");
@@ -430,11 +485,15 @@ void BaseMessages::printHelp()
     fprintf(stdout,"JOIN CMD:            /join [channel]\n");
     fprintf(stdout,"RENAME CMD:          /rename [displayname]\n");
     fprintf(stdout,"HELP CMD:            /help\n");
+    fprintf(stdout,"SEARCH CMD:          /search [term]...\n");
+    fprintf(stdout,"SEND FILE CMD:       /sendfile [path]\n");
     fprintf(stdout,"----------------------------------------------\n");
     fprintf(stdout,"[username]: User's Username To Get In To Chat\n");
     fprintf(stdout,"[password]: User's Password To Get In To Chat\n");
     fprintf(stdout,"[displayName]: User's DisplayName Optional\n");
     fprintf(stdout,"[channel]: Channel To Join\n");
+    fprintf(stdout,"[term]: Word Searched In Received Messages, More Terms Must All Match\n");
+    fprintf(stdout,"[path]: File Whose Every Line Is Sent As One Message\n");
     fprintf(stdout,"To Exit The Program Correctly, Type CTRL + C\n");
     fprintf(stdout,"----------------------------------------------\n");
 }
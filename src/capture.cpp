@@ -0,0 +1,162 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      capture.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Wire Capture Into pcapng.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           capture.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Wire Capture Into pcapng.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include "../include/capture.hpp"
+#include "../include/macros.hpp"
+/************************************************/
+/*                  Helpers                     */
+/************************************************/
+/**
+ * @brief Rounds Length Up To pcapng 32-bit Alignment
+ */
+static size_t padded(size_t length)
+{
+    return (length + 3) & ~static_cast<size_t>(3);
+}
+
+static uint8_t* put32(uint8_t* out, uint32_t value)
+{
+    memcpy(out, &value, sizeof(value));
+    return out + sizeof(value);
+}
+
+static uint8_t* put16(uint8_t* out, uint16_t value)
+{
+    memcpy(out, &value, sizeof(value));
+    return out + sizeof(value);
+}
+
+/************************************************/
+/*                  Class                       */
+/************************************************/
+MappedFile Capture::file;
+
+/**
+ * @brief Creates Capture File And Writes Section And Interface Blocks
+ * @param path Path of The Capture File
+ * @param protocol Transport Protocol ("tcp" or "udp") Stored As Interface Name
+ *
+ * File Is Closed By atexit(), Because Client Leaves Thru exit() On Many Places.
+ * @return SUCCESS If The File Is Ready, Otherwise FAIL
+ */
+int Capture::open(const std::string& path, const std::string& protocol)
+{
+    if (SUCCESS != file.open(path, MappedFile::TRUNCATE))
+    {
+        fprintf(stderr,"ERR: Capture File %s Could Not Be Created\n", path.c_str());
+        return FAIL;
+    }
+
+    const size_t shbLength = 28;
+    uint8_t* out = file.reserve(shbLength);
+    if (nullptr == out)
+    {
+        fprintf(stderr,"ERR: Capture File Could Not Be Mapped\n");
+        return FAIL;
+    }
+    out = put32(out, PCAPNG_SHB);
+    out = put32(out, shbLength);
+    out = put32(out, PCAPNG_BYTE_ORDER);
+    out = put16(out, 1);                                // Major Version
+    out = put16(out, 0);                                // Minor Version
+    out = put32(out, 0xFFFFFFFF);                       // Section Length Not Specified
+    out = put32(out, 0xFFFFFFFF);
+    put32(out, shbLength);
+    file.setLength(file.length() + shbLength);
+
+    const size_t nameLength = padded(protocol.size());
+    const size_t idbLength = 20 + 4 + nameLength + 4;
+    out = file.reserve(idbLength);
+    if (nullptr == out)
+    {
+        fprintf(stderr,"ERR: Capture File Could Not Be Mapped\n");
+        return FAIL;
+    }
+    memset(out, 0, idbLength);
+    out = put32(out, PCAPNG_IDB);
+    out = put32(out, idbLength);
+    out = put16(out, PCAPNG_LINKTYPE_USER0);
+    out = put16(out, 0);                                // Reserved
+    out = put32(out, 0);                                // No Snap Length
+    out = put16(out, PCAPNG_OPT_IF_NAME);
+    out = put16(out, protocol.size());
+    memcpy(out, protocol.data(), protocol.size());
+    out += nameLength;
+    out = put16(out, PCAPNG_OPT_END);
+    out = put16(out, 0);
+    put32(out, idbLength);
+    file.setLength(file.length() + idbLength);
+
+    atexit(Capture::close);
+    return SUCCESS;
+}
+
+/**
+ * @brief Appends Packet Block, Does Nothing If Capture Is Not Open
+ * @param direction Direction of The Packet
+ * @param data Payload
+ * @param length Length of The Payload
+ */
+void Capture::record(Direction_t direction, const void* data, size_t length)
+{
+    if (!file.isOpen())
+    {
+        return;
+    }
+    uint64_t timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch()).count();
+
+    const size_t dataLength = padded(length);
+    const size_t epbLength = 28 + dataLength + 8 + 4 + 4;
+    uint8_t* out = file.reserve(epbLength);
+    if (nullptr == out)
+    {
+        return;
+    }
+    out = put32(out, PCAPNG_EPB);
+    out = put32(out, epbLength);
+    out = put32(out, 0);                                // Interface ID
+    out = put32(out, static_cast<uint32_t>(timestamp >> 32));
+    out = put32(out, static_cast<uint32_t>(timestamp));
+    out = put32(out, length);                           // Captured Length
+    out = put32(out, length);                           // Original Length
+    memcpy(out, data, length);
+    memset(out + length, 0, dataLength - length);
+    out += dataLength;
+    out = put16(out, PCAPNG_OPT_EPB_FLAGS);
+    out = put16(out, sizeof(uint32_t));
+    out = put32(out, direction);
+    out = put16(out, PCAPNG_OPT_END);
+    out = put16(out, 0);
+    put32(out, epbLength);
+    file.setLength(file.length() + epbLength);
+}
+
+/**
+ * @brief Unmaps Buffer And Truncates File To Written Length
+ */
+void Capture::close()
+{
+    file.close();
+}
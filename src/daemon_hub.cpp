@@ -0,0 +1,432 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      daemon_hub.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Unix Socket Hub Sharing One Session With Local Processes.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           daemon_hub.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Unix Socket Hub Sharing One Session With Local Processes.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <csignal>
+#include <cstring>
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/uio.h>
+#include <sys/eventfd.h>
+#include "../include/daemon_hub.hpp"
+/************************************************/
+/*                  Helpers                     */
+/************************************************/
+static constexpr int MAX_GATHER = 64;           //!< Frames Sent By One sendmsg()
+
+/**
+ * @brief Moves Process Into Background, Parent Leaves Without atexit() Handlers
+ *
+ * Standard Streams Are Redirected To /dev/null, Working Directory Is Kept
+ * So Relative Paths of Other Options Still Work.
+ * @return SUCCESS In The Background Process, FAIL If fork() Failed
+ */
+static int detachProcess()
+{
+    pid_t child = fork();
+    if (-1 == child)
+    {
+        return FAIL;
+    }
+    if (0 != child)
+    {
+        _exit(SUCCESS);
+    }
+    setsid();
+    int devNull = open("/dev/null", O_RDWR);
+    if (-1 != devNull)
+    {
+        dup2(devNull, STDIN_FILENO);
+        dup2(devNull, STDOUT_FILENO);
+        dup2(devNull, STDERR_FILENO);
+        if (STDERR_FILENO < devNull)
+            close(devNull);
+    }
+    return SUCCESS;
+}
+/************************************************/
+/*                  Class                       */
+/************************************************/
+std::string DaemonHub::socketPath;
+int DaemonHub::listenFd = -1;
+int DaemonHub::inputPair[2] = {-1, -1};
+int DaemonHub::wakeFd = -1;
+SpscQueue<DaemonHub::Frame_t*, DaemonHub::QUEUE_CAPACITY> DaemonHub::queue;
+std::vector<DaemonHub::Local_t> DaemonHub::locals;
+std::thread DaemonHub::worker;
+std::atomic<bool> DaemonHub::stopping{false};
+std::atomic<uint32_t> DaemonHub::dropped{0};
+
+/**
+ * @brief Binds Listening Socket, Detaches If Asked, Starts Hub Thread
+ * @param path Path of Unix Socket, Stale Socket Is Replaced
+ * @param detach Continue In Background Process Without Terminal
+ *
+ * Called Before Any Other Thread Exists, So fork() Keeps Everything. Closed
+ * By atexit(), Because Client Leaves Thru exit() On Many Places.
+ * @return SUCCESS If Local Processes Can Connect, Otherwise FAIL
+ */
+int DaemonHub::open(const std::string& path, bool detach)
+{
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path))
+    {
+        fprintf(stderr,"ERR: Socket Path %s Is Too Long\n", path.c_str());
+        return FAIL;
+    }
+    memcpy(address.sun_path, path.c_str(), path.size());
+
+    listenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    unlink(path.c_str());
+    if (-1 == listenFd || 0 != bind(listenFd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)) ||
+        0 != listen(listenFd, SOMAXCONN) || 0 != socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, inputPair))
+    {
+        fprintf(stderr,"ERR: Not Possible To Listen On %s\n", path.c_str());
+        if (-1 != listenFd)
+            ::close(listenFd);
+        listenFd = -1;
+        return FAIL;
+    }
+    socketPath = path;
+    wakeFd = eventfd(0, EFD_CLOEXEC);
+    fprintf(stderr,"INFO: Listening On %s\n", path.c_str());
+
+    if (detach && SUCCESS != detachProcess())
+    {
+        fprintf(stderr,"ERR: Not Possible To Detach\n");
+        return FAIL;
+    }
+
+    stopping = false;
+    sigset_t all, previous;
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &previous);           // Signals Go To Main Thread
+    worker = std::thread(run);
+    pthread_sigmask(SIG_SETMASK, &previous, nullptr);
+    atexit(DaemonHub::close);
+    return SUCCESS;
+}
+
+void DaemonHub::close()
+{
+    if (-1 == listenFd)
+    {
+        return;
+    }
+    stopping = true;
+    uint64_t one = 1;
+    ssize_t bytesTx = write(wakeFd, &one, sizeof(one));
+    (void)bytesTx;
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+    for (Local_t& local : locals)
+    {
+        closeLocal(local);
+    }
+    locals.clear();
+    Frame_t* frame = nullptr;
+    while (queue.pop(frame))
+    {
+        delete frame;
+    }
+    ::close(listenFd);
+    listenFd = -1;
+    unlink(socketPath.c_str());
+    ::close(inputPair[0]);
+    ::close(inputPair[1]);
+    ::close(wakeFd);
+    inputPair[0] = inputPair[1] = wakeFd = -1;
+}
+
+DaemonHub::Frame_t* DaemonHub::newFrame(size_t length)
+{
+    Frame_t* frame = new Frame_t;
+    frame->refs = 0;
+    frame->length = static_cast<uint16_t>(2 + length);
+    frame->bytes[0] = static_cast<uint8_t>(length >> 8);
+    frame->bytes[1] = static_cast<uint8_t>(length & 0xFF);
+    return frame;
+}
+
+/**
+ * @brief Hands Frame Over To Hub Thread, Network Loop Only
+ * @param frame Frame Filled Thru body()
+ *
+ * Full Queue Drops The Frame, The Count Is Reported By Hub Thread.
+ */
+void DaemonHub::publish(Frame_t* frame)
+{
+    if (!queue.push(frame))
+    {
+        delete frame;
+        dropped++;
+        return;
+    }
+    uint64_t one = 1;
+    ssize_t bytesTx = write(wakeFd, &one, sizeof(one));
+    (void)bytesTx;
+}
+
+/**
+ * @brief Body of Hub Thread
+ *
+ * Polls Listening Socket, eventfd And Every Local Process, Which Is Also
+ * Polled For Writing While It Has Pending Frames. Leaves On close().
+ */
+void DaemonHub::run()
+{
+    std::vector<struct pollfd> pfds;
+    while (!stopping)
+    {
+        pfds.clear();
+        pfds.push_back({listenFd, POLLIN, 0});
+        pfds.push_back({wakeFd, POLLIN, 0});
+        for (const Local_t& local : locals)
+        {
+            short events = POLLIN | (local.pending.empty() ? 0 : POLLOUT);
+            pfds.push_back({local.fd, events, 0});
+        }
+        if (-1 == poll(pfds.data(), pfds.size(), -1))
+        {
+            if (EINTR == errno)
+                continue;
+            fprintf(stderr,"ERR: poll() Failed In Hub Thread\n");
+            return;
+        }
+
+        if (pfds[1].revents & POLLIN)
+        {
+            uint64_t pending = 0;
+            ssize_t bytesRx = read(wakeFd, &pending, sizeof(pending));
+            (void)bytesRx;
+            fanOut();
+        }
+        // Backwards, So Removing Local Process Keeps Indexes of The Rest
+        for (size_t idx = pfds.size() - 2; idx-- > 0;)
+        {
+            short revents = pfds[idx + 2].revents;
+            bool alive = true;
+            if (revents & (POLLIN | POLLHUP | POLLERR))
+                alive = readLocal(locals[idx]);
+            if (alive && (revents & POLLOUT))
+                alive = writeLocal(locals[idx]);
+            if (!alive)
+            {
+                closeLocal(locals[idx]);
+                locals.erase(locals.begin() + idx);
+            }
+        }
+        if (pfds[0].revents & POLLIN)
+        {
+            acceptLocal();
+        }
+    }
+}
+
+void DaemonHub::acceptLocal()
+{
+    int fd = accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    if (-1 == fd)
+    {
+        return;
+    }
+    if (MAX_LOCAL_CLIENTS <= locals.size())
+    {
+        fprintf(stderr,"ERR: Local Client Refused, %zu Already Connected\n", locals.size());
+        ::close(fd);
+        return;
+    }
+    Local_t local;
+    local.fd = fd;
+    locals.push_back(std::move(local));
+}
+
+/**
+ * @brief Reads Frames of Local Process
+ * @param local The Process
+ *
+ * Records Are Forwarded Whole Into Client's Input, Which Decodes And Reports
+ * Them Like --input=binary. Frame Longer Than LOCAL_BUFFER Breaks The Protocol.
+ * @return False If The Process Left Or Broke The Protocol
+ */
+bool DaemonHub::readLocal(Local_t& local)
+{
+    char buffer[LOCAL_BUFFER];
+    ssize_t bytesRx = recv(local.fd, buffer, sizeof(buffer), 0);
+    if (0 > bytesRx && (EAGAIN == errno || EINTR == errno))
+    {
+        return true;
+    }
+    if (0 >= bytesRx)
+    {
+        return false;
+    }
+    local.input.insert(local.input.end(), buffer, buffer + bytesRx);
+
+    size_t start = 0;
+    while (2 <= local.input.size() - start)
+    {
+        const uint8_t* frame = reinterpret_cast<const uint8_t*>(local.input.data() + start);
+        size_t length = 2 + ((static_cast<size_t>(frame[0]) << 8) | frame[1]);
+        if (LOCAL_BUFFER < length || 2 == length)
+        {
+            fprintf(stderr,"ERR: Local Client Sent Invalid Frame, Disconnected\n");
+            return false;
+        }
+        if (length > local.input.size() - start)
+        {
+            break;
+        }
+        if (LOCAL_SUBSCRIBE == frame[2])
+        {
+            local.subscribed = true;
+        }
+        else
+        {
+            // Blocking Write Keeps Frames Whole, Network Loop Drains Its Input Into Message Queue
+            size_t written = 0;
+            while (written < length)
+            {
+                ssize_t bytesTx = write(inputPair[1], frame + written, length - written);
+                if (0 > bytesTx && EINTR == errno)
+                    continue;
+                if (0 >= bytesTx)
+                    return false;
+                written += bytesTx;
+            }
+        }
+        start += length;
+    }
+    local.input.erase(local.input.begin(), local.input.begin() + start);
+    return true;
+}
+
+/**
+ * @brief Sends Pending Frames With One Gather Write
+ * @param local The Process
+ *
+ * Frames Are Sent From The Shared Buffers, Nothing Is Copied Per Subscriber.
+ * @return False If The Process Left
+ */
+bool DaemonHub::writeLocal(Local_t& local)
+{
+    struct iovec vectors[MAX_GATHER];
+    int count = 0;
+    for (Frame_t* frame : local.pending)
+    {
+        size_t offset = (0 == count) ? local.sent : 0;
+        vectors[count].iov_base = frame->bytes + offset;
+        vectors[count].iov_len = frame->length - offset;
+        if (MAX_GATHER == ++count)
+            break;
+    }
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = vectors;
+    message.msg_iovlen = count;
+    ssize_t bytesTx = sendmsg(local.fd, &message, MSG_NOSIGNAL);
+    if (0 > bytesTx)
+    {
+        return EAGAIN == errno || EINTR == errno;
+    }
+
+    size_t remaining = bytesTx;
+    while (0 < remaining)
+    {
+        Frame_t* frame = local.pending.front();
+        size_t left = frame->length - local.sent;
+        if (remaining < left)
+        {
+            local.sent += remaining;
+            break;
+        }
+        remaining -= left;
+        local.sent = 0;
+        local.pending.pop_front();
+        releaseFrame(frame);
+    }
+    if (0 != local.dropped && local.pending.empty())
+    {
+        fprintf(stderr,"ERR: %u Messages Dropped For Slow Local Client\n", local.dropped);
+        local.dropped = 0;
+    }
+    return true;
+}
+
+/**
+ * @brief Passes Frames From Network Loop To Every Subscriber
+ *
+ * Each Subscriber Takes A Reference, Frame Without Subscribers Is Freed At Once.
+ */
+void DaemonHub::fanOut()
+{
+    Frame_t* frame = nullptr;
+    while (queue.pop(frame))
+    {
+        for (Local_t& local : locals)
+        {
+            if (!local.subscribed)
+                continue;
+            if (MAX_PENDING <= local.pending.size())
+            {
+                local.dropped++;
+                continue;
+            }
+            local.pending.push_back(frame);
+            frame->refs++;
+        }
+        if (0 == frame->refs)
+        {
+            delete frame;
+        }
+    }
+    uint32_t lost = dropped.exchange(0);
+    if (0 != lost)
+    {
+        fprintf(stderr,"ERR: %u Messages Dropped, Hub Thread Is Too Slow\n", lost);
+    }
+}
+
+void DaemonHub::closeLocal(Local_t& local)
+{
+    for (Frame_t* frame : local.pending)
+    {
+        releaseFrame(frame);
+    }
+    local.pending.clear();
+    ::close(local.fd);
+}
+
+void DaemonHub::releaseFrame(Frame_t* frame)
+{
+    if (0 == --frame->refs)
+    {
+        delete frame;
+    }
+}
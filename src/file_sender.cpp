@@ -0,0 +1,151 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      file_sender.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Streaming Memory-Mapped File As MSG Messages.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           file_sender.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Streaming Memory-Mapped File As MSG Messages.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cstdio>
+#include <cstring>
+#include <sys/mman.h>
+#include "../include/file_sender.hpp"
+#include "../include/macros.hpp"
+/************************************************/
+/*                  Helpers                     */
+/************************************************/
+static constexpr double MIB = 1024.0 * 1024.0;
+/************************************************/
+/*                  Class                       */
+/************************************************/
+int FileSender::open(const std::string& filePath)
+{
+    if (isActive())
+    {
+        fprintf(stderr,"ERR: File %s Is Still Being Sent\n", path.c_str());
+        return FAIL;
+    }
+    if (SUCCESS != file.open(filePath, MappedFile::READ_ONLY))
+    {
+        fprintf(stderr,"ERR: File %s Could Not Be Mapped\n", filePath.c_str());
+        return FAIL;
+    }
+    if (nullptr != file.data())
+    {
+        madvise(file.data(), file.mappedSize(), MADV_SEQUENTIAL);
+    }
+    path = filePath;
+    cursor = 0;
+    released = 0;
+    lineNumber = 0;
+    sentLines = 0;
+    skippedLines = 0;
+    startedAt = std::chrono::steady_clock::now();
+    reportedAt = startedAt;
+    fprintf(stderr,"INFO: Sending %s, %.1f MiB\n", path.c_str(), file.length() / MIB);
+    return SUCCESS;
+}
+
+bool FileSender::next(CharBuffer& content)
+{
+    const char* text = reinterpret_cast<const char*>(file.data());
+    const size_t length = file.length();
+
+    while (cursor < length)
+    {
+        const char* start = text + cursor;
+        const char* newLine = static_cast<const char*>(memchr(start, '\n', length - cursor));
+        size_t lineLength = (nullptr != newLine) ? (size_t)(newLine - start) : length - cursor;
+        cursor += lineLength + 1;
+        lineNumber++;
+
+        std::string_view line(start, lineLength);
+        if (!line.empty() && '\r' == line.back())
+        {
+            line.remove_suffix(1);
+        }
+        if (line.empty())
+        {
+            continue;
+        }
+        // Same Rules As checkLength() Applies To Typed MSG
+        if (line.size() > LENGHT_CONTENT || !areAllPrintableCharactersOrSpace(line))
+        {
+            fprintf(stderr,"ERR: Line %lu of %s Skipped, Non Valid Content\n", (unsigned long)lineNumber, path.c_str());
+            skippedLines++;
+            continue;
+        }
+
+        content.assign(line.begin(), line.end());
+        sentLines++;
+        release();
+        if (std::chrono::steady_clock::now() - reportedAt >= std::chrono::milliseconds(REPORT_PERIOD))
+        {
+            report(false);
+        }
+        return true;
+    }
+
+    report(true);
+    file.close();
+    return false;
+}
+
+void FileSender::stop()
+{
+    if (!isActive())
+    {
+        return;
+    }
+    report(true);
+    file.close();
+}
+
+/**
+ * @brief Drops Pages Already Read, Whole Chunks Only
+ *
+ * Read-Only Shared Mapping Is Backed By The File, Dropped Pages Would Be
+ * Read Again From Page Cache If Touched.
+ */
+void FileSender::release()
+{
+    if (cursor - released < RELEASE_CHUNK)
+    {
+        return;
+    }
+    size_t dropped = (cursor - released) / RELEASE_CHUNK * RELEASE_CHUNK;
+    madvise(file.data() + released, dropped, MADV_DONTNEED);
+    released += dropped;
+}
+
+void FileSender::report(bool final)
+{
+    auto now = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(now - startedAt).count();
+    double sentMiB = std::min(cursor, file.length()) / MIB;
+    double messageRate = (0.0 < seconds) ? sentLines / seconds : 0.0;
+    double byteRate = (0.0 < seconds) ? sentMiB / seconds : 0.0;
+    reportedAt = now;
+
+    if (final)
+    {
+        fprintf(stderr,"INFO: Sent %s, %lu Messages, %lu Lines Skipped, %.1f MiB In %.2f s (%.0f Msg/s, %.2f MiB/s)\n",
+                path.c_str(), (unsigned long)sentLines, (unsigned long)skippedLines, sentMiB, seconds, messageRate, byteRate);
+        return;
+    }
+    double percent = (0 < file.length()) ? 100.0 * std::min(cursor, file.length()) / file.length() : 100.0;
+    fprintf(stderr,"INFO: Sending %s, %.1f of %.1f MiB (%.0f %%), %lu Messages (%.0f Msg/s, %.2f MiB/s)\n",
+            path.c_str(), sentMiB, file.length() / MIB, percent, (unsigned long)sentLines, messageRate, byteRate);
+}
@@ -0,0 +1,384 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      history.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Append-Only Message History Log.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           history.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Append-Only Message History Log.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <ctime>
+#include <algorithm>
+#include "../include/history.hpp"
+#include "../include/base_messages.hpp"
+#include "../include/macros.hpp"
+/************************************************/
+/*                  Helpers                     */
+/************************************************/
+static constexpr char HISTORY_INDEX_MAGIC[8] = {'I','P','K','H','I','D','X','1'};
+
+/**
+ * @brief FNV-1a Hash, Detects Torn Records
+ */
+static uint32_t checksum(const uint8_t* data, size_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * @brief Writes Magic Into Empty File Or Checks It In Existing One
+ * @param file Opened File
+ * @param magic Expected Magic
+ *
+ * @return SUCCESS If The File Carries The Magic, Otherwise FAIL
+ */
+static int prepareHeader(MappedFile& file, const char* magic)
+{
+    if (file.mappedSize() < HISTORY_HEADER_SIZE)
+    {
+        uint8_t* out = file.reserve(HISTORY_HEADER_SIZE);
+        if (nullptr == out)
+        {
+            return FAIL;
+        }
+        memset(out, 0, HISTORY_HEADER_SIZE);
+        memcpy(out, magic, sizeof(HISTORY_MAGIC));
+    }
+    else if (0 != memcmp(file.data(), magic, sizeof(HISTORY_MAGIC)))
+    {
+        return FAIL;
+    }
+    file.setLength(HISTORY_HEADER_SIZE);
+    return SUCCESS;
+}
+
+/**
+ * @brief Counts Index Entries Before The Zero Tail
+ * @param file Index File
+ *
+ * @return Number of Entries
+ */
+static size_t indexEntries(const MappedFile& file)
+{
+    if (!file.isOpen() || file.mappedSize() < HISTORY_HEADER_SIZE ||
+        0 != memcmp(file.data(), HISTORY_INDEX_MAGIC, sizeof(HISTORY_INDEX_MAGIC)))
+    {
+        return 0;
+    }
+    const HistoryIndexEntry_t* entries = reinterpret_cast<const HistoryIndexEntry_t*>(file.data() + HISTORY_HEADER_SIZE);
+    size_t count = (file.mappedSize() - HISTORY_HEADER_SIZE) / sizeof(HistoryIndexEntry_t);
+    size_t valid = 0;
+    while (valid < count && HISTORY_HEADER_SIZE <= entries[valid].offset)
+    {
+        valid++;
+    }
+    return valid;
+}
+
+static const char* typeName(uint8_t type)
+{
+    switch (type)
+    {
+        case BaseMessages::REPLY:           return "REPLY";
+        case BaseMessages::COMMAND_AUTH:    return "AUTH";
+        case BaseMessages::COMMAND_JOIN:    return "JOIN";
+        case BaseMessages::MSG:             return "MSG";
+        case BaseMessages::ERROR:           return "ERR";
+        case BaseMessages::COMMAND_BYE:     return "BYE";
+        default:                            return "UNKNOWN";
+    }
+}
+
+/**
+ * @brief Prints Single Record
+ * @param record Record In Mapped Log
+ */
+static void printRecord(const uint8_t* record)
+{
+    HistoryRecord_t header;
+    memcpy(&header, record, sizeof(header));
+    const char* sender = reinterpret_cast<const char*>(record + sizeof(header));
+    const char* channel = sender + header.senderLength;
+    const char* content = channel + header.channelLength;
+
+    time_t seconds = header.timestamp / 1000000;
+    struct tm local;
+    char when[32];
+    localtime_r(&seconds, &local);
+    strftime(when, sizeof(when), "%Y-%m-%d %H:%M:%S", &local);
+
+    fprintf(stdout,"%s.%06u %s %s", when, static_cast<unsigned>(header.timestamp % 1000000),
+            (History::SENT == header.direction) ? "SENT" : "RECV", typeName(header.type));
+    if (BaseMessages::REPLY == header.type)
+        fprintf(stdout," %s", header.result ? "OK" : "NOK");
+    if (0 != header.channelLength)
+        fprintf(stdout," #%.*s", header.channelLength, channel);
+    if (0 != header.senderLength)
+        fprintf(stdout," %.*s%s", header.senderLength, sender, (0 != header.contentLength) ? ":" : "");
+    if (0 != header.contentLength)
+        fprintf(stdout," %.*s", header.contentLength, content);
+    fputc('\n', stdout);
+}
+
+/************************************************/
+/*                  Class                       */
+/************************************************/
+MappedFile History::log;
+MappedFile History::index;
+uint64_t History::records = 0;
+std::string History::joinedChannel;
+
+/**
+ * @brief Validates Record At Offset
+ * @param file Log File
+ * @param offset Offset of The Record
+ *
+ * @return Length of The Record, 0 If There Is No Valid Record
+ */
+size_t History::validRecord(const MappedFile& file, size_t offset)
+{
+    HistoryRecord_t header;
+    if (offset + sizeof(header) > file.mappedSize())
+    {
+        return 0;
+    }
+    memcpy(&header, file.data() + offset, sizeof(header));
+    size_t payload = header.senderLength + header.channelLength + header.contentLength;
+    if (header.length < sizeof(header) + payload || 0 != header.length % 8 || offset + header.length > file.mappedSize())
+    {
+        return 0;
+    }
+    if (header.checksum != checksum(file.data() + offset + 8, sizeof(header) - 8 + payload))
+    {
+        return 0;
+    }
+    return header.length;
+}
+
+/**
+ * @brief Opens Log For Appending, Recovers Its Tail
+ * @param path Path of The Log File
+ *
+ * Scan Starts At The Last Index Entry Pointing To Valid Record, So Opening
+ * Long Log Does Not Read It Whole. Everything After The Last Valid Record Is Zeroed.
+ * @return SUCCESS If The Log Is Ready, Otherwise FAIL
+ */
+int History::open(const std::string& path)
+{
+    if (SUCCESS != log.open(path, MappedFile::APPEND) || SUCCESS != index.open(path + ".idx", MappedFile::APPEND) ||
+        SUCCESS != prepareHeader(log, HISTORY_MAGIC) || SUCCESS != prepareHeader(index, HISTORY_INDEX_MAGIC))
+    {
+        fprintf(stderr,"ERR: History %s Could Not Be Opened\n", path.c_str());
+        log.close();
+        index.close();
+        return FAIL;
+    }
+
+    const HistoryIndexEntry_t* entries = reinterpret_cast<const HistoryIndexEntry_t*>(index.data() + HISTORY_HEADER_SIZE);
+    size_t entryCount = indexEntries(index);
+    size_t offset = HISTORY_HEADER_SIZE;
+    records = 0;
+    while (0 < entryCount)
+    {
+        const HistoryIndexEntry_t& entry = entries[entryCount - 1];
+        if (0 != validRecord(log, entry.offset))
+        {
+            offset = entry.offset;
+            records = entry.record;
+            break;
+        }
+        entryCount--;
+    }
+    index.setLength(HISTORY_HEADER_SIZE + entryCount * sizeof(HistoryIndexEntry_t));
+
+    for (size_t length = validRecord(log, offset); 0 != length; length = validRecord(log, offset))
+    {
+        offset += length;
+        records++;
+    }
+    log.setLength(offset);
+
+    // Torn Record Would Confuse Next Recovery If New Record Is Shorter
+    uint8_t* tail = log.data() + offset;
+    size_t tailLength = log.mappedSize() - offset;
+    if (tailLength != static_cast<size_t>(std::count(tail, tail + tailLength, 0)))
+    {
+        fprintf(stderr,"INFO: History Torn Tail Discarded, %llu Records Kept\n", static_cast<unsigned long long>(records));
+        memset(tail, 0, tailLength);
+    }
+    memset(index.data() + index.length(), 0, index.mappedSize() - index.length());
+
+    atexit(History::close);
+    return SUCCESS;
+}
+
+/**
+ * @brief Appends Record, Does Nothing If History Is Not Open
+ * @param direction Sent Or Received
+ * @param type Type of The Message
+ * @param result Result of REPLY
+ * @param sender Display Name of Sender
+ * @param channel Channel, Empty To Use The Last Joined Channel
+ * @param content Content of The Message
+ *
+ * Length Is Published Last, So Reader Never Sees Half Written Record.
+ */
+void History::append(Direction_t direction, uint8_t type, uint8_t result, const std::string& sender,
+                     const std::string& channel, const std::string& content)
+{
+    if (!log.isOpen())
+    {
+        return;
+    }
+    if (SENT == direction && BaseMessages::COMMAND_JOIN == type)
+    {
+        joinedChannel = channel;
+    }
+    const std::string& recordChannel = channel.empty() ? joinedChannel : channel;
+
+    HistoryRecord_t header;
+    header.length = 0;
+    header.checksum = 0;
+    header.timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::system_clock::now().time_since_epoch()).count();
+    header.direction = direction;
+    header.type = type;
+    header.result = result;
+    header.senderLength = std::min<size_t>(sender.size(), UINT8_MAX);
+    header.channelLength = std::min<size_t>(recordChannel.size(), UINT8_MAX);
+    header.reserved = 0;
+    header.contentLength = std::min<size_t>(content.size(), UINT16_MAX);
+
+    size_t payload = header.senderLength + header.channelLength + header.contentLength;
+    uint32_t length = (sizeof(header) + payload + 7) & ~7u;
+    size_t offset = log.length();
+    uint8_t* out = log.reserve(length);
+    if (nullptr == out)
+    {
+        return;
+    }
+    uint8_t* body = out + sizeof(header);
+    memcpy(body, sender.data(), header.senderLength);
+    body += header.senderLength;
+    memcpy(body, recordChannel.data(), header.channelLength);
+    body += header.channelLength;
+    memcpy(body, content.data(), header.contentLength);
+    memset(body + header.contentLength, 0, length - sizeof(header) - payload);
+    memcpy(out, &header, sizeof(header));
+    header.checksum = checksum(out + 8, sizeof(header) - 8 + payload);
+    memcpy(out + 4, &header.checksum, sizeof(header.checksum));
+    __atomic_store_n(reinterpret_cast<uint32_t*>(out), length, __ATOMIC_RELEASE);
+    log.setLength(offset + length);
+
+    if (0 == records % HISTORY_INDEX_INTERVAL)
+    {
+        HistoryIndexEntry_t entry = {records, offset, header.timestamp};
+        uint8_t* slot = index.reserve(sizeof(entry));
+        if (nullptr != slot)
+        {
+            memcpy(slot, &entry, sizeof(entry));
+            index.setLength(index.length() + sizeof(entry));
+        }
+    }
+    records++;
+}
+
+/**
+ * @brief Truncates Log Files To Their Length
+ */
+void History::close()
+{
+    log.close();
+    index.close();
+}
+
+/**
+ * @brief Prints Records of Log To STDOUT
+ * @param path Path of The Log File
+ * @param last Number of Newest Records To Print, 0 For All
+ *
+ * Log Is Read Straight From The Mapping. Index Lets The Dump Of The Last
+ * Records Start Near The End Instead Of Walking The Whole Log.
+ * @return SUCCESS If The Log Could Be Read, Otherwise FAIL
+ */
+int History::dump(const std::string& path, uint64_t last)
+{
+    MappedFile file;
+    MappedFile sparse;
+    if (SUCCESS != file.open(path, MappedFile::READ_ONLY) || file.mappedSize() < HISTORY_HEADER_SIZE ||
+        0 != memcmp(file.data(), HISTORY_MAGIC, sizeof(HISTORY_MAGIC)))
+    {
+        fprintf(stderr,"ERR: %s Is Not History Log\n", path.c_str());
+        return FAIL;
+    }
+    sparse.open(path + ".idx", MappedFile::READ_ONLY);
+    size_t entryCount = indexEntries(sparse);
+    const HistoryIndexEntry_t* entries = (0 != entryCount) ?
+        reinterpret_cast<const HistoryIndexEntry_t*>(sparse.data() + HISTORY_HEADER_SIZE) : nullptr;
+
+    // Count Records From The Last Usable Index Entry
+    uint64_t total = 0;
+    size_t offset = HISTORY_HEADER_SIZE;
+    for (size_t i = entryCount; 0 < i; i--)
+    {
+        if (0 != validRecord(file, entries[i - 1].offset))
+        {
+            total = entries[i - 1].record;
+            offset = entries[i - 1].offset;
+            break;
+        }
+    }
+    for (size_t length = validRecord(file, offset); 0 != length; length = validRecord(file, offset))
+    {
+        offset += length;
+        total++;
+    }
+
+    // Seek To The First Printed Record Thru The Index
+    uint64_t first = (0 == last || last >= total) ? 0 : total - last;
+    uint64_t current = 0;
+    offset = HISTORY_HEADER_SIZE;
+    const HistoryIndexEntry_t* end = entries + entryCount;
+    const HistoryIndexEntry_t* hit = std::upper_bound(entries, end, first,
+        [](uint64_t record, const HistoryIndexEntry_t& entry) { return record < entry.record; });
+    if (entries != hit && 0 != validRecord(file, (hit - 1)->offset))
+    {
+        current = (hit - 1)->record;
+        offset = (hit - 1)->offset;
+    }
+
+    static char outputBuffer[1 << 20];
+    setvbuf(stdout, outputBuffer, _IOFBF, sizeof(outputBuffer));
+    for (size_t length = validRecord(file, offset); 0 != length; length = validRecord(file, offset))
+    {
+        if (current >= first)
+        {
+            printRecord(file.data() + offset);
+        }
+        offset += length;
+        current++;
+    }
+    fflush(stdout);
+    return SUCCESS;
+}
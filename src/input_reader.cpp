@@ -0,0 +1,466 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      input_reader.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Structured JSONL And Binary Input Records.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           input_reader.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Structured JSONL And Binary Input Records.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cerrno>
+#include <cstring>
+#include "../include/input_reader.hpp"
+/************************************************/
+/*                  Helpers                     */
+/************************************************/
+namespace
+{
+    /**
+     * @brief Field Present In JSONL Record, Bit Per Field
+     */
+    enum Present_t : uint8_t
+    {
+        HAS_TYPE            = 0x01,
+        HAS_USERNAME        = 0x02,
+        HAS_SECRET          = 0x04,
+        HAS_DISPLAY_NAME    = 0x08,
+        HAS_CHANNEL         = 0x10,
+        HAS_CONTENT         = 0x20,
+    };
+
+    /**
+     * @brief Receives Value of Unknown Key
+     */
+    struct Discard_t
+    {
+        bool push_back(char) { return true; }
+    };
+
+    using TypeName = FixedString<8>;
+    using KeyName = FixedString<16>;
+
+    /**
+     * @brief Reads Value Between Quotes Into Field, Escapes Are Decoded
+     * @param cursor Position of Opening Quote, Moved After Closing One
+     * @param last End of Record
+     * @param field Field Receiving Characters
+     *
+     * Escaped Characters Above ASCII Are Refused, Content Rules Allow ASCII Only.
+     * @return True If The String Was Complete, Otherwise False
+     */
+    template <typename Field>
+    bool readString(const char*& cursor, const char* last, Field& field)
+    {
+        if (cursor == last || '"' != *cursor)
+            return false;
+        cursor++;
+        while (cursor != last && '"' != *cursor)
+        {
+            char character = *cursor++;
+            if ('\\' == character)
+            {
+                if (cursor == last)
+                    return false;
+                char escaped = *cursor++;
+                switch (escaped)
+                {
+                    case '"': case '\\': case '/': character = escaped; break;
+                    case 'b': character = '\b'; break;
+                    case 'f': character = '\f'; break;
+                    case 'n': character = '\n'; break;
+                    case 'r': character = '\r'; break;
+                    case 't': character = '\t'; break;
+                    case 'u':
+                    {
+                        if (4 > last - cursor)
+                            return false;
+                        unsigned code = 0;
+                        for (int idx = 0; idx < 4; idx++)
+                        {
+                            char digit = *cursor++;
+                            code <<= 4;
+                            if ('0' <= digit && '9' >= digit)       code |= digit - '0';
+                            else if ('a' <= digit && 'f' >= digit)  code |= digit - 'a' + 10;
+                            else if ('A' <= digit && 'F' >= digit)  code |= digit - 'A' + 10;
+                            else return false;
+                        }
+                        if (0x7F < code)
+                            return false;
+                        character = static_cast<char>(code);
+                        break;
+                    }
+                    default:
+                        return false;
+                }
+            }
+            field.push_back(character);
+        }
+        if (cursor == last)
+            return false;
+        cursor++;
+        return true;
+    }
+
+    void skipSpace(const char*& cursor, const char* last)
+    {
+        while (cursor != last && (' ' == *cursor || '\t' == *cursor || '\r' == *cursor || '\n' == *cursor))
+            cursor++;
+    }
+
+    /**
+     * @brief Takes Next Zero-Terminated Field of Binary Record
+     * @param cursor Start of The Field, Moved After Its Terminator
+     * @param last End of Record
+     *
+     * The Last Field May Miss Its Terminator.
+     */
+    std::string_view nextField(const char*& cursor, const char* last)
+    {
+        const char* first = cursor;
+        const char* zero = static_cast<const char*>(memchr(cursor, '\0', last - cursor));
+        cursor = (nullptr != zero) ? zero + 1 : last;
+        return std::string_view(first, ((nullptr != zero) ? zero : last) - first);
+    }
+}
+/************************************************/
+/*                  Class                       */
+/************************************************/
+void InputReader::open(Format_t inputFormat, int inputFd)
+{
+    format = inputFormat;
+    fd = inputFd;
+    ring = (SHM == format) ? &ShmLink::inbound() : nullptr;
+}
+
+/**
+ * @brief Reads Available Bytes, Call Only When Descriptor Is Readable
+ *
+ * Unread Bytes Are Moved To The Front First, Oversized JSONL Line Is
+ * Dropped Here Until Its End Arrives.
+ * @return False On End of Input, Otherwise True
+ */
+bool InputReader::fill()
+{
+    if (SHM == format)
+    {
+        // Records Stay In The Ring, Only The Wakeup Is Consumed
+        uint64_t signalled = 0;
+        ssize_t bytesRx = read(fd, &signalled, sizeof(signalled));
+        (void)bytesRx;
+        return true;
+    }
+    if (0 != start)
+    {
+        memmove(buffer, buffer + start, end - start);
+        end -= start;
+        start = 0;
+    }
+    ssize_t bytesRx = read(fd, buffer + end, BUFFER_SIZE - end);
+    if (0 == bytesRx)
+    {
+        ended = true;
+        return false;
+    }
+    if (0 > bytesRx)
+    {
+        return EINTR == errno || EAGAIN == errno;
+    }
+    end += bytesRx;
+
+    if (discarding)
+    {
+        const char* newLine = static_cast<const char*>(memchr(buffer, '\n', end));
+        start = (nullptr != newLine) ? newLine - buffer + 1 : end;
+        discarding = (nullptr == newLine);
+    }
+    return true;
+}
+
+bool InputReader::hasRecord() const
+{
+    if (SHM == format)
+    {
+        return !ring->isEmpty();
+    }
+    return 0 != recordLength();
+}
+
+size_t InputReader::recordLength() const
+{
+    size_t available = end - start;
+    if (JSONL == format || TEXT == format)
+    {
+        const char* newLine = static_cast<const char*>(memchr(buffer + start, '\n', available));
+        if (nullptr != newLine)
+            return newLine - (buffer + start) + 1;
+        // Last Line Without New Line, Or Line Filling The Whole Buffer
+        return (ended || BUFFER_SIZE == available) ? available : 0;
+    }
+    if (2 > available)
+    {
+        return 0;
+    }
+    size_t length = 2 + ((static_cast<uint8_t>(buffer[start]) << 8) | static_cast<uint8_t>(buffer[start + 1]));
+    return (length <= available) ? length : 0;
+}
+
+InputReader::Result_t InputReader::next(BaseMessages::Message_t& msg)
+{
+    if (SHM == format)
+    {
+        // Decoded Straight From Shared Memory, Released Once Fields Are Copied
+        std::string_view shared;
+        if (!ring->peek(shared))
+        {
+            return NONE;
+        }
+        Result_t result = decodeBinary(shared, msg);
+        ring->release(shared.size());
+        return result;
+    }
+    size_t length = recordLength();
+    if (0 == length)
+    {
+        return NONE;
+    }
+    std::string_view record(buffer + start, length);
+    bool oversized = (BINARY != format && '\n' != record.back() && !ended);
+    start += length;
+    if (oversized)
+    {
+        discarding = true;
+        return INVALID;
+    }
+    if (TEXT == format)
+    {
+        return decodeText(record, msg);
+    }
+    return (JSONL == format) ? decodeJson(record, msg) : decodeBinary(record.substr(2), msg);
+}
+
+/**
+ * @brief Stores Line For Command Grammar of checkMessage()
+ * @param record One Line
+ * @param msg Message Whose Buffer Is Filled
+ *
+ * Line Ending Is Normalized To CRLF, Same As readAndStoreContent() Does.
+ * @return RECORD
+ */
+InputReader::Result_t InputReader::decodeText(std::string_view record, BaseMessages::Message_t& msg)
+{
+    msg.buffer.clear();
+    msg.structured = false;
+    for (char character : record)
+    {
+        if ('\r' != character && '\n' != character)
+            msg.buffer.push_back(character);
+    }
+    msg.buffer.push_back('\r');
+    msg.buffer.push_back('\n');
+    return RECORD;
+}
+
+/**
+ * @brief Decodes Flat JSON Object With String Values
+ * @param record One Line
+ * @param msg Message Whose Fields Are Filled
+ *
+ * Keys: type (auth, join, msg, rename), username, secret, display_name,
+ * channel, content. Unknown Keys Are Ignored.
+ * @return RECORD If Type And Its Fields Are Present, Otherwise INVALID
+ */
+InputReader::Result_t InputReader::decodeJson(std::string_view record, BaseMessages::Message_t& msg)
+{
+    const char* cursor = record.data();
+    const char* last = record.data() + record.size();
+    uint8_t present = 0;
+    TypeName typeName;
+    BaseMessages::DisplayName displayName;
+    Discard_t discard;
+
+    skipSpace(cursor, last);
+    if (cursor == last || '{' != *cursor++)
+        return INVALID;
+    skipSpace(cursor, last);
+    bool closed = (cursor != last && '}' == *cursor);
+    if (closed)
+        cursor++;
+    while (!closed)
+    {
+        KeyName key;
+        skipSpace(cursor, last);
+        if (!readString(cursor, last, key) || key.overflowed())
+            return INVALID;
+        skipSpace(cursor, last);
+        if (cursor == last || ':' != *cursor++)
+            return INVALID;
+        skipSpace(cursor, last);
+
+        std::string_view name = key;
+        bool complete;
+        if ("type" == name)
+        {
+            complete = readString(cursor, last, typeName);
+            present |= HAS_TYPE;
+        }
+        else if ("username" == name)
+        {
+            msg.login.clear();
+            complete = readString(cursor, last, msg.login);
+            present |= HAS_USERNAME;
+        }
+        else if ("secret" == name)
+        {
+            msg.secret.clear();
+            complete = readString(cursor, last, msg.secret);
+            present |= HAS_SECRET;
+        }
+        else if ("display_name" == name)
+        {
+            complete = readString(cursor, last, displayName);
+            present |= HAS_DISPLAY_NAME;
+        }
+        else if ("channel" == name)
+        {
+            msg.channelID.clear();
+            complete = readString(cursor, last, msg.channelID);
+            present |= HAS_CHANNEL;
+        }
+        else if ("content" == name)
+        {
+            msg.content.clear();
+            complete = readString(cursor, last, msg.content);
+            present |= HAS_CONTENT;
+        }
+        else
+        {
+            complete = readString(cursor, last, discard);
+        }
+        if (!complete)
+            return INVALID;
+
+        skipSpace(cursor, last);
+        if (cursor == last)
+            return INVALID;
+        char separator = *cursor++;
+        if ('}' == separator)
+            closed = true;
+        else if (',' != separator)
+            return INVALID;
+    }
+    skipSpace(cursor, last);
+    if (cursor != last || 0 == (present & HAS_TYPE))
+        return INVALID;
+
+    std::string_view type = typeName;
+    uint8_t required;
+    if ("auth" == type)         { msg.type = BaseMessages::COMMAND_AUTH;    required = HAS_USERNAME | HAS_SECRET | HAS_DISPLAY_NAME; }
+    else if ("join" == type)    { msg.type = BaseMessages::COMMAND_JOIN;    required = HAS_CHANNEL; }
+    else if ("msg" == type)     { msg.type = BaseMessages::MSG;             required = HAS_CONTENT; }
+    else if ("rename" == type)  { msg.type = BaseMessages::COMMAND_RENAME;  required = HAS_DISPLAY_NAME; }
+    else return INVALID;
+    if (required != (present & required))
+        return INVALID;
+
+    if (BaseMessages::COMMAND_AUTH == msg.type)
+    {
+        if (displayName.overflowed())
+            return INVALID;
+        msg.displayName = displayName;
+    }
+    else if (BaseMessages::COMMAND_RENAME == msg.type)
+    {
+        // New Name Is Taken By checkMessage(), Queued Rename Must Not Change The Name Earlier
+        msg.content.assign(displayName.begin(), displayName.end());
+        if (displayName.overflowed())
+            return INVALID;
+    }
+    msg.buffer.clear();
+    msg.structured = true;
+    return RECORD;
+}
+
+/**
+ * @brief Decodes Binary Record Without Its Length
+ * @param record Type Byte And Fields
+ * @param msg Message Whose Fields Are Filled
+ *
+ * AUTH: username, secret, display name. JOIN: channel. MSG: content.
+ * RENAME: display name.
+ * @return RECORD If The Type Is Known And Has All Its Fields Non-Empty, Otherwise INVALID
+ */
+InputReader::Result_t InputReader::decodeBinary(std::string_view record, BaseMessages::Message_t& msg)
+{
+    if (record.empty())
+        return INVALID;
+    const char* cursor = record.data() + 1;
+    const char* last = record.data() + record.size();
+    BaseMessages::MessageType_t type = static_cast<BaseMessages::MessageType_t>(record[0]);
+    BaseMessages::DisplayName displayName;
+
+    switch (type)
+    {
+        case BaseMessages::COMMAND_AUTH:
+        {
+            std::string_view login = nextField(cursor, last);
+            std::string_view secret = nextField(cursor, last);
+            std::string_view name = nextField(cursor, last);
+            if (login.empty() || secret.empty() || name.empty())
+                return INVALID;
+            msg.login.assign(login.begin(), login.end());
+            msg.secret.assign(secret.begin(), secret.end());
+            displayName.assign(name.begin(), name.end());
+            break;
+        }
+        case BaseMessages::COMMAND_JOIN:
+        {
+            std::string_view channel = nextField(cursor, last);
+            if (channel.empty())
+                return INVALID;
+            msg.channelID.assign(channel.begin(), channel.end());
+            break;
+        }
+        case BaseMessages::MSG:
+        {
+            std::string_view content = nextField(cursor, last);
+            if (content.empty())
+                return INVALID;
+            msg.content.assign(content.begin(), content.end());
+            break;
+        }
+        case BaseMessages::COMMAND_RENAME:
+        {
+            std::string_view name = nextField(cursor, last);
+            if (name.empty())
+                return INVALID;
+            msg.content.assign(name.begin(), name.end());
+            break;
+        }
+        default:
+            return INVALID;
+    }
+    if (cursor != last)
+        return INVALID;
+
+    if (BaseMessages::COMMAND_AUTH == type)
+    {
+        if (displayName.overflowed())
+            return INVALID;
+        msg.displayName = displayName;
+    }
+    msg.type = type;
+    msg.buffer.clear();
+    msg.structured = true;
+    return RECORD;
+}
@@ -0,0 +1,261 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      jsonl_writer.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements JSON Lines Writer With Background Flushing.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           jsonl_writer.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements JSON Lines Writer With Background Flushing.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cstdio>
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <charconv>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../include/jsonl_writer.hpp"
+/************************************************/
+/*                  Helpers                     */
+/************************************************/
+static const char HEX_DIGITS[] = "0123456789abcdef";
+/************************************************/
+/*                  Class                       */
+/************************************************/
+JsonlWriter::~JsonlWriter()
+{
+    close();
+}
+
+int JsonlWriter::open(const std::string& path, int wake)
+{
+    if (path.empty())
+    {
+        fd = STDOUT_FILENO;
+        ownFd = false;
+    }
+    else
+    {
+        fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+        ownFd = true;
+        if (-1 == fd)
+        {
+            fprintf(stderr,"ERR: Output File %s Could Not Be Opened\n", path.c_str());
+            return FAIL;
+        }
+    }
+    wakeFd = wake;
+    buffers[0] = std::make_unique<char[]>(BUFFER_SIZE);
+    buffers[1] = std::make_unique<char[]>(BUFFER_SIZE);
+    active = buffers[0].get();
+    used = 0;
+    stopping = false;
+
+    sigset_t all, previous;
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &previous);           // Signals Go To Main Thread
+    worker = std::thread(&JsonlWriter::run, this);
+    pthread_sigmask(SIG_SETMASK, &previous, nullptr);
+    return SUCCESS;
+}
+
+void JsonlWriter::beginRecord()
+{
+    if (BUFFER_SIZE - used < MAX_RECORD)
+    {
+        handOver(true);
+    }
+    append('{');
+    firstField = true;
+}
+
+void JsonlWriter::field(std::string_view name, std::string_view value)
+{
+    appendName(name);
+    append('"');
+    for (char character : value)
+    {
+        unsigned char code = static_cast<unsigned char>(character);
+        if ('"' == character || '\\' == character)
+        {
+            append('\\');
+            append(character);
+        }
+        else if (0x20 > code || 0x7F == code)
+        {
+            append("\\u00");
+            append(HEX_DIGITS[code >> 4]);
+            append(HEX_DIGITS[code & 0x0F]);
+        }
+        else
+        {
+            append(character);
+        }
+    }
+    append('"');
+}
+
+void JsonlWriter::field(std::string_view name, int64_t value)
+{
+    appendName(name);
+    std::to_chars_result result = std::to_chars(active + used, active + BUFFER_SIZE, value);
+    used = result.ptr - active;
+}
+
+void JsonlWriter::booleanField(std::string_view name, bool value)
+{
+    appendName(name);
+    append(value ? "true" : "false");
+}
+
+void JsonlWriter::nullField(std::string_view name)
+{
+    appendName(name);
+    append("null");
+}
+
+void JsonlWriter::endRecord()
+{
+    append("}\n");
+}
+
+void JsonlWriter::flush()
+{
+    if (0 != used)
+    {
+        handOver(false);
+    }
+}
+
+void JsonlWriter::close()
+{
+    if (!worker.joinable())
+    {
+        return;
+    }
+    if (0 != used)
+    {
+        handOver(true);
+    }
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        ready.wait(guard, [this] { return 0 == pendingLength; });
+        stopping = true;
+    }
+    ready.notify_all();
+    worker.join();
+    if (ownFd)
+    {
+        ::close(fd);
+    }
+    fd = -1;
+}
+
+/**
+ * @brief Passes Active Buffer To Writer Thread
+ * @param wait Wait Until Writer Finishes The Previous One
+ *
+ * Formatting Continues In The Half Writer Finished, So Neither Side Copies.
+ * @return True If The Buffer Was Handed Over, Otherwise False
+ */
+bool JsonlWriter::handOver(bool wait)
+{
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        if (0 != pendingLength)
+        {
+            if (!wait)
+            {
+                return false;
+            }
+            ready.wait(guard, [this] { return 0 == pendingLength; });
+        }
+        pending = active;
+        pendingLength = used;
+    }
+    ready.notify_all();
+    active = (active == buffers[0].get()) ? buffers[1].get() : buffers[0].get();
+    used = 0;
+    return true;
+}
+
+/**
+ * @brief Body of Writer Thread
+ *
+ * Writes Handed Over Half, Then Wakes Formatting Thread, Which May Hand Over
+ * Records Formatted Meanwhile. Leaves On close() When Nothing Is Pending.
+ */
+void JsonlWriter::run()
+{
+    std::unique_lock<std::mutex> guard(lock);
+    while (true)
+    {
+        ready.wait(guard, [this] { return 0 != pendingLength || stopping; });
+        if (0 == pendingLength)
+        {
+            break;
+        }
+        const char* data = pending;
+        size_t remaining = pendingLength;
+        guard.unlock();
+
+        while (0 < remaining)
+        {
+            ssize_t written = write(fd, data, remaining);
+            if (-1 == written && EINTR == errno)
+            {
+                continue;
+            }
+            if (0 >= written)
+            {
+                if (!failed)
+                {
+                    fprintf(stderr,"ERR: Output Could Not Be Written, Records Are Dropped\n");
+                    failed = true;
+                }
+                break;
+            }
+            data += written;
+            remaining -= written;
+        }
+
+        guard.lock();
+        pendingLength = 0;
+        ready.notify_all();
+        if (-1 != wakeFd)
+        {
+            uint64_t one = 1;
+            ssize_t bytesTx = ::write(wakeFd, &one, sizeof(one));
+            (void)bytesTx;
+        }
+    }
+}
+
+void JsonlWriter::append(std::string_view text)
+{
+    memcpy(active + used, text.data(), text.size());
+    used += text.size();
+}
+
+void JsonlWriter::appendName(std::string_view name)
+{
+    if (!firstField)
+    {
+        append(',');
+    }
+    firstField = false;
+    append('"');
+    append(name);
+    append("\":");
+}
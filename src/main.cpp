@@ -20,35 +20,52 @@
 /*******************************************************/
 /*                  Libraries                          */
 /*******************************************************/
+#include <iostream>
 #include "../include/arguments.hpp"
-#include "../include/tcp_client.hpp"
-#include "../include/udp_client.hpp"
-/*******************************************************/
-/*                  Global Variables                   */
-/*******************************************************/
-UdpClient* globalUdpClientInstance = nullptr;
-TcpClient* globalTcpClientInstance = nullptr;
-
-
+#include "../include/capture.hpp"
+#include "../include/trace.hpp"
+#include "../include/replay.hpp"
+#include "../include/renderer.hpp"
+#include "../include/history.hpp"
+#include "../include/search_index.hpp"
+#include "../include/session_mux.hpp"
+#include "../include/shm_ring.hpp"
+#include "../include/daemon_hub.hpp"
 /*******************************************************/
 /*                  Functions                          */
 /*******************************************************/
-
-void globalUdpHandleInterrupt(int signal) 
-{
-if (globalUdpClientInstance) 
+/**
+ * @brief Maps Value of --input To Input Format, Shared Ring Or Hub Replaces It
+ * @param name Validated Value of --input
+ *
+ * @return Format of Input
+ */
+static InputReader::Format_t inputFormat(const std::string& name)
 {
-    globalUdpClientInstance->udpHandleInterrupt(signal);
+    if (ShmLink::isOpen())
+        return InputReader::SHM;
+    if (DaemonHub::isOpen())
+        return InputReader::BINARY;
+    if ("jsonl" == name)
+        return InputReader::JSONL;
+    if ("binary" == name)
+        return InputReader::BINARY;
+    return InputReader::TEXT;
 }
-}
-
 
-void globalTcpHandleInterrupt(int signal) 
-{
-if (globalTcpClientInstance) 
+/**
+ * @brief Picks Descriptor of Structured Input
+ * @param args Parsed Arguments
+ *
+ * @return eventfd of Shared Ring, Read End of Hub Or --input-fd
+ */
+static int inputFd(const arguments& args)
 {
-    globalTcpClientInstance->tcpHandleInterrupt(signal);
-}
+    if (ShmLink::isOpen())
+        return ShmLink::getWakeFd();
+    if (DaemonHub::isOpen())
+        return DaemonHub::getInputFd();
+    return args.inputFd;
 }
 
 /*******************************************************/
@@ -57,41 +74,91 @@ if (globalTcpClientInstance)
 int main(int argc, char *argv[])
 {
 try {
-    /*** Variables ****/
-    int retVal = FAIL;
-
-
     /****** Code ******/
 
     // Parse Arguments
     arguments args(argc, argv); 
 
-    if ("tcp" == args.transferProtocol)
+    // Dump of History Log Does Not Connect Anywhere
+    if (!args.historyFile.empty())
+    {
+        return History::dump(args.historyFile, args.historyLast);
+    }
+    // Bound Before Any Thread Starts, Detached Process Keeps All of Them
+    if (!args.listenPath.empty() && SUCCESS != DaemonHub::open(args.listenPath, args.daemon))
+    {
+        return FAIL;
+    }
+    if (!args.recordHistoryFile.empty() && SUCCESS != History::open(args.recordHistoryFile))
+    {
+        return FAIL;
+    }
+
+    // Received Messages Are Indexed For /search Up To The Cap
+    SearchIndex::setMemoryCap(args.searchMemory * 1024 * 1024);
+
+    // Replay Serves Captured Server Traffic From Loopback, Client Connects To It
+    Replay replay;
+    if (!args.replayFile.empty())
+    {
+        if (SUCCESS != replay.load(args.replayFile) || SUCCESS != replay.start(args.replayMaxSpeed))
+        {
+            return FAIL;
+        }
+        args.transferProtocol = replay.getProtocol();
+        args.hostName = "127.0.0.1";
+        args.port = replay.getPort();
+    }
+    if (!args.captureFile.empty() && SUCCESS != Capture::open(args.captureFile, args.transferProtocol))
+    {
+        return FAIL;
+    }
+    // Opened Before Rendering Thread Starts, So Its Spans Are Flushed After The Thread Is Joined
+    if (!args.traceFile.empty() && SUCCESS != Trace::open(args.traceFile))
     {
-        TcpClient client(args.ipAddress, args.port, Client::TCP);
-        
-        // Set Global Instance Of TcpClient For Signal Handling
-        globalTcpClientInstance = &client;
-        // Set Signal Handler
-        signal(SIGINT, globalTcpHandleInterrupt);
-        
-        // Run Tcp Client
-        retVal = client.runTcpClient();
-        return retVal;   
+        return FAIL;
     }
-    else if ("udp" == args.transferProtocol)
+    // Local Producer Exchanges Records Thru Shared Rings Instead of STDIN And STDOUT
+    if (!args.shmRing.empty() && SUCCESS != ShmLink::open(args.shmRing))
+    {
+        return FAIL;
+    }
+    // Messages From Server Are Printed On Rendering Thread, Slow Terminal Does Not Stall Network Loop
+    Renderer::Output_t output = args.jsonlOutput ? Renderer::JSONL : Renderer::TEXT;
+    if (ShmLink::isOpen())
+        output = Renderer::SHM;
+    else if (DaemonHub::isOpen())
+        output = Renderer::DAEMON;
+    if (SUCCESS != Renderer::start(output, args.outputFile))
+    {
+        fprintf(stderr,"ERR: Rendering Thread Could Not Be Started\n");
+        return FAIL;
+    }
+
+    // Many Sessions Share One Event Loop, Input Is Routed By "@name" Prefix
+    // SIGINT And SIGTERM Are Read By The Event Loop, Which Flushes The Queues Before BYE
+    SessionMux mux;
+    mux.setDrainTimeout(args.drainTimeout);
+    if (!args.sessionsFile.empty())
+    {
+        if (!args.sendFile.empty() || "text" != args.inputFormat)
+        {
+            fprintf(stderr,"ERR: --send-file And --input Are Not Supported With --sessions\n");
+            return FAIL;
+        }
+        if (SUCCESS != mux.load(args.sessionsFile, args))
+        {
+            return FAIL;
+        }
+        return mux.run();
+    }
+
+    // Single Session Runs On The Same Scheduler, Untagged
+    if (SUCCESS != mux.add(args, inputFormat(args.inputFormat), inputFd(args)))
     {
-        UdpClient client(args.ipAddress, args.port, args.confirmRetriesUDP, args.confirmTimeOutUDP);
-        
-        // Set Global Instance Of UdpClient For Signal Handling
-        globalUdpClientInstance = &client;          
-        // Set Signal Handler
-        signal(SIGINT, globalUdpHandleInterrupt);
-        
-        // Run Udp Client
-        retVal = client.runUdpClient();
-        return retVal;
+        return FAIL;
     }
+    return mux.run();
 }
 catch (const std::exception &e)
 {
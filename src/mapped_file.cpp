@@ -0,0 +1,134 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      mapped_file.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Growable Memory Mapped Append File.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           mapped_file.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Growable Memory Mapped Append File.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "../include/mapped_file.hpp"
+#include "../include/macros.hpp"
+/************************************************/
+/*                  Class                       */
+/************************************************/
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+/**
+ * @brief Opens And Maps The File
+ * @param path Path of The File
+ * @param mode Open Mode
+ *
+ * @return SUCCESS If The File Is Mapped (Empty File Is Mapped On First reserve()), Otherwise FAIL
+ */
+int MappedFile::open(const std::string& path, Mode_t mode)
+{
+    int flags = O_CLOEXEC;
+    if (READ_ONLY == mode)
+        flags |= O_RDONLY;
+    else
+        flags |= O_RDWR | O_CREAT | ((TRUNCATE == mode) ? O_TRUNC : 0);
+
+    fd = ::open(path.c_str(), flags, 0644);
+    struct stat info;
+    if (-1 == fd || 0 != fstat(fd, &info))
+    {
+        close();
+        return FAIL;
+    }
+    writable = (READ_ONLY != mode);
+    used = 0;
+    if (0 == info.st_size)
+    {
+        return SUCCESS;
+    }
+
+    void* newMap = mmap(nullptr, info.st_size, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == newMap)
+    {
+        close();
+        return FAIL;
+    }
+    map = static_cast<uint8_t*>(newMap);
+    mapped = info.st_size;
+    if (!writable)
+    {
+        used = mapped;
+    }
+    return SUCCESS;
+}
+
+/**
+ * @brief Makes Room After The Used Part
+ * @param length Number of Bytes Needed
+ *
+ * File Grows By MAP_CHUNK, The Mapping Follows It Thru mremap().
+ * @return Pointer To Free Space, nullptr If The Mapping Could Not Grow
+ */
+uint8_t* MappedFile::reserve(size_t length)
+{
+    if (used + length <= mapped)
+    {
+        return map + used;
+    }
+    if (!writable)
+    {
+        return nullptr;
+    }
+    size_t newSize = mapped + ((length / MAP_CHUNK) + 1) * MAP_CHUNK;
+    if (0 != ftruncate(fd, newSize))
+    {
+        return nullptr;
+    }
+    void* newMap = (nullptr == map) ? mmap(nullptr, newSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)
+                                    : mremap(map, mapped, newSize, MREMAP_MAYMOVE);
+    if (MAP_FAILED == newMap)
+    {
+        return nullptr;
+    }
+    map = static_cast<uint8_t*>(newMap);
+    mapped = newSize;
+    return map + used;
+}
+
+/**
+ * @brief Unmaps And Truncates Writable File To Its Length
+ */
+void MappedFile::close()
+{
+    if (nullptr != map)
+    {
+        munmap(map, mapped);
+        map = nullptr;
+    }
+    if (-1 != fd)
+    {
+        if (writable && 0 != ftruncate(fd, used))
+        {
+            fprintf(stderr,"ERR: Mapped File Could Not Be Truncated\n");
+        }
+        ::close(fd);
+        fd = -1;
+    }
+    mapped = 0;
+    used = 0;
+}
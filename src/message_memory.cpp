@@ -0,0 +1,36 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      message_memory.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Memory Resources Backing Messages.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           message_memory.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Memory Resources Backing Messages.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include "../include/message_memory.hpp"
+/************************************************/
+/*                  Class                       */
+/************************************************/
+/**
+ * @brief Returns Pool Shared By Queued Messages
+ *
+ * Created On First Use And Never Destroyed, Messages In Static Objects May
+ * Still Release Into It During Exit.
+ * @return Pool Resource
+ */
+std::pmr::memory_resource* MessageMemory::pool()
+{
+    static std::pmr::unsynchronized_pool_resource* shared = new std::pmr::unsynchronized_pool_resource();
+    return shared;
+}
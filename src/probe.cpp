@@ -0,0 +1,188 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      probe.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Compile-Time Switchable Cycle Probes On Hot-Path Stages.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           probe.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Compile-Time Switchable Cycle Probes On Hot-Path Stages.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include "../include/probe.hpp"
+
+#if PROBE_MACRO
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+/************************************************/
+/*                  Helpers                     */
+/************************************************/
+#if defined(__x86_64__) || defined(__i386__)
+static const char* const TICK_UNIT = "Cycles";
+static inline uint64_t readTicks() { return __rdtsc(); }
+#else
+static const char* const TICK_UNIT = "ns";
+static inline uint64_t readTicks()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+static const char* const STAGE_NAMES[Probe::STAGES] = {"decodeLine", "checkMessage", "serializeMessage", "decodeDatagram", "dedup", "send"};
+
+#if PROBE_MACRO >= 2
+/**
+ * @brief Opens Hardware Counter of Calling Thread, User Space Only
+ * @param config Counter, PERF_COUNT_HW_*
+ * @param leader Leader of The Group, -1 For The Leader Itself
+ *
+ * @return File Descriptor of The Counter, -1 On Failure
+ */
+static int openCounter(uint64_t config, int leader)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return syscall(SYS_perf_event_open, &attr, 0, -1, leader, 0);
+}
+#endif
+
+/**
+ * @brief Opens Counters Of The Main Thread Before main() And Registers The Report
+ */
+static struct ProbeStartup_t
+{
+    ProbeStartup_t()
+    {
+        Probe::open();
+        atexit(Probe::report);
+    }
+} probeStartup;
+/************************************************/
+/*                  Class                       */
+/************************************************/
+int Probe::groupFd = -1;
+uint64_t Probe::calls[STAGES] = {};
+uint64_t Probe::cycles[STAGES] = {};
+uint64_t Probe::counters[STAGES][COUNTERS] = {};
+
+/**
+ * @brief Opens Group of Instructions, Cache Misses And Branch Misses
+ *
+ * Only With PROBE_MACRO 2. Unavailable Counters (Container, Virtual
+ * Machine, perf_event_paranoid) Leave Only Cycles Measured.
+ */
+void Probe::open()
+{
+#if PROBE_MACRO >= 2
+    static const uint64_t CONFIGS[COUNTERS] = {PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+    groupFd = openCounter(CONFIGS[0], -1);
+    for (int idx = 1; idx < COUNTERS && -1 != groupFd; idx++)
+    {
+        if (-1 == openCounter(CONFIGS[idx], groupFd))
+        {
+            close(groupFd);
+            groupFd = -1;
+        }
+    }
+    if (-1 == groupFd)
+    {
+        fprintf(stderr,"INFO: Hardware Counters Not Available, Only %s Are Measured\n", TICK_UNIT);
+        return;
+    }
+    ioctl(groupFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(groupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+/**
+ * @brief Reads Time And Counters
+ * @param reading Filled Sample
+ * @param starting Start of The Stage, Counters Are Read Before Time
+ *
+ * Counters Are Read Outside The Timed Interval, So Cost of Their read()
+ * Is Not Counted In Cycles of The Stage.
+ */
+void Probe::sample(Sample_t& reading, bool starting)
+{
+    struct
+    {
+        uint64_t count;
+        uint64_t values[COUNTERS];
+    } group = {};
+
+    if (!starting)
+        reading.cycles = readTicks();
+    if (-1 != groupFd && (ssize_t)sizeof(group) != read(groupFd, &group, sizeof(group)))
+        memset(&group, 0, sizeof(group));
+    memcpy(reading.counters, group.values, sizeof(reading.counters));
+    if (starting)
+        reading.cycles = readTicks();
+}
+
+void Probe::add(Stage_t stage, const Sample_t& start, const Sample_t& stop)
+{
+    calls[stage]++;
+    cycles[stage] += stop.cycles - start.cycles;
+    for (int idx = 0; idx < COUNTERS; idx++)
+    {
+        counters[stage][idx] += stop.counters[idx] - start.counters[idx];
+    }
+}
+
+/**
+ * @brief Prints Per-Stage Cost Table To STDERR
+ */
+void Probe::report()
+{
+    fprintf(stderr,"INFO: Probe Report\n");
+    fprintf(stderr,"%-20s %10s %14s %12s", "Stage", "Calls", TICK_UNIT, "Per Call");
+    if (-1 != groupFd)
+        fprintf(stderr," %12s %12s %12s", "Instr/Call", "CacheMiss/C", "BranchMiss/C");
+    fprintf(stderr,"\n");
+
+    for (int stage = 0; stage < STAGES; stage++)
+    {
+        double perCall = calls[stage] ? (double)cycles[stage] / calls[stage] : 0.0;
+        fprintf(stderr,"%-20s %10lu %14lu %12.1f", STAGE_NAMES[stage], (unsigned long)calls[stage], (unsigned long)cycles[stage], perCall);
+        if (-1 != groupFd)
+        {
+            for (int idx = 0; idx < COUNTERS; idx++)
+            {
+                fprintf(stderr," %12.2f", calls[stage] ? (double)counters[stage][idx] / calls[stage] : 0.0);
+            }
+        }
+        fprintf(stderr,"\n");
+    }
+    if (-1 != groupFd)
+    {
+        close(groupFd);
+        groupFd = -1;
+    }
+}
+
+#endif // PROBE_MACRO
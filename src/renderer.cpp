@@ -0,0 +1,452 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      renderer.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Terminal Rendering Thread.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           renderer.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Terminal Rendering Thread.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <csignal>
+#include <cstring>
+#include <algorithm>
+#include <chrono>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include "../include/renderer.hpp"
+#include "../include/history.hpp"
+#include "../include/base_messages.hpp"
+#include "../include/trace.hpp"
+/************************************************/
+/*                  Class                       */
+/************************************************/
+SpscQueue<Renderer::Event_t, Renderer::QUEUE_CAPACITY> Renderer::queue;
+std::thread Renderer::worker;
+int Renderer::wakeFd = -1;
+std::atomic<bool> Renderer::running{false};
+std::atomic<uint32_t> Renderer::dropped{0};
+std::atomic<uint32_t> Renderer::lagged{0};
+std::deque<Renderer::Event_t> Renderer::overflow;
+std::mutex Renderer::overflowLock;
+std::atomic<bool> Renderer::overflowing{false};
+char Renderer::session[LENGHT_SESSION_NAME + 1] = "";
+Renderer::Output_t Renderer::output = Renderer::TEXT;
+JsonlWriter Renderer::jsonl;
+
+/**
+ * @brief Reads Wall Clock In Microseconds
+ */
+static int64_t wallClockUs()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Starts Rendering Thread
+ * @param format Output Format
+ * @param outputFile File For JSONL, Empty For STDOUT
+ *
+ * Thread Is Joined By atexit(), Because Client Leaves Thru exit() On Many Places.
+ * JSONL Writer Shares eventfd of The Thread, Finished Write Wakes It To Hand
+ * Over Records Formatted Meanwhile. SHM And DAEMON Need No Thread, Ring And
+ * Hub Thread Already Queue The Records.
+ * @return SUCCESS If The Thread Runs, Otherwise FAIL
+ */
+int Renderer::start(Output_t format, const std::string& outputFile)
+{
+    if (SHM == format || DAEMON == format)
+    {
+        output = format;
+        atexit(Renderer::stop);
+        return SUCCESS;
+    }
+    wakeFd = eventfd(0, EFD_CLOEXEC);
+    if (-1 == wakeFd)
+    {
+        return FAIL;
+    }
+    output = format;
+    if (JSONL == output && SUCCESS != jsonl.open(outputFile, wakeFd))
+    {
+        return FAIL;
+    }
+    running = true;
+    sigset_t all, previous;
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &previous);           // Signals Go To Main Thread's signalfd
+    worker = std::thread(run);
+    pthread_sigmask(SIG_SETMASK, &previous, nullptr);
+    atexit(Renderer::stop);
+    return SUCCESS;
+}
+
+/**
+ * @brief Passes Message To Rendering Thread
+ * @param kind Kind of The Message
+ * @param displayName Display Name of Sender, Empty If Not Used
+ * @param content Content of The Message
+ * @param messageID UDP Message ID, NO_MESSAGE_ID If Not Known
+ */
+void Renderer::publish(Kind_t kind, const std::string& displayName, const std::string& content, int32_t messageID)
+{
+    // Every Decoded Server Message Passes Here, So It Is Also Appended To History
+    static const uint8_t historyType[] = {BaseMessages::MSG, BaseMessages::REPLY, BaseMessages::REPLY, BaseMessages::ERROR};
+    History::append(History::RECEIVED, historyType[kind], (REPLY_OK == kind) ? 1 : 0, displayName, "", content);
+    if (SHM == output || DAEMON == output)
+    {
+        publishRecord(kind, displayName, content);
+        return;
+    }
+
+    Event_t event;
+    fill(event, kind, displayName, content);
+    event.messageID = messageID;
+    enqueue(event);
+}
+
+/**
+ * @brief Passes Result of Local /search To Rendering Thread
+ * @param kind SEARCH_MATCH or SEARCH_SUMMARY
+ * @param document Number of Matched Message, 0 For SEARCH_SUMMARY
+ * @param displayName Display Name of Sender, Empty For SEARCH_SUMMARY
+ * @param content Content of Matched Message or Summary Line
+ *
+ * Results Follow Messages Published Before The Query. They Are Not Stored In
+ * History, And With SHM or DAEMON Output They Are Printed By The Caller,
+ * Because Local Processes Receive Server Messages Only.
+ */
+void Renderer::publishLocal(Kind_t kind, uint64_t document, const std::string& displayName, const std::string& content)
+{
+    Event_t event;
+    fill(event, kind, displayName, content);
+    event.messageID = NO_MESSAGE_ID;
+    event.document = document;
+    enqueue(event);
+}
+
+/**
+ * @brief Fills Message Passed To Rendering Thread
+ * @param event Destination
+ * @param kind Kind of The Message
+ * @param displayName Display Name of Sender
+ * @param content Content of The Message
+ */
+void Renderer::fill(Event_t& event, Kind_t kind, const std::string& displayName, const std::string& content)
+{
+    event.kind = kind;
+    event.receivedAt = (JSONL == output) ? wallClockUs() : 0;
+    size_t nameLength = std::min(displayName.size(), sizeof(event.displayName) - 1);
+    size_t contentLength = std::min(content.size(), sizeof(event.content) - 1);
+    memcpy(event.displayName, displayName.data(), nameLength);
+    event.displayName[nameLength] = '\0';
+    memcpy(event.content, content.data(), contentLength);
+    event.content[contentLength] = '\0';
+    memcpy(event.session, session, sizeof(event.session));
+    event.traceMessage = Trace::currentMessage();
+    event.publishedAt = Trace::enabled() ? Trace::now() : 0;
+    event.document = 0;
+}
+
+/**
+ * @brief Hands Message Over To Rendering Thread Or Prints It Directly
+ * @param event Message To Print
+ *
+ * Once The Queue Was Full, Messages Go To Overflow Buffer Until Rendering
+ * Thread Takes It, So They Keep Their Order. Message Which Finds Overflow
+ * Buffer Full Is Dropped, Network Loop Is Never Blocked By The Output.
+ */
+void Renderer::enqueue(const Event_t& event)
+{
+    if (!running)
+    {
+        Trace::Scope printing("print");
+        render(event);
+        return;
+    }
+    if (overflowing.load(std::memory_order_acquire) || !queue.push(event))
+    {
+        std::lock_guard<std::mutex> guard(overflowLock);
+        if (OVERFLOW_CAPACITY <= overflow.size())
+        {
+            lagged.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        overflow.push_back(event);
+        overflowing.store(true, std::memory_order_release);
+    }
+    uint64_t one = 1;
+    ssize_t bytesTx = write(wakeFd, &one, sizeof(one));
+    (void)bytesTx;
+}
+
+/**
+ * @brief Sets Session Whose Messages Are Published Next
+ * @param name Name of The Session, Printed As "[name] " Before Its Messages
+ *
+ * Called Only From Network Loop, Which Is The Only Publisher.
+ */
+void Renderer::setSession(const std::string& name)
+{
+    size_t nameLength = std::min(name.size(), sizeof(session) - 1);
+    memcpy(session, name.data(), nameLength);
+    session[nameLength] = '\0';
+}
+
+/**
+ * @brief Prints Remaining Messages And Joins Rendering Thread
+ */
+void Renderer::stop()
+{
+    uint32_t lost = (SHM == output) ? dropped.exchange(0) : 0;
+    if (0 != lost)
+    {
+        fprintf(stderr,"ERR: %u Messages Dropped, Shared Ring Is Full\n", lost);
+    }
+    if (!running.exchange(false))
+    {
+        return;
+    }
+    uint64_t one = 1;
+    ssize_t bytesTx = write(wakeFd, &one, sizeof(one));
+    (void)bytesTx;
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+    jsonl.close();
+    close(wakeFd);
+    wakeFd = -1;
+}
+
+/**
+ * @brief Body of Rendering Thread
+ *
+ * Sleeps On eventfd, Then Prints Everything Queued, Overflow Buffer After
+ * The Queue. Messages Dropped Meanwhile Are Reported After The Batch.
+ * Leaves After stop() When Both Are Empty.
+ */
+void Renderer::run()
+{
+    Event_t event;
+    std::deque<Event_t> batch;
+    bool active = true;
+    Trace::nameThread("render");
+    while (active)
+    {
+        uint64_t pending = 0;
+        ssize_t bytesRx = read(wakeFd, &pending, sizeof(pending));
+        (void)bytesRx;
+        active = running;
+
+        do
+        {
+            while (queue.pop(event))
+            {
+                Trace::resumeMessage(event.traceMessage, true);
+                if (0 != event.publishedAt)
+                    Trace::span("render queue", event.publishedAt, Trace::now());
+                Trace::Scope printing("print");
+                render(event);
+            }
+            // Messages Published Meanwhile Go To The Queue Again, Batch Precedes Them
+            takeOverflow(batch);
+            for (const Event_t& waiting : batch)
+            {
+                Trace::resumeMessage(waiting.traceMessage, true);
+                Trace::Scope printing("print");
+                render(waiting);
+            }
+        } while (!batch.empty());
+        uint32_t lost = lagged.exchange(0);
+        if (0 != lost)
+        {
+            fprintf(stderr,"ERR: %u Messages Dropped, Output Is Too Slow\n", lost);
+        }
+        if (JSONL == output)
+            jsonl.flush();
+        else
+            fflush(stdout);
+    }
+}
+
+/**
+ * @brief Takes Messages Waiting In Overflow Buffer
+ * @param batch Receives The Messages In Order of publish()
+ *
+ * Called When The Queue Is Empty, Every Message In The Queue Is Older.
+ */
+void Renderer::takeOverflow(std::deque<Event_t>& batch)
+{
+    batch.clear();
+    if (!overflowing.load(std::memory_order_acquire))
+    {
+        return;
+    }
+    std::lock_guard<std::mutex> guard(overflowLock);
+    batch.swap(overflow);
+    overflowing.store(false, std::memory_order_release);
+}
+
+/**
+ * @brief Prints Single Message
+ * @param event Message To Print
+ */
+void Renderer::render(const Event_t& event)
+{
+    if (JSONL == output && jsonl.isOpen() && SEARCH_SUMMARY != event.kind)
+    {
+        renderJsonl(event);
+        return;
+    }
+    char tag[LENGHT_SESSION_NAME + 4] = "";
+    if ('\0' != event.session[0])
+    {
+        snprintf(tag, sizeof(tag), "[%s] ", event.session);
+    }
+    switch (event.kind)
+    {
+        case CHAT_MESSAGE:
+            fprintf(stdout,"%s%s: %s\n", tag, event.displayName, event.content);
+            break;
+        case REPLY_OK:
+            fprintf(stdout,"%sSuccess: %s\n", tag, event.content);
+            break;
+        case REPLY_NOK:
+            fprintf(stdout,"%sFailure: %s\n", tag, event.content);
+            break;
+        case SERVER_ERROR:
+            fprintf(stderr,"%sERR FROM %s: %s\n", tag, event.displayName, event.content);
+            break;
+        case SEARCH_MATCH:
+            fprintf(stdout,"[#%llu] %s: %s\n", static_cast<unsigned long long>(event.document),
+                    event.displayName, event.content);
+            break;
+        case SEARCH_SUMMARY:
+            fflush(stdout);
+            fprintf(stderr,"%s\n", event.content);
+            break;
+    }
+}
+
+/**
+ * @brief Formats Single Message As JSON Object
+ * @param event Message To Format
+ *
+ * {"type":"msg","session":"a","sender":"Bob","content":"Hi","id":7,"received_us":..,"rendered_us":..}
+ * REPLY Has "result" Instead of Sender, Session Is Present With --sessions Only.
+ * Result of /search Has Type "search" And "document" Instead of "id".
+ */
+void Renderer::renderJsonl(const Event_t& event)
+{
+    static const char* const TYPES[] = {"msg", "reply", "reply", "err", "search"};
+    jsonl.beginRecord();
+    jsonl.field("type", TYPES[event.kind]);
+    if ('\0' != event.session[0])
+        jsonl.field("session", event.session);
+    if (REPLY_OK == event.kind || REPLY_NOK == event.kind)
+        jsonl.booleanField("result", REPLY_OK == event.kind);
+    else
+        jsonl.field("sender", event.displayName);
+    jsonl.field("content", event.content);
+    if (SEARCH_MATCH == event.kind)
+        jsonl.field("document", static_cast<int64_t>(event.document));
+    else if (NO_MESSAGE_ID == event.messageID)
+        jsonl.nullField("id");
+    else
+        jsonl.field("id", (int64_t)event.messageID);
+    jsonl.field("received_us", event.receivedAt);
+    jsonl.field("rendered_us", wallClockUs());
+    jsonl.endRecord();
+}
+
+/**
+ * @brief Computes Length of Binary Record For Message
+ * @param kind Kind of The Message
+ * @param displayName Display Name of Sender
+ * @param content Content of The Message
+ *
+ * Fields Are Limited Like In Event_t.
+ */
+size_t Renderer::recordLength(Kind_t kind, const std::string& displayName, const std::string& content)
+{
+    bool reply = (REPLY_OK == kind || REPLY_NOK == kind);
+    size_t nameLength = std::min(displayName.size(), static_cast<size_t>(LENGHT_DISPLAY_NAME));
+    return 1 + (reply ? 1 : nameLength + 1) + std::min(content.size(), static_cast<size_t>(LENGHT_CONTENT));
+}
+
+/**
+ * @brief Encodes Message As Binary Record
+ * @param body Destination, recordLength() Bytes
+ * @param kind Kind of The Message
+ * @param displayName Display Name of Sender
+ * @param content Content of The Message
+ *
+ * Type Byte (BaseMessages Values), Then For REPLY Result Byte (1 OK, 0 NOK)
+ * And Content, Otherwise Display Name, Zero Byte And Content.
+ */
+void Renderer::encodeRecord(uint8_t* body, Kind_t kind, const std::string& displayName, const std::string& content)
+{
+    static const uint8_t TYPES[] = {BaseMessages::MSG, BaseMessages::REPLY, BaseMessages::REPLY, BaseMessages::ERROR};
+    *body++ = TYPES[kind];
+    if (REPLY_OK == kind || REPLY_NOK == kind)
+    {
+        *body++ = (REPLY_OK == kind) ? 1 : 0;
+    }
+    else
+    {
+        size_t nameLength = std::min(displayName.size(), static_cast<size_t>(LENGHT_DISPLAY_NAME));
+        memcpy(body, displayName.data(), nameLength);
+        body += nameLength;
+        *body++ = '\0';
+    }
+    memcpy(body, content.data(), std::min(content.size(), static_cast<size_t>(LENGHT_CONTENT)));
+}
+
+/**
+ * @brief Writes Message Into Outbound Shared Ring Or Hub On The Calling Thread
+ * @param kind Kind of The Message
+ * @param displayName Display Name of Sender
+ * @param content Content of The Message
+ *
+ * Record Is Encoded In Place, Into The Ring Or Into The Frame Shared By All
+ * Subscribers. Full Ring Drops The Message And The Count Is Reported Later.
+ */
+void Renderer::publishRecord(Kind_t kind, const std::string& displayName, const std::string& content)
+{
+    size_t length = recordLength(kind, displayName, content);
+    if (DAEMON == output)
+    {
+        DaemonHub::Frame_t* frame = DaemonHub::newFrame(length);
+        encodeRecord(frame->body(), kind, displayName, content);
+        DaemonHub::publish(frame);
+        return;
+    }
+    ShmRing& ring = ShmLink::outbound();
+    uint8_t* body = ring.reserve(length);
+    if (nullptr == body)
+    {
+        dropped++;
+        return;
+    }
+    encodeRecord(body, kind, displayName, content);
+    ring.commit(length);
+
+    uint32_t lost = dropped.exchange(0);
+    if (0 != lost)
+    {
+        fprintf(stderr,"ERR: %u Messages Dropped, Shared Ring Is Full\n", lost);
+    }
+}
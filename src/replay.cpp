@@ -0,0 +1,323 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      replay.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Deterministic Replay of Captured Traffic.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           replay.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Deterministic Replay of Captured Traffic.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <thread>
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "../include/replay.hpp"
+#include "../include/macros.hpp"
+/************************************************/
+/*                  State                       */
+/************************************************/
+/**
+ * @brief State Shared Between Replay And Replay Thread
+ *
+ * Owned By Both Sides, Because Client May Leave main() While
+ * The Thread Still Waits For Its Last Packets.
+ */
+struct Replay::State_t
+{
+    int sock = -1;                          //!< Listening TCP Socket or UDP Socket
+    bool stream = false;                    //!< True For TCP Capture
+    bool maxSpeed = false;                  //!< Ignore Recorded Gaps
+    std::vector<Replay::Record_t> records;  //!< Loaded Records
+
+    ~State_t()
+    {
+        if (-1 != sock)
+        {
+            close(sock);
+        }
+    }
+};
+
+/************************************************/
+/*                  Helpers                     */
+/************************************************/
+static uint32_t get32(const uint8_t* in)
+{
+    uint32_t value;
+    memcpy(&value, in, sizeof(value));
+    return value;
+}
+
+static uint16_t get16(const uint8_t* in)
+{
+    uint16_t value;
+    memcpy(&value, in, sizeof(value));
+    return value;
+}
+
+/**
+ * @brief Reads Everything The Client Sent So Far Without Blocking
+ * @param fd Client Socket
+ * @param stream True For TCP Socket
+ * @param peer Updated With Sender of The Last Datagram (UDP)
+ * @param timeout Milliseconds To Wait For First Data
+ *
+ * @return False If TCP Client Closed The Connection
+ */
+static bool drainClient(int fd, bool stream, struct sockaddr_storage& peer, int timeout)
+{
+    struct pollfd pfd = {fd, POLLIN, 0};
+    char sink[2048];
+    while (0 < poll(&pfd, 1, timeout))
+    {
+        socklen_t peerLen = sizeof(peer);
+        ssize_t bytesRx = stream ? recv(fd, sink, sizeof(sink), 0)
+                                 : recvfrom(fd, sink, sizeof(sink), 0, (struct sockaddr*)&peer, &peerLen);
+        if (stream && 0 >= bytesRx)
+        {
+            return false;
+        }
+        timeout = 0;
+    }
+    return true;
+}
+
+/************************************************/
+/*                  Class                       */
+/************************************************/
+Replay::Replay() : state(std::make_shared<State_t>()) {}
+
+/**
+ * @brief Plays Inbound Records To The Client, Runs On Replay Thread
+ * @param state Shared Replay State
+ */
+void Replay::serve(std::shared_ptr<State_t> state)
+{
+    struct sockaddr_storage peer;
+    socklen_t peerLen = sizeof(peer);
+    memset(&peer, 0, sizeof(peer));
+
+    int fd = state->sock;
+    if (state->stream)
+    {
+        fd = accept(state->sock, nullptr, nullptr);
+        if (-1 == fd)
+        {
+            return;
+        }
+    }
+    else
+    {
+        // Wait For AUTH, It Tells Where The Client Is
+        char sink[2048];
+        if (0 > recvfrom(fd, sink, sizeof(sink), 0, (struct sockaddr*)&peer, &peerLen))
+        {
+            return;
+        }
+    }
+
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    const uint64_t reference = state->records.front().timestamp;
+    size_t replayed = 0;
+    size_t bytes = 0;
+
+    for (const Replay::Record_t& record : state->records)
+    {
+        if (Capture::INBOUND != record.direction)
+        {
+            continue;
+        }
+        if (!state->maxSpeed)
+        {
+            Clock::time_point due = start + std::chrono::microseconds(record.timestamp - reference);
+            while (Clock::now() < due)
+            {
+                int wait = std::chrono::duration_cast<std::chrono::milliseconds>(due - Clock::now()).count();
+                drainClient(fd, state->stream, peer, wait);
+            }
+        }
+        ssize_t bytesTx = state->stream ? send(fd, record.data.data(), record.data.size(), MSG_NOSIGNAL)
+                                        : sendto(fd, record.data.data(), record.data.size(), 0,
+                                                 (struct sockaddr*)&peer, sizeof(struct sockaddr_in));
+        if (0 > bytesTx)
+        {
+            break;
+        }
+        replayed++;
+        bytes += bytesTx;
+    }
+    double elapsedMs = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    fprintf(stderr,"INFO: Replayed %zu Server Records (%zu Bytes) In %.3f ms, %.0f Records/s\n",
+            replayed, bytes, elapsedMs, (elapsedMs > 0.0) ? replayed * 1000.0 / elapsedMs : 0.0);
+
+    // Keep Reading Until The Client Leaves, So It Does Not See Refused Port
+    while (drainClient(fd, state->stream, peer, UNLIMITED_TIMEOUT)) {}
+    if (state->stream)
+    {
+        close(fd);
+    }
+}
+
+/**
+ * @brief Loads Records From pcapng File Written By Capture
+ * @param path Path of The Capture File
+ *
+ * Only Files In Native Byte Order With Single Interface Are Supported.
+ * @return SUCCESS If The File Was Parsed, Otherwise FAIL
+ */
+int Replay::load(const std::string& path)
+{
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    struct stat info;
+    if (-1 == fd || 0 != fstat(fd, &info) || 0 == info.st_size)
+    {
+        fprintf(stderr,"ERR: Replay File %s Could Not Be Opened\n", path.c_str());
+        if (-1 != fd)
+            close(fd);
+        return FAIL;
+    }
+    size_t size = info.st_size;
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (MAP_FAILED == mapped)
+    {
+        fprintf(stderr,"ERR: Replay File %s Could Not Be Mapped\n", path.c_str());
+        return FAIL;
+    }
+
+    const uint8_t* file = static_cast<const uint8_t*>(mapped);
+    int retVal = SUCCESS;
+    size_t offset = 0;
+    while (offset + 12 <= size)
+    {
+        const uint8_t* block = file + offset;
+        uint32_t type = get32(block);
+        uint32_t length = get32(block + 4);
+        if (length < 12 || offset + length > size)
+        {
+            break;                                      // Zero Tail of Interrupted Capture
+        }
+        if (PCAPNG_SHB == type && PCAPNG_BYTE_ORDER != get32(block + 8))
+        {
+            fprintf(stderr,"ERR: Replay File Has Foreign Byte Order\n");
+            retVal = FAIL;
+            break;
+        }
+        if (PCAPNG_IDB == type)
+        {
+            for (size_t option = 16; option + 4 <= length - 4; )
+            {
+                uint16_t code = get16(block + option);
+                uint16_t optionLength = get16(block + option + 2);
+                if (PCAPNG_OPT_END == code)
+                    break;
+                if (PCAPNG_OPT_IF_NAME == code)
+                    protocol.assign(reinterpret_cast<const char*>(block + option + 4), optionLength);
+                option += 4 + ((optionLength + 3) & ~3u);
+            }
+        }
+        if (PCAPNG_EPB == type && length >= 32)
+        {
+            Record_t record;
+            uint32_t captured = get32(block + 20);
+            record.timestamp = (static_cast<uint64_t>(get32(block + 12)) << 32) | get32(block + 16);
+            record.direction = Capture::INBOUND;
+            if (28 + captured > length - 4)
+            {
+                break;
+            }
+            record.data.assign(block + 28, block + 28 + captured);
+            for (size_t option = 28 + ((captured + 3) & ~3u); option + 4 <= length - 4; )
+            {
+                uint16_t code = get16(block + option);
+                uint16_t optionLength = get16(block + option + 2);
+                if (PCAPNG_OPT_END == code)
+                    break;
+                if (PCAPNG_OPT_EPB_FLAGS == code && 4 == optionLength)
+                    record.direction = static_cast<Capture::Direction_t>(get32(block + option + 4) & 3);
+                option += 4 + ((optionLength + 3) & ~3u);
+            }
+            state->records.push_back(std::move(record));
+        }
+        offset += length;
+    }
+    munmap(mapped, size);
+
+    if (SUCCESS == retVal && "tcp" != protocol && "udp" != protocol)
+    {
+        fprintf(stderr,"ERR: Replay File Does Not Name Protocol (tcp/udp)\n");
+        retVal = FAIL;
+    }
+    if (SUCCESS == retVal && state->records.empty())
+    {
+        fprintf(stderr,"ERR: Replay File Contains No Packets\n");
+        retVal = FAIL;
+    }
+    return retVal;
+}
+
+/**
+ * @brief Binds Loopback Socket And Starts Replay Thread
+ * @param maxSpeed True To Send Records Without Recorded Gaps
+ *
+ * @return SUCCESS If The Replay Server Runs, Otherwise FAIL
+ */
+int Replay::start(bool maxSpeed)
+{
+    state->stream = ("tcp" == protocol);
+    state->maxSpeed = maxSpeed;
+    state->sock = socket(AF_INET, state->stream ? SOCK_STREAM : SOCK_DGRAM, 0);
+
+    struct sockaddr_in local;
+    socklen_t localLen = sizeof(local);
+    memset(&local, 0, sizeof(local));
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (-1 == state->sock || 0 != bind(state->sock, (struct sockaddr*)&local, sizeof(local)) ||
+        (state->stream && 0 != listen(state->sock, 1)) ||
+        0 != getsockname(state->sock, (struct sockaddr*)&local, &localLen))
+    {
+        fprintf(stderr,"ERR: Replay Server Could Not Be Started\n");
+        return FAIL;
+    }
+    port = ntohs(local.sin_port);
+
+    sigset_t all, previous;
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &previous);           // Signals Go To Main Thread's signalfd
+    std::thread worker(serve, state);
+    pthread_sigmask(SIG_SETMASK, &previous, nullptr);
+    worker.detach();
+    return SUCCESS;
+}
+
+const std::string& Replay::getProtocol() const
+{
+    return protocol;
+}
+
+uint16_t Replay::getPort() const
+{
+    return port;
+}
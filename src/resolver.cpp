@@ -0,0 +1,180 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      resolver.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Asynchronous Host Name Resolution.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           resolver.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Asynchronous Host Name Resolution.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cstring>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <netdb.h>
+#include <unistd.h>
+#include <sys/eventfd.h>
+#include "../include/resolver.hpp"
+#include "../include/macros.hpp"
+/************************************************/
+/*                  State                       */
+/************************************************/
+/**
+ * @brief State Shared Between Resolver And Resolver Thread
+ *
+ * Owned By Both Sides, So The Thread Can Outlive The Resolver When
+ * The Connection Deadline Expires Before getaddrinfo() Returns.
+ */
+struct Resolver::State_t
+{
+    int eventFd = -1;                           //!< Signals Finished Resolution
+    std::mutex lock;                            //!< Guards Results
+    std::vector<Resolver::Address_t> results;   //!< Resolved Addresses
+    std::string error;                          //!< Error Message of Failed Resolution
+
+    ~State_t()
+    {
+        if (-1 != eventFd)
+        {
+            close(eventFd);
+        }
+    }
+};
+
+/************************************************/
+/*                  Class                       */
+/************************************************/
+Resolver::Resolver() : state(std::make_shared<State_t>()) {}
+
+Resolver::~Resolver() {}
+
+/**
+ * @brief Starts Resolution of Host Name On Resolver Thread
+ * @param host Host Name or IP Address
+ * @param port Server's Port
+ * @param family Address Family (AF_INET, AF_INET6 or AF_UNSPEC)
+ * @param socktype Socket Type (SOCK_STREAM or SOCK_DGRAM)
+ *
+ * @return SUCCESS If The Resolver Thread Was Started, Otherwise FAIL
+ */
+int Resolver::start(const std::string& host, int port, int family, int socktype)
+{
+    state->eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (-1 == state->eventFd)
+    {
+        return FAIL;
+    }
+
+    std::shared_ptr<State_t> shared = state;
+    std::string service = std::to_string(port);
+    std::thread worker([shared, host, service, family, socktype]()
+    {
+        struct addrinfo hints;
+        struct addrinfo* list = nullptr;
+        memset(&hints, 0, sizeof(hints));
+        hints.ai_family = family;
+        hints.ai_socktype = socktype;
+        hints.ai_flags = AI_NUMERICSERV;
+
+        int retVal = getaddrinfo(host.c_str(), service.c_str(), &hints, &list);
+        {
+            std::lock_guard<std::mutex> guard(shared->lock);
+            if (0 != retVal)
+            {
+                shared->error = gai_strerror(retVal);
+            }
+            for (struct addrinfo* it = list; nullptr != it; it = it->ai_next)
+            {
+                Resolver::Address_t address;
+                memset(&address, 0, sizeof(address));
+                memcpy(&address.addr, it->ai_addr, it->ai_addrlen);
+                address.len = it->ai_addrlen;
+                shared->results.push_back(address);
+            }
+        }
+        if (nullptr != list)
+        {
+            freeaddrinfo(list);
+        }
+        uint64_t done = 1;
+        ssize_t bytesTx = write(shared->eventFd, &done, sizeof(done));
+        (void)bytesTx;
+    });
+    worker.detach();
+    return SUCCESS;
+}
+
+int Resolver::getFd() const
+{
+    return state->eventFd;
+}
+
+/**
+ * @brief Collects Result of Finished Resolution
+ * @param addresses Vector To Which Resolved Addresses Are Stored
+ *
+ * @return SUCCESS If At Least One Address Was Resolved, Otherwise FAIL
+ */
+int Resolver::collect(std::vector<Address_t>& addresses)
+{
+    std::lock_guard<std::mutex> guard(state->lock);
+    addresses = state->results;
+    if (addresses.empty())
+    {
+        if (state->error.empty())
+        {
+            state->error = "Host Not Found";
+        }
+        return FAIL;
+    }
+    return SUCCESS;
+}
+
+const char* Resolver::getError() const
+{
+    return state->error.c_str();
+}
+
+/**
+ * @brief Orders Resolved Addresses For Connection Racing
+ * @param addresses Addresses In Order Returned By getaddrinfo()
+ *
+ * getaddrinfo() Already Sorts By RFC 6724, The First Family Is Kept
+ * Preferred And The Families Are Interleaved (RFC 8305, Section 4).
+ */
+void Resolver::orderAddresses(std::vector<Resolver::Address_t>& addresses)
+{
+    std::vector<Resolver::Address_t> preferred;
+    std::vector<Resolver::Address_t> other;
+    if (addresses.empty())
+        return;
+
+    const sa_family_t firstFamily = addresses.front().addr.ss_family;
+    for (const Resolver::Address_t& address : addresses)
+    {
+        if (address.addr.ss_family == firstFamily)
+            preferred.push_back(address);
+        else
+            other.push_back(address);
+    }
+
+    addresses.clear();
+    for (size_t idx = 0; idx < preferred.size() || idx < other.size(); idx++)
+    {
+        if (idx < preferred.size())
+            addresses.push_back(preferred[idx]);
+        if (idx < other.size())
+            addresses.push_back(other[idx]);
+    }
+}
@@ -0,0 +1,162 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      scheduler.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Scheduler Resuming Coroutines On Sockets And Timers.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           scheduler.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Scheduler Resuming Coroutines On Sockets And Timers.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <algorithm>
+#include "../include/scheduler.hpp"
+#include "../include/macros.hpp"
+/************************************************/
+/*                  Class                       */
+/************************************************/
+/**
+ * @brief Resumes Coroutine When File Descriptor Is Ready
+ * @param wait Registration of The Coroutine
+ * @param fd Watched File Descriptor
+ * @param events POLLIN or POLLOUT
+ */
+void Scheduler::watch(Wait& wait, int fd, short events)
+{
+    wait.fd = fd;
+    wait.events = events;
+    ((POLLOUT == events) ? writers : readers)[fd] = &wait;
+}
+
+/**
+ * @brief Resumes Coroutine At Deadline
+ * @param wait Registration of The Coroutine
+ * @param deadline Time of Resumption
+ */
+void Scheduler::arm(Wait& wait, Clock::time_point deadline)
+{
+    wait.timer = timers.emplace(deadline, &wait);
+    wait.timed = true;
+}
+
+/**
+ * @brief Removes Descriptor And Timer of Registration, Safe To Call Twice
+ * @param wait Registration of The Coroutine
+ */
+void Scheduler::cancel(Wait& wait)
+{
+    if (0 <= wait.fd)
+    {
+        std::unordered_map<int, Wait*>& waiting = (POLLOUT == wait.events) ? writers : readers;
+        auto waiter = waiting.find(wait.fd);
+        if (waiting.end() != waiter && &wait == waiter->second)
+            waiting.erase(waiter);
+        wait.fd = -1;
+    }
+    if (wait.timed)
+    {
+        timers.erase(wait.timer);
+        wait.timed = false;
+    }
+}
+
+/**
+ * @brief Waits Once For Descriptors And Timers, Resumes Ready Coroutines
+ *
+ * Resumed Coroutine May Cancel Others, So Every Ready Descriptor Is Looked
+ * Up Again Before Its Coroutine Is Resumed. Descriptor Waited For By Reader
+ * And Writer Has Two Entries In pfds.
+ * @return SUCCESS, FAIL If poll() Failed (errno Is Kept)
+ */
+int Scheduler::runOnce()
+{
+    int timeout = UNLIMITED_TIMEOUT;
+    if (!timers.empty())
+    {
+        auto remaining = std::chrono::ceil<std::chrono::milliseconds>(timers.begin()->first - Clock::now());
+        timeout = std::max(0, static_cast<int>(remaining.count()));
+    }
+
+    pfds.clear();
+    for (const auto& reader : readers)
+    {
+        pfds.push_back({reader.first, POLLIN, 0});
+    }
+    for (const auto& writer : writers)
+    {
+        pfds.push_back({writer.first, POLLOUT, 0});
+    }
+    if (FAIL == poll(pfds.data(), pfds.size(), timeout))
+    {
+        return FAIL;
+    }
+
+    for (const struct pollfd& pfd : pfds)
+    {
+        if (0 == (pfd.revents & (pfd.events | POLLHUP | POLLERR)))
+            continue;
+        std::unordered_map<int, Wait*>& waiting = (POLLOUT == pfd.events) ? writers : readers;
+        auto waiter = waiting.find(pfd.fd);
+        if (waiting.end() == waiter)
+            continue;
+        Wait* wait = waiter->second;
+        cancel(*wait);
+        wait->handle.resume();
+    }
+
+    Clock::time_point now = Clock::now();
+    while (!timers.empty() && timers.begin()->first <= now)
+    {
+        Wait* wait = timers.begin()->second;
+        cancel(*wait);
+        wait->expired = true;
+        wait->handle.resume();
+    }
+    return SUCCESS;
+}
+
+/**
+ * @brief Raises The Signal, Resumes Waiting Coroutine
+ */
+void Signal::set()
+{
+    raised = true;
+    if (nullptr == waiter)
+    {
+        return;
+    }
+    Scheduler::Wait* wait = waiter;
+    waiter = nullptr;
+    scheduler.cancel(*wait);
+    wait->handle.resume();
+}
+
+void Signal::Awaiter::await_suspend(std::coroutine_handle<> handle)
+{
+    wait.handle = handle;
+    signal.waiter = &wait;
+    if (Scheduler::Clock::time_point::max() != deadline)
+        signal.scheduler.arm(wait, deadline);
+}
+
+/**
+ * @brief Consumes The Signal
+ * @return True If Signal Came, False If Deadline Passed
+ */
+bool Signal::Awaiter::await_resume()
+{
+    if (&wait == signal.waiter)
+        signal.waiter = nullptr;
+    bool came = signal.raised;
+    signal.raised = false;
+    return came;
+}
@@ -0,0 +1,279 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      search_index.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Full-Text Index Over Received Messages.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           search_index.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Full-Text Index Over Received Messages.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cctype>
+#include <algorithm>
+#include "../include/search_index.hpp"
+/************************************************/
+/*                  Helpers                     */
+/************************************************/
+static constexpr size_t TERM_OVERHEAD       = 64;       //!< Hash Node And Bookkeeping of Single Term
+static constexpr size_t DOCUMENT_OVERHEAD   = 80;       //!< Deque Slot And Two String Headers
+static constexpr size_t COMPACT_THRESHOLD   = 256;      //!< Evicted Bytes Kept Before Compaction
+
+/**
+ * @brief Appends Unsigned LEB128 Varint
+ * @return Number of Written Bytes
+ */
+static size_t putVarint(std::vector<uint8_t>& out, uint64_t value)
+{
+    size_t length = 1;
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+        length++;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+    return length;
+}
+
+/**
+ * @brief Reads Unsigned LEB128 Varint
+ * @param offset Position, Moved Behind The Varint
+ */
+static uint64_t getVarint(const std::vector<uint8_t>& in, size_t& offset)
+{
+    uint64_t value = 0;
+    unsigned shift = 0;
+    while (offset < in.size())
+    {
+        uint8_t byte = in[offset++];
+        value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+        if (0 == (byte & 0x80))
+        {
+            break;
+        }
+        shift += 7;
+    }
+    return value;
+}
+
+/************************************************/
+/*                  Class                       */
+/************************************************/
+std::unordered_map<std::string, SearchIndex::PostingList_t> SearchIndex::terms;
+std::deque<SearchIndex::Document_t> SearchIndex::stored;
+uint64_t SearchIndex::firstDocument = 0;
+size_t SearchIndex::used = 0;
+size_t SearchIndex::cap = SEARCH_DEFAULT_MEMORY;
+
+/**
+ * @brief Sets Memory Cap, Evicts Oldest Messages Above It
+ * @param bytes Cap In Bytes, 0 Disables Indexing
+ */
+void SearchIndex::setMemoryCap(size_t bytes)
+{
+    cap = bytes;
+    while (used > cap && !stored.empty())
+    {
+        evictOldest();
+    }
+}
+
+/**
+ * @brief Indexes Received Message
+ * @param sender Display Name of Sender
+ * @param content Content of The Message
+ *
+ * Term Occurring More Times In One Message Is Posted Once.
+ */
+void SearchIndex::add(const std::string& sender, const std::string& content)
+{
+    if (0 == cap)
+    {
+        return;
+    }
+    const uint64_t document = firstDocument + stored.size();
+    stored.push_back({sender, content});
+    used += DOCUMENT_OVERHEAD + sender.size() + content.size();
+
+    std::vector<std::string> words;
+    tokenize(sender + ' ' + content, words);
+    for (const std::string& word : words)
+    {
+        auto found = terms.find(word);
+        if (terms.end() == found)
+        {
+            PostingList_t& list = terms[word];
+            list.first = document;
+            list.last = document;
+            list.count = 1;
+            used += TERM_OVERHEAD + word.size();
+            continue;
+        }
+        PostingList_t& list = found->second;
+        used += putVarint(list.deltas, document - list.last);
+        list.last = document;
+        list.count++;
+    }
+
+    while (used > cap && !stored.empty())
+    {
+        evictOldest();
+    }
+}
+
+/**
+ * @brief Evicts The Oldest Message And Its Postings
+ *
+ * The Oldest Message Is Always The First Posting of Each of Its Terms,
+ * So Its Terms Are Found Again By Tokenizing The Stored Text.
+ */
+void SearchIndex::evictOldest()
+{
+    const Document_t& oldest = stored.front();
+    std::vector<std::string> words;
+    tokenize(oldest.sender + ' ' + oldest.content, words);
+    for (const std::string& word : words)
+    {
+        auto found = terms.find(word);
+        if (terms.end() == found || firstDocument != found->second.first)
+        {
+            continue;
+        }
+        PostingList_t& list = found->second;
+        if (1 == list.count)
+        {
+            used -= TERM_OVERHEAD + word.size() + list.deltas.size() - list.head;
+            terms.erase(found);
+            continue;
+        }
+        size_t offset = list.head;
+        list.first += getVarint(list.deltas, offset);
+        used -= offset - list.head;
+        list.head = offset;
+        list.count--;
+        if (list.head >= COMPACT_THRESHOLD && list.head * 2 >= list.deltas.size())
+        {
+            list.deltas.erase(list.deltas.begin(), list.deltas.begin() + list.head);
+            list.head = 0;
+        }
+    }
+    used -= DOCUMENT_OVERHEAD + oldest.sender.size() + oldest.content.size();
+    stored.pop_front();
+    firstDocument++;
+}
+
+/**
+ * @brief Decodes Posting List
+ * @param list Posting List
+ * @param out Output, Message Numbers In Ascending Order
+ */
+void SearchIndex::decode(const PostingList_t& list, std::vector<uint64_t>& out)
+{
+    out.clear();
+    out.reserve(list.count);
+    uint64_t document = list.first;
+    out.push_back(document);
+    size_t offset = list.head;
+    while (offset < list.deltas.size())
+    {
+        document += getVarint(list.deltas, offset);
+        out.push_back(document);
+    }
+}
+
+/**
+ * @brief Splits Text Into Lowercase Alphanumeric Terms
+ * @param text Text To Split
+ * @param words Output, Unique Terms of Text
+ */
+void SearchIndex::tokenize(const std::string& text, std::vector<std::string>& words)
+{
+    words.clear();
+    std::string word;
+    for (size_t i = 0; i <= text.size(); i++)
+    {
+        unsigned char character = (i < text.size()) ? text[i] : ' ';
+        if (isalnum(character))
+        {
+            word.push_back(static_cast<char>(tolower(character)));
+        }
+        else if (!word.empty())
+        {
+            words.push_back(word);
+            word.clear();
+        }
+    }
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+}
+
+/**
+ * @brief Finds Messages Containing All Terms of Query
+ * @param query Terms Separated By Non-Alphanumeric Characters
+ * @param limit Maximum Number of Matches
+ *
+ * Lists Are Intersected From The Shortest One.
+ * @return Matches Ordered From The Newest
+ */
+std::vector<SearchIndex::Match_t> SearchIndex::search(const std::string& query, size_t limit)
+{
+    std::vector<Match_t> matches;
+    std::vector<std::string> words;
+    tokenize(query, words);
+    if (words.empty())
+    {
+        return matches;
+    }
+
+    std::vector<const PostingList_t*> lists;
+    for (const std::string& word : words)
+    {
+        auto found = terms.find(word);
+        if (terms.end() == found)
+        {
+            return matches;
+        }
+        lists.push_back(&found->second);
+    }
+    std::sort(lists.begin(), lists.end(),
+              [](const PostingList_t* a, const PostingList_t* b) { return a->count < b->count; });
+
+    std::vector<uint64_t> result;
+    std::vector<uint64_t> other;
+    decode(*lists[0], result);
+    for (size_t i = 1; i < lists.size() && !result.empty(); i++)
+    {
+        decode(*lists[i], other);
+        std::vector<uint64_t> both;
+        std::set_intersection(result.begin(), result.end(), other.begin(), other.end(), std::back_inserter(both));
+        result.swap(both);
+    }
+
+    for (auto it = result.rbegin(); it != result.rend() && matches.size() < limit; ++it)
+    {
+        const Document_t& document = stored[*it - firstDocument];
+        matches.push_back({*it, document.sender, document.content});
+    }
+    return matches;
+}
+
+/**
+ * @brief Drops All Messages And Postings
+ */
+void SearchIndex::clear()
+{
+    terms.clear();
+    stored.clear();
+    firstDocument = 0;
+    used = 0;
+}
@@ -0,0 +1,555 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      session.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Session Running As Coroutines On Shared Scheduler.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           session.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Session Running As Coroutines On Shared Scheduler.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include "../include/session.hpp"
+#include "../include/trace.hpp"
+/************************************************/
+/*                  Class                       */
+/************************************************/
+Session::Session(Scheduler& owner, const std::string& sessionName, const std::string& addr, int port, uint protocol, int connectTimeOut)
+    : Client(addr, port, protocol, connectTimeOut), scheduler(owner), wakeup(owner), halt(owner), progress(owner), name(sessionName)
+{
+}
+
+Session::~Session()
+{
+    // Coroutines Are Destroyed Before Base Class Closes The Socket
+}
+
+/**
+ * @brief Starts Coroutine Connecting To The Server, Returns At Once
+ *
+ * Coroutine Runs Until Its First co_await And Returns Here, Sessions Are
+ * Connected Concurrently While Scheduler Keeps Reading Input And Signals.
+ */
+void Session::start()
+{
+    receiving = establish();
+    receiving.start();
+}
+
+/**
+ * @brief Connects, Then Runs converse() And Keeps Receiving
+ *
+ * Session Given Up By drain() or leave() While Connecting Ends Without Failure.
+ */
+Task<> Session::establish()
+{
+    int connected = co_await connectToServer();
+    if (SUCCESS != connected)
+    {
+        const bool abandoned = closing || draining;
+        if (!abandoned && !name.empty())
+        {
+            reportError("Session Could Not Be Started");
+        }
+        finish(abandoned ? SUCCESS : CONNECT_FAILED);
+        co_return;
+    }
+    prepare();
+    conversing = converse();
+    conversing.start();
+    co_await receive();
+}
+
+/**
+ * @brief Resolves Server's Host Name And Connects Without Blocking The Scheduler
+ *
+ * Session Waits For Descriptor of Resolver Thread And For Writability of
+ * Each TCP Attempt, Both Bounded By Connect Timeout. All Addresses of Both
+ * Families Are Raced For TCP, For UDP They Are Kept In candidates.
+ * @return SUCCESS If The Session Is Ready, Otherwise CONNECT_FAILED
+ */
+Task<int> Session::connectToServer()
+{
+    /* Variables */
+    Resolver resolver;
+    std::vector<Resolver::Address_t> addresses;
+    const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(getConnectTimeOut());
+
+    /* Code */
+    racing.clear();
+    resolved = false;
+    if (SUCCESS != startResolution(resolver))
+    {
+        co_return CONNECT_FAILED;
+    }
+    resolving = watchResolver(resolver.getFd());
+    resolving.start();
+
+    while (!resolved && !closing && !draining && !finished)
+    {
+        bool signalled = co_await progress.wait(deadline);
+        if (!signalled)
+        {
+            break;
+        }
+    }
+    if (!resolved)
+    {
+        // Watcher Waits On Descriptor of The Resolver Which Is Left Here
+        resolving = Task<>();
+        if (!closing && !draining && !finished)
+        {
+            fprintf(stderr,"ERR: Connection To %s Timed Out\n", getServerAddress().c_str());
+        }
+        co_return CONNECT_FAILED;
+    }
+
+    if (SUCCESS != collectAddresses(resolver, addresses))
+    {
+        co_return CONNECT_FAILED;
+    }
+    if (!usesTcp())
+    {
+        co_return prepareCandidates(addresses);
+    }
+    int raced = co_await raceTcpConnect(addresses, deadline);
+    co_return raced;
+}
+
+/**
+ * @brief Races Staggered TCP Connection Attempts
+ * @param addresses Ordered Server's Addresses
+ * @param deadline Deadline For The Whole Connection
+ *
+ * New Attempt Is Started Every CONNECTION_ATTEMPT_DELAY Milliseconds Or
+ * Immediately When Previous Attempt Fails. First Established Connection Wins.
+ * @return SUCCESS If One of The Attempts Succeeded, Otherwise CONNECT_FAILED
+ */
+Task<int> Session::raceTcpConnect(const std::vector<Resolver::Address_t>& addresses, Clock::time_point deadline)
+{
+    /* Variables */
+    size_t nextAddress = 0;
+    size_t pending = 0;
+    int winner = NOT_CONNECTED;
+    size_t winnerAddress = 0;
+    int lastError = 0;
+    Clock::time_point nextAttemptAt = Clock::now();
+
+    /* Code */
+    while (NOT_CONNECTED == winner && !closing && !draining && !finished)
+    {
+        Clock::time_point now = Clock::now();
+
+        // Start Next Attempt When Its Time Comes
+        while (nextAddress < addresses.size() && now >= nextAttemptAt)
+        {
+            bool established = false;
+            int attemptSock = startAttempt(addresses[nextAddress], established);
+            nextAddress++;
+            nextAttemptAt = now + std::chrono::milliseconds(CONNECTION_ATTEMPT_DELAY);
+            if (NOT_CONNECTED == attemptSock)
+            {
+                lastError = errno;
+                nextAttemptAt = now;
+                continue;
+            }
+            if (established)
+            {
+                winner = attemptSock;
+                winnerAddress = nextAddress - 1;
+                break;
+            }
+            racing.push_back({attemptSock, nextAddress - 1, 0, false, Task<>()});
+            racing.back().watcher = watchAttempt(racing.size() - 1);
+            racing.back().watcher.start();
+            pending++;
+        }
+        if (NOT_CONNECTED != winner)
+            break;
+
+        // Collect Attempts Whose Sockets Became Writable
+        for (Attempt_t& attempt : racing)
+        {
+            if (!attempt.done || NOT_CONNECTED == attempt.sock)
+                continue;
+            if (0 == attempt.error)
+            {
+                winner = attempt.sock;
+                winnerAddress = attempt.address;
+                attempt.sock = NOT_CONNECTED;
+                break;
+            }
+            // Failed Attempt, Next One Starts Immediately
+            lastError = attempt.error;
+            close(attempt.sock);
+            attempt.sock = NOT_CONNECTED;
+            pending--;
+            nextAttemptAt = Clock::now();
+        }
+        if (NOT_CONNECTED != winner)
+            break;
+
+        if (0 == pending && nextAddress >= addresses.size())
+        {
+            fprintf(stderr,"ERR: Not Possible To Connect To %s: %s\n", getServerAddress().c_str(), strerror(lastError));
+            break;
+        }
+        if (Clock::now() >= deadline)
+        {
+            fprintf(stderr,"ERR: Connection To %s Timed Out\n", getServerAddress().c_str());
+            break;
+        }
+        if (nextAddress < addresses.size() && nextAttemptAt <= Clock::now())
+            continue;
+
+        Clock::time_point wakeUp = deadline;
+        if (nextAddress < addresses.size() && nextAttemptAt < wakeUp)
+            wakeUp = nextAttemptAt;
+        co_await progress.wait(wakeUp);
+    }
+
+    // Cancel Attempts Which Lost The Race
+    closeAttempts();
+    if (NOT_CONNECTED == winner)
+        co_return CONNECT_FAILED;
+    adoptConnection(winner, addresses[winnerAddress]);
+    co_return SUCCESS;
+}
+
+/**
+ * @brief Coroutine Waiting Until Resolver Thread Is Done
+ * @param fd Descriptor of The Resolver
+ */
+Task<> Session::watchResolver(int fd)
+{
+    co_await scheduler.readable(fd);
+    resolved = true;
+    progress.set();
+}
+
+/**
+ * @brief Coroutine Waiting Until Connect Attempt Ends
+ * @param index Index of The Attempt
+ *
+ * The Attempt Is Looked Up By Index, racing May Grow Meanwhile.
+ */
+Task<> Session::watchAttempt(size_t index)
+{
+    co_await scheduler.writable(racing[index].sock);
+    racing[index].error = attemptError(racing[index].sock);
+    racing[index].done = true;
+    progress.set();
+}
+
+/**
+ * @brief Stops Waiting For Attempts Still Connecting, Closes Their Sockets
+ *
+ * Watchers Which Already Ended Are Kept, One of Them May Still Be Running
+ * Its progress.set(). They Are Destroyed By Next Connect or stop().
+ */
+void Session::closeAttempts()
+{
+    for (Attempt_t& attempt : racing)
+    {
+        if (!attempt.done)
+        {
+            attempt.watcher = Task<>();
+        }
+        if (NOT_CONNECTED != attempt.sock)
+        {
+            close(attempt.sock);
+            attempt.sock = NOT_CONNECTED;
+        }
+    }
+}
+
+/**
+ * @brief Hands User's Line Routed To This Session To converse()
+ * @param line Line Without Session Prefix
+ *
+ * Line Waits In Queue While converse() Waits For REPLY or CONFIRM.
+ */
+void Session::handleLine(const std::string& line)
+{
+    if (finished || closing)
+    {
+        reportError("Session Is Closed");
+        return;
+    }
+    queuedInput.emplace(MessageMemory::pool());
+    queuedInput.back().readAndStoreContent(line.c_str());
+    queuedInput.back().traceMessage = Trace::currentMessage();
+    wakeup.set();
+}
+
+/**
+ * @brief Hands Line Or Structured Record of InputReader To converse()
+ * @param record Record With Its Trace Number
+ */
+void Session::handleRecord(const BaseMessages& record)
+{
+    if (finished || closing)
+    {
+        reportError("Session Is Closed");
+        return;
+    }
+    queuedInput.emplace(MessageMemory::pool());
+    queuedInput.back() = record;                                        // Fields Are Copied Into The Pool
+    wakeup.set();
+}
+
+/**
+ * @brief Says BYE Once Waiting Lines Are Processed
+ */
+void Session::requestLeave()
+{
+    leaveRequested = true;
+    wakeup.set();
+}
+
+/**
+ * @brief Starts Drain After Signal, BYE Follows The Last Waiting Line
+ *
+ * Waiting Lines Are Still Sent, JOIN Still Waits For Its REPLY. Sent File
+ * Stops, Connecting And Reconnect Waiting For Its Backoff Are Given Up.
+ */
+void Session::drain()
+{
+    draining = true;
+    fileSender.stop();
+    halt.set();
+    requestLeave();
+    progress.set();
+}
+
+/**
+ * @brief Drops Waiting Lines And Says BYE As Soon As Possible
+ *
+ * Datagram Sent Before This Call Is Not Waited For Anymore, ERR And BYE
+ * Sent After It Are Still Confirmed or Retransmitted.
+ */
+void Session::leave()
+{
+    closing = true;
+    hurried = true;
+    unsent += queuedInput.size();
+    dropQueued();
+    halt.set();
+    wakeup.set();
+    progress.set();
+}
+
+/**
+ * @brief Waits Until Condition Holds or Deadline Passes
+ * @param ready Condition, Checked Whenever wakeup Is Set
+ * @param deadline Time Limit, time_point::max() Waits Forever
+ *
+ * @return True If The Condition Holds
+ */
+Task<bool> Session::until(std::function<bool()> ready, Clock::time_point deadline)
+{
+    while (!ready())
+    {
+        bool signalled = co_await wakeup.wait(deadline);
+        if (!signalled)
+        {
+            co_return ready();
+        }
+    }
+    co_return true;
+}
+
+/**
+ * @brief Waits For Next User's Line or Line of Sent File
+ * @param record Destination of The Record
+ *
+ * Lines of Sent File Follow Waiting Lines After Authentication, So The
+ * Queue Does Not Grow With The File. After End of Input Waiting Lines And
+ * The Rest of The File Are Still Returned, Then False.
+ * @return False If The Conversation Has To End
+ */
+Task<bool> Session::nextRecord(BaseMessages& record)
+{
+    while (true)
+    {
+        // Named, So The Lambda Is Not Kept In Coroutine Frame
+        const std::function<bool()> ready = [this] { return finished || closing || leaveRequested || !queuedInput.empty() || fileReady(); };
+        co_await until(ready);
+        if (finished || closing)
+        {
+            co_return false;
+        }
+        if (!queuedInput.empty())
+        {
+            record = queuedInput.front();
+            queuedInput.pop();
+            co_return true;
+        }
+        if (!fileReady())
+        {
+            co_return false;
+        }
+
+        Trace::beginMessage(false);
+        Trace::Scope reading("file read");
+        if (fileSender.next(record.msg.content))
+        {
+            record.msg.type = BaseMessages::MSG;
+            record.msg.structured = true;
+            record.traceMessage = Trace::currentMessage();
+            co_return true;
+        }
+    }
+}
+
+/**
+ * @brief Copies Record Into User's Message, Keeps Current Display Name
+ * @param message User's Message Sent By converse()
+ * @param record Record Returned By nextRecord()
+ *
+ * Line Renamed After The Record Was Queued Still Goes Under The New Name,
+ * Only Structured AUTH Brings Its Own Display Name.
+ */
+void Session::takeRecord(BaseMessages& message, const BaseMessages& record)
+{
+    BaseMessages::DisplayName displayName = message.msg.displayName;
+    message.msg = record.msg;
+    message.traceMessage = record.traceMessage;
+    if (!message.msg.structured || BaseMessages::COMMAND_AUTH != message.msg.type)
+    {
+        message.msg.displayName = displayName;
+    }
+    Trace::resumeMessage(record.traceMessage, false);
+}
+
+/**
+ * @brief Waits For REPLY To AUTH or JOIN
+ *
+ * receive() Clears awaitingReply And Stores The Result. Server's ERR, BYE
+ * or Drain Deadline End The Waiting Too.
+ * @return True If The Server Accepted The Request
+ */
+Task<bool> Session::reply()
+{
+    const std::function<bool()> ready = [this] { return !awaitingReply || finished || closing; };
+    co_await until(ready);
+    Trace::endSpan("await REPLY", replyAwaitedSince, replyMessage, false);
+    if (awaitingReply)
+    {
+        awaitingReply = false;
+        co_return false;
+    }
+    co_return replyAccepted;
+}
+
+/**
+ * @brief Sleeps Until pacing Has Token For One Message And Takes It
+ *
+ * Sleep Is Timer of The Shared Scheduler, Other Sessions Run Meanwhile.
+ * While Reconnecting, Message Also Waits For The Rebuilt Session.
+ * @return False If The Session Ended Meanwhile
+ */
+Task<bool> Session::pace()
+{
+    while (true)
+    {
+        const std::function<bool()> ready = [this] { return !reconnecting || finished || closing; };
+        co_await until(ready);
+        co_await scheduler.sleepUntil(pacing.readyAt());
+        if (finished || (reconnecting && closing))
+        {
+            co_return false;
+        }
+        if (!reconnecting)
+        {
+            break;
+        }
+    }
+    pacing.take();
+    co_return true;
+}
+
+/**
+ * @brief Starts Span Measuring Wait For REPLY of Just Sent AUTH or JOIN
+ */
+void Session::markReplyAwaited()
+{
+    awaitingReply = true;
+    replyAwaitedSince = Trace::startSpan();
+    replyMessage = Trace::currentMessage();
+}
+
+/**
+ * @brief Returns Prefix of Output Lines of The Session
+ * @return "[name] ", Empty For The Only Session
+ */
+std::string Session::tag() const
+{
+    return name.empty() ? std::string() : "[" + name + "] ";
+}
+
+/**
+ * @brief Prints Error Tagged By Name of The Session
+ * @param text Error Description
+ */
+void Session::reportError(const std::string& text) const
+{
+    fprintf(stderr,"%sERR: %s\n", tag().c_str(), text.c_str());
+}
+
+/**
+ * @brief Reports Result of The Drain Before BYE Is Sent
+ */
+void Session::reportDrain() const
+{
+    if (0 != unsent)
+    {
+        fprintf(stderr,"%sERR: Drain Deadline Passed, %zu Messages Not Sent Or Not Confirmed\n", tag().c_str(), unsent);
+        return;
+    }
+    fprintf(stderr,"%sINFO: Queue Flushed, Sending BYE\n", tag().c_str());
+}
+
+void Session::dropQueued()
+{
+    while (!queuedInput.empty())
+    {
+        queuedInput.pop();
+    }
+}
+
+/**
+ * @brief Marks Session As Ended, Drops Waiting Lines And Wakes converse()
+ * @param code Exit Code, The First Failure Is Kept
+ */
+void Session::finish(int code)
+{
+    finished = true;
+    state = End;
+    if (SUCCESS == exitCode)
+    {
+        exitCode = code;
+    }
+    dropQueued();
+    halt.set();
+    wakeup.set();
+    progress.set();
+}
+
+void Session::stop()
+{
+    resolving = Task<>();
+    closeAttempts();
+    receiving = Task<>();
+    conversing = Task<>();
+    racing.clear();
+}
@@ -0,0 +1,343 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      session_mux.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Scheduler Loop Shared By Many Sessions.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           session_mux.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Scheduler Loop Shared By Many Sessions.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+#include "../include/session_mux.hpp"
+#include "../include/tcp_session.hpp"
+#include "../include/udp_session.hpp"
+#include "../include/renderer.hpp"
+#include "../include/trace.hpp"
+/************************************************/
+/*                  Class                       */
+/************************************************/
+/**
+ * @brief Reads Session File And Creates Sessions
+ * @param path Path of The Session File
+ * @param args Arguments With Timeouts, Retries And Socket Options
+ *
+ * Empty Lines And Lines Starting With '#' Are Skipped.
+ * @return SUCCESS If At Least One Session Was Created, Otherwise FAIL
+ */
+int SessionMux::load(const std::string& path, const arguments& args)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        fprintf(stderr,"ERR: Session File %s Could Not Be Opened\n", path.c_str());
+        return FAIL;
+    }
+
+    std::string line;
+    size_t lineNumber = 0;
+    while (std::getline(file, line))
+    {
+        lineNumber++;
+        std::istringstream fields(line);
+        std::string name, protocol, host, port, login, secret, displayName, channel;
+        if (!(fields >> name) || '#' == name[0])
+        {
+            continue;
+        }
+        fields >> protocol >> host >> port >> login >> secret >> displayName >> channel;
+        if (("tcp" != protocol && "udp" != protocol) || port.empty() || name.size() > LENGHT_SESSION_NAME ||
+            (!login.empty() && displayName.empty()) || sessions.size() != find(name))
+        {
+            fprintf(stderr,"ERR: Invalid Session On Line %zu of %s\n", lineNumber, path.c_str());
+            return FAIL;
+        }
+
+        int portNumber = std::stoi(port);
+        if ("tcp" == protocol)
+            sessions.emplace_back(new TcpSession(scheduler, name, host, portNumber, args.connectTimeOut));
+        else
+            sessions.emplace_back(new UdpSession(scheduler, name, host, portNumber, args.confirmRetriesUDP, args.confirmTimeOutUDP, args.connectTimeOut));
+        sessions.back()->setSocketOptions(args.socketOptions);
+        sessions.back()->setPacing(args.sendRate, args.sendBurst, args.retransmitsPaced);
+
+        startupLines.emplace_back();
+        if (!login.empty())
+            startupLines.back().push_back("/auth " + login + " " + secret + " " + displayName);
+        if (!channel.empty())
+            startupLines.back().push_back("/join " + channel);
+    }
+
+    if (sessions.empty())
+    {
+        fprintf(stderr,"ERR: No Session In %s\n", path.c_str());
+        return FAIL;
+    }
+    input.open(InputReader::TEXT, STDIN_FILENO);
+    return SUCCESS;
+}
+
+/**
+ * @brief Creates The Only Session From Command Line Arguments
+ * @param args Parsed Arguments
+ * @param format Format of Input Records
+ * @param fd Descriptor of Structured Input, STDIN Is Used For TEXT
+ *
+ * Session Has No Name, So Its Output Is Not Tagged And Input Is Not Routed.
+ * @return SUCCESS If The Session Was Created, Otherwise FAIL
+ */
+int SessionMux::add(const arguments& args, InputReader::Format_t format, int fd)
+{
+    if ("tcp" == args.transferProtocol)
+    {
+        TcpSession* session = new TcpSession(scheduler, "", args.hostName, args.port, args.connectTimeOut);
+        sessions.emplace_back(session);
+        session->setReconnect(args.reconnectAttempts, args.reconnectDelay);
+    }
+    else
+    {
+        UdpSession* session = new UdpSession(scheduler, "", args.hostName, args.port, args.confirmRetriesUDP, args.confirmTimeOutUDP, args.connectTimeOut);
+        sessions.emplace_back(session);
+        session->setKernelTimestamps(args.kernelTimestamps);
+    }
+    sessions.back()->setSocketOptions(args.socketOptions);
+    sessions.back()->setPacing(args.sendRate, args.sendBurst, args.retransmitsPaced);
+    if (!args.sendFile.empty() && SUCCESS != sessions.back()->sendFile(args.sendFile))
+    {
+        return FAIL;
+    }
+    startupLines.emplace_back();
+    input.open(format, (InputReader::TEXT == format) ? STDIN_FILENO : fd);
+    routed = false;
+    return SUCCESS;
+}
+
+/**
+ * @brief Finds Session By Name
+ * @param name Name of The Session
+ *
+ * @return Index of The Session, sessions.size() If There Is None
+ */
+size_t SessionMux::find(const std::string& name) const
+{
+    for (size_t idx = 0; idx < sessions.size(); idx++)
+    {
+        if (sessions[idx]->getName() == name)
+            return idx;
+    }
+    return sessions.size();
+}
+
+/**
+ * @brief Says BYE In Every Session
+ */
+void SessionMux::leaveAll()
+{
+    for (std::unique_ptr<Session>& session : sessions)
+    {
+        Renderer::setSession(session->getName());
+        session->leave();
+    }
+}
+
+/**
+ * @brief Hands Record To The Only Session, Or Routes Line By Its Prefix
+ * @param record Line or Structured Record With Its Trace Number
+ */
+void SessionMux::dispatch(const BaseMessages& record)
+{
+    if (!routed)
+    {
+        sessions.front()->handleRecord(record);
+        return;
+    }
+    std::string line(record.msg.buffer.begin(), record.msg.buffer.end());
+    while (!line.empty() && ('\r' == line.back() || '\n' == line.back()))
+    {
+        line.pop_back();
+    }
+    route(line);
+}
+
+/**
+ * @brief Routes Line To Session By Its Prefix
+ * @param line Line Without Line Ending
+ */
+void SessionMux::route(const std::string& line)
+{
+    size_t target = current;
+    std::string text = line;
+    if (!line.empty() && '@' == line[0])
+    {
+        size_t space = line.find(' ');
+        target = find(line.substr(1, space - 1));
+        if (sessions.size() == target)
+        {
+            fprintf(stderr,"ERR: Unknown Session %s\n", line.substr(1, space - 1).c_str());
+            return;
+        }
+        if (std::string::npos == space)
+        {
+            current = target;                                           // "@name" Alone Switches Default Session
+            return;
+        }
+        text = line.substr(space + 1);
+    }
+    Renderer::setSession(sessions[target]->getName());
+    sessions[target]->handleLine(text);
+}
+
+/**
+ * @brief Coroutine Reading Input And Dispatching Complete Records
+ *
+ * InputReader Reads By read(), Not By stdio, So No Line Stays Hidden In
+ * stdio Buffer While poll() Reports Nothing. On End of Input Each Session
+ * Says BYE After Its Waiting Lines.
+ */
+Task<> SessionMux::readInput()
+{
+    BaseMessages record;
+    while (true)
+    {
+        co_await scheduler.readable(input.getFd());
+        bool more = input.fill();
+        while (true)
+        {
+            Trace::beginMessage(false);
+            Trace::Scope decoding("stdin read");
+            InputReader::Result_t result = input.next(record.msg);
+            decoding.end();
+            if (InputReader::NONE == result)
+            {
+                break;
+            }
+            if (InputReader::INVALID == result)
+            {
+                fprintf(stderr,"ERR: Invalid Input Record Skipped\n");
+                continue;
+            }
+            record.traceMessage = Trace::currentMessage();
+            dispatch(record);
+        }
+        if (!more)
+        {
+            break;
+        }
+    }
+
+    for (std::unique_ptr<Session>& session : sessions)
+    {
+        Renderer::setSession(session->getName());
+        session->requestLeave();
+    }
+}
+
+/**
+ * @brief Coroutine Reading signalfd, Drains Sessions And Cuts The Drain Short
+ *
+ * The First Signal Closes Input, Every Session Sends Its Waiting Lines And
+ * Then BYE. When The Deadline Passes or Second Signal Comes, Sessions Drop
+ * What Is Left And Say BYE At Once.
+ */
+Task<> SessionMux::handleSignals()
+{
+    while (!signals.drainExpired())
+    {
+        Scheduler::Clock::time_point deadline = signals.isDraining() ? signals.getDeadline() : Scheduler::Clock::time_point::max();
+        bool readable = co_await scheduler.readable(signals.getFd(), deadline);
+        if (!readable)
+        {
+            continue;
+        }
+        bool wasDraining = signals.isDraining();
+        size_t queued = 0;
+        for (const std::unique_ptr<Session>& session : sessions)
+        {
+            queued += session->queuedRecords();
+        }
+        if (!signals.beginDrain(queued) || wasDraining)
+        {
+            continue;
+        }
+        reading = Task<>();
+        for (std::unique_ptr<Session>& session : sessions)
+        {
+            Renderer::setSession(session->getName());
+            session->drain();
+        }
+    }
+    leaveAll();
+}
+
+/**
+ * @brief Connects Sessions And Runs Scheduler Until All Sessions End
+ *
+ * Every Round Is One poll() Over Input, signalfd And Sockets of All
+ * Sessions, Its Timeout Is The Nearest Retransmission or Deadline.
+ * Signals Are Blocked Before Resolver Threads Start. Sessions Connect
+ * Concurrently On The Scheduler, Input And Signals Are Handled Meanwhile.
+ * @return Exit Code of The Only Session, With Session File SUCCESS Unless No Session Connected, Otherwise FAIL or CONNECT_FAILED
+ */
+int SessionMux::run()
+{
+    if (SUCCESS != signals.watchSignals())
+    {
+        return FAIL;
+    }
+    reading = readInput();
+    reading.start();
+    watching = handleSignals();
+    watching.start();
+    for (size_t idx = 0; idx < sessions.size(); idx++)
+    {
+        Renderer::setSession(sessions[idx]->getName());
+        sessions[idx]->start();
+        for (const std::string& line : startupLines[idx])
+        {
+            sessions[idx]->handleLine(line);
+        }
+    }
+    while (true)
+    {
+        bool active = false;
+        for (const std::unique_ptr<Session>& session : sessions)
+        {
+            active = active || !session->isFinished();
+        }
+        if (!active)
+        {
+            break;
+        }
+
+        if (FAIL == scheduler.runOnce() && EINTR != errno)
+        {
+            fprintf(stderr,"ERR: poll() Failed\n");
+            return FAIL;
+        }
+    }
+    Renderer::setSession("");
+    if (!routed)
+    {
+        return sessions.front()->getExitCode();
+    }
+    for (const std::unique_ptr<Session>& session : sessions)
+    {
+        if (CONNECT_FAILED != session->getExitCode())
+        {
+            return SUCCESS;
+        }
+    }
+    return CONNECT_FAILED;
+}
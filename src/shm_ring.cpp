@@ -0,0 +1,293 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      shm_ring.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Shared Memory Rings Exchanging Messages With Local Process.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           shm_ring.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Shared Memory Rings Exchanging Messages With Local Process.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <csignal>
+#include <cstring>
+#include <climits>
+#include <new>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include "../include/shm_ring.hpp"
+#include "../include/macros.hpp"
+/************************************************/
+/*                  Helpers                     */
+/************************************************/
+/**
+ * @brief Calls Futex Shared Between Processes
+ * @param word Futex Word In Shared Memory
+ * @param operation FUTEX_WAIT Or FUTEX_WAKE
+ * @param value Expected Value For Wait, Number of Woken Sleepers For Wake
+ */
+static void futex(std::atomic<uint32_t>& word, int operation, uint32_t value)
+{
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), operation, value, nullptr, nullptr, 0);
+}
+/************************************************/
+/*                  Ring                        */
+/************************************************/
+void ShmRing::attach(ShmRingHeader_t* ringHeader, uint8_t* ringData, size_t ringCapacity)
+{
+    header = ringHeader;
+    data = ringData;
+    capacity = ringCapacity;
+}
+
+/**
+ * @brief Makes Room For Record Body, Producer Side
+ * @param length Length of The Body
+ *
+ * Record Which Does Not Fit Before The End Starts At Offset 0, Zero Length
+ * Is Left At The Skipped End. Nothing Is Visible Before commit().
+ * @return Pointer To The Body, nullptr If The Ring Is Full
+ */
+uint8_t* ShmRing::reserve(size_t length)
+{
+    if (SHM_MAX_RECORD < length)
+    {
+        return nullptr;
+    }
+    size_t need = recordSize(length);
+    uint64_t position = header->head.load(std::memory_order_relaxed);
+    uint64_t released = header->tail.load(std::memory_order_acquire);
+    size_t offset = position & (capacity - 1);
+    size_t skipped = (capacity - offset < need) ? capacity - offset : 0;
+    if (capacity - (position - released) < skipped + need)
+    {
+        return nullptr;
+    }
+    if (0 != skipped)
+    {
+        data[offset] = 0;
+        data[offset + 1] = 0;
+        position += skipped;
+        offset = 0;
+    }
+    reservedAt = position;
+    data[offset] = static_cast<uint8_t>(length >> 8);
+    data[offset + 1] = static_cast<uint8_t>(length & 0xFF);
+    return data + offset + 2;
+}
+
+void ShmRing::commit(size_t length)
+{
+    publish(header->head, reservedAt + recordSize(length), header->dataWaiting);
+}
+
+/**
+ * @brief Finds Oldest Record, Consumer Side
+ * @param record Body of The Record, Valid Until release()
+ *
+ * Skipped End Is Released Here. Length Pointing Past Published Data Means
+ * Broken Producer, Everything Published Is Then Dropped.
+ * @return True If Record Is Available, Otherwise False
+ */
+bool ShmRing::peek(std::string_view& record)
+{
+    while (true)
+    {
+        uint64_t position = header->tail.load(std::memory_order_relaxed);
+        uint64_t published = header->head.load(std::memory_order_acquire);
+        if (position == published)
+        {
+            return false;
+        }
+        size_t offset = position & (capacity - 1);
+        size_t length = (static_cast<size_t>(data[offset]) << 8) | data[offset + 1];
+        if (0 == length)
+        {
+            publish(header->tail, position + (capacity - offset), header->spaceWaiting);
+            continue;
+        }
+        if (offset + recordSize(length) > capacity || published - position < recordSize(length))
+        {
+            fprintf(stderr,"ERR: Shared Ring Corrupted, %llu Bytes Dropped\n", static_cast<unsigned long long>(published - position));
+            publish(header->tail, published, header->spaceWaiting);
+            return false;
+        }
+        record = std::string_view(reinterpret_cast<const char*>(data + offset + 2), length);
+        return true;
+    }
+}
+
+void ShmRing::release(size_t length)
+{
+    publish(header->tail, header->tail.load(std::memory_order_relaxed) + recordSize(length), header->spaceWaiting);
+}
+
+/**
+ * @brief Sleeps Until Producer Publishes Beyond Position Or Ring Is Closed
+ * @param seen Position of head Already Handled
+ *
+ * Flag Is Raised Before head Is Checked Again, Producer Raising head Meanwhile
+ * Sees The Flag And Wakes The Futex.
+ */
+void ShmRing::waitForData(uint64_t seen)
+{
+    header->dataWaiting.store(1, std::memory_order_seq_cst);
+    if (seen == header->head.load(std::memory_order_seq_cst) && 0 == header->closed.load(std::memory_order_seq_cst))
+    {
+        futex(header->dataWaiting, FUTEX_WAIT, 1);
+    }
+}
+
+void ShmRing::close()
+{
+    header->closed.store(1, std::memory_order_seq_cst);
+    header->dataWaiting.store(0, std::memory_order_seq_cst);
+    header->spaceWaiting.store(0, std::memory_order_seq_cst);
+    futex(header->dataWaiting, FUTEX_WAKE, INT_MAX);
+    futex(header->spaceWaiting, FUTEX_WAKE, INT_MAX);
+}
+
+/**
+ * @brief Stores Position And Wakes Other Side If It Sleeps On Its Futex
+ * @param position head Or tail
+ * @param value New Position
+ * @param waiting Futex Word of The Other Side
+ */
+void ShmRing::publish(std::atomic<uint64_t>& position, uint64_t value, std::atomic<uint32_t>& waiting)
+{
+    position.store(value, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (0 != waiting.load(std::memory_order_relaxed) && 0 != waiting.exchange(0))
+    {
+        futex(waiting, FUTEX_WAKE, INT_MAX);
+    }
+}
+/************************************************/
+/*                  Link                        */
+/************************************************/
+ShmLinkHeader_t* ShmLink::link = nullptr;
+size_t ShmLink::mappedSize = 0;
+std::string ShmLink::objectName;
+ShmRing ShmLink::inboundRing;
+ShmRing ShmLink::outboundRing;
+int ShmLink::wakeFd = -1;
+std::thread ShmLink::worker;
+std::atomic<bool> ShmLink::stopping{false};
+
+/**
+ * @brief Creates /name Shared Object And Starts Bridge Thread
+ * @param name Name of The Object, Without Leading Slash
+ *
+ * Object Left By Crashed Client Is Replaced. Closed By atexit(), Because
+ * Client Leaves Thru exit() On Many Places.
+ * @return SUCCESS If Both Rings Are Ready, Otherwise FAIL
+ */
+int ShmLink::open(const std::string& name)
+{
+    objectName = "/" + name;
+    shm_unlink(objectName.c_str());
+    int fd = shm_open(objectName.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    if (-1 == fd)
+    {
+        fprintf(stderr,"ERR: Shared Memory %s Could Not Be Created\n", objectName.c_str());
+        return FAIL;
+    }
+    mappedSize = SHM_DATA_OFFSET + 2 * SHM_RING_CAPACITY;
+    void* map = (0 == ftruncate(fd, mappedSize)) ? mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+    ::close(fd);
+    wakeFd = (MAP_FAILED != map) ? eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK) : -1;
+    if (-1 == wakeFd)
+    {
+        fprintf(stderr,"ERR: Shared Memory %s Could Not Be Mapped\n", objectName.c_str());
+        if (MAP_FAILED != map)
+            munmap(map, mappedSize);
+        shm_unlink(objectName.c_str());
+        return FAIL;
+    }
+
+    link = new (map) ShmLinkHeader_t();
+    link->version = SHM_LINK_VERSION;
+    link->capacity = SHM_RING_CAPACITY;
+    link->ownerPid = static_cast<uint32_t>(getpid());
+    uint8_t* base = static_cast<uint8_t*>(map);
+    inboundRing.attach(&link->inbound, base + SHM_DATA_OFFSET, SHM_RING_CAPACITY);
+    outboundRing.attach(&link->outbound, base + SHM_DATA_OFFSET + SHM_RING_CAPACITY, SHM_RING_CAPACITY);
+
+    stopping = false;
+    sigset_t all, previous;
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &previous);           // Signals Go To Main Thread
+    worker = std::thread(bridge);
+    pthread_sigmask(SIG_SETMASK, &previous, nullptr);
+
+    // Peer Waits For Magic, Everything Above Is Visible Before It
+    std::atomic_thread_fence(std::memory_order_release);
+    memcpy(link->magic, SHM_LINK_MAGIC, sizeof(SHM_LINK_MAGIC));
+    atexit(ShmLink::close);
+    fprintf(stderr,"INFO: Shared Rings Ready At %s, %zu KiB Each\n", objectName.c_str(), SHM_RING_CAPACITY / 1024);
+    return SUCCESS;
+}
+
+/**
+ * @brief Closes Rings, Joins Bridge Thread And Removes The Object
+ *
+ * Peer Sees closed Set On Both Rings, Mapping It Holds Stays Valid.
+ */
+void ShmLink::close()
+{
+    if (nullptr == link)
+    {
+        return;
+    }
+    stopping = true;
+    inboundRing.close();
+    outboundRing.close();
+    if (worker.joinable())
+    {
+        worker.join();
+    }
+    munmap(link, mappedSize);
+    link = nullptr;
+    shm_unlink(objectName.c_str());
+    ::close(wakeFd);
+    wakeFd = -1;
+}
+
+/**
+ * @brief Body of Bridge Thread
+ *
+ * eventfd Is Signalled Once For Every Batch Published While The Network
+ * Loop Still Has Records, Then The Thread Sleeps Until head Moves Again.
+ */
+void ShmLink::bridge()
+{
+    uint64_t signalled = 0;
+    while (!stopping)
+    {
+        uint64_t published = inboundRing.head();
+        if (published != signalled && !inboundRing.isEmpty())
+        {
+            uint64_t one = 1;
+            ssize_t bytesTx = write(wakeFd, &one, sizeof(one));
+            (void)bytesTx;
+            signalled = published;
+        }
+        inboundRing.waitForData(published);
+    }
+}
@@ -0,0 +1,93 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      signal_drain.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements SIGINT And SIGTERM Read From signalfd And Drain Deadline.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           signal_drain.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements SIGINT And SIGTERM Read From signalfd And Drain Deadline.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <pthread.h>
+#include <sys/signalfd.h>
+#include <unistd.h>
+#include "../include/signal_drain.hpp"
+#include "../include/macros.hpp"
+/************************************************/
+/*                  Class                       */
+/************************************************/
+SignalDrain::~SignalDrain()
+{
+    if (-1 != signalFd)
+    {
+        close(signalFd);
+    }
+}
+
+/**
+ * @brief Blocks SIGINT And SIGTERM And Opens signalfd Receiving Them
+ *
+ * Handler Would Interrupt The Loop In The Middle of Sending, Signal Read
+ * From signalfd Is Handled Between Two Events Like Any Other Descriptor.
+ * @return SUCCESS If signalfd Is Open, Otherwise FAIL
+ */
+int SignalDrain::watchSignals()
+{
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGINT);
+    sigaddset(&mask, SIGTERM);
+    if (0 != pthread_sigmask(SIG_BLOCK, &mask, nullptr))
+    {
+        fprintf(stderr,"ERR: Signals Could Not Be Blocked\n");
+        return FAIL;
+    }
+    signalFd = signalfd(-1, &mask, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (-1 == signalFd)
+    {
+        fprintf(stderr,"ERR: signalfd() Failed: %s\n", strerror(errno));
+        return FAIL;
+    }
+    return SUCCESS;
+}
+
+bool SignalDrain::beginDrain(size_t queued)
+{
+    struct signalfd_siginfo info;
+    if (sizeof(info) != read(signalFd, &info, sizeof(info)))
+    {
+        return false;
+    }
+    auto now = Clock::now();
+    if (draining)
+    {
+        fprintf(stderr,"INFO: %s Again, Sending BYE Now\n", strsignal(info.ssi_signo));
+        drainDeadline = now;
+        return true;
+    }
+
+    draining = true;
+    drainDeadline = now + std::chrono::milliseconds(drainTimeout);
+    fprintf(stderr,"INFO: %s, Input Closed, Flushing %zu Queued Messages Before BYE (Deadline %u ms)\n",
+            strsignal(info.ssi_signo), queued, drainTimeout);
+    return true;
+}
+
+bool SignalDrain::drainExpired() const
+{
+    return draining && Clock::now() >= drainDeadline;
+}
@@ -0,0 +1,142 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      socket_options.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Socket Tuning Profiles.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           socket_options.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Socket Tuning Profiles.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/ip.h>
+#include <netinet/tcp.h>
+#include "../include/socket_options.hpp"
+#include "../include/macros.hpp"
+/************************************************/
+/*                  Constants                   */
+/************************************************/
+static constexpr int THROUGHPUT_BUFFER      = 4 * 1024 * 1024;  //!< Socket Buffers of Throughput Profile
+static constexpr int THROUGHPUT_LOWAT       = 128 * 1024;       //!< Unsent Data Limit of Throughput Profile
+
+/************************************************/
+/*                  Functions                   */
+/************************************************/
+/**
+ * @brief Sets Option If Requested, Reads It Back And Logs Both Values
+ * @param fd Socket
+ * @param level Level of The Option
+ * @param name Name of The Option
+ * @param label Name Printed To Log
+ * @param value Requested Value or OPTION_UNSET
+ */
+static void setAndReport(int fd, int level, int name, const char* label, int value)
+{
+    if (OPTION_UNSET == value)
+    {
+        return;
+    }
+    if (0 != setsockopt(fd, level, name, &value, sizeof(value)))
+    {
+        fprintf(stderr,"ERR: %s Not Applied: %s\n", label, strerror(errno));
+        return;
+    }
+    int applied = 0;
+    socklen_t len = sizeof(applied);
+    getsockopt(fd, level, name, &applied, &len);
+    fprintf(stderr,"INFO: %s Requested %d Applied %d%s\n", label, value, applied,
+            (applied < value) ? " (Clamped By Kernel)" : "");
+}
+
+/**
+ * @brief Fills Options Of The Selected Profile
+ * @param options Options With Profile Name, Explicitly Set Options Are Kept
+ *
+ * No Profile Sets TCP_CORK, Corked Socket Holds Every Partial Segment Until
+ * Kernel's 200 ms Limit, Which Would Delay Each Chat Message. Only Explicit
+ * --cork Applies It.
+ * @return SUCCESS If The Profile Is Known, Otherwise FAIL
+ */
+int resolveSocketProfile(SocketOptions_t& options)
+{
+    auto preset = [](int& option, int value) { if (OPTION_UNSET == option) option = value; };
+
+    if (options.profile.empty() || "custom" == options.profile)
+    {
+        return SUCCESS;
+    }
+    if ("latency" == options.profile)
+    {
+        preset(options.noDelay, 1);
+        preset(options.quickAck, 1);
+        preset(options.tos, IPTOS_LOWDELAY);
+        return SUCCESS;
+    }
+    if ("throughput" == options.profile)
+    {
+        preset(options.sendBuffer, THROUGHPUT_BUFFER);
+        preset(options.recvBuffer, THROUGHPUT_BUFFER);
+        preset(options.notSentLowat, THROUGHPUT_LOWAT);
+        preset(options.tos, IPTOS_THROUGHPUT);
+        return SUCCESS;
+    }
+    return FAIL;
+}
+
+/**
+ * @brief Applies Options To The Socket And Logs Values Read Back From Kernel
+ * @param fd Socket
+ * @param family Address Family of The Socket
+ * @param stream True For TCP Socket, TCP Level Options Are Skipped Otherwise
+ * @param options Options To Apply
+ */
+void applySocketOptions(int fd, int family, bool stream, const SocketOptions_t& options)
+{
+    if (options.profile.empty())
+    {
+        return;
+    }
+    setAndReport(fd, SOL_SOCKET, SO_SNDBUF, "SO_SNDBUF", options.sendBuffer);
+    setAndReport(fd, SOL_SOCKET, SO_RCVBUF, "SO_RCVBUF", options.recvBuffer);
+    if (AF_INET6 == family)
+        setAndReport(fd, IPPROTO_IPV6, IPV6_TCLASS, "IPV6_TCLASS", options.tos);
+    else
+        setAndReport(fd, IPPROTO_IP, IP_TOS, "IP_TOS", options.tos);
+
+    if (!stream)
+    {
+        return;
+    }
+    setAndReport(fd, IPPROTO_TCP, TCP_NODELAY, "TCP_NODELAY", options.noDelay);
+    setAndReport(fd, IPPROTO_TCP, TCP_QUICKACK, "TCP_QUICKACK", options.quickAck);
+    setAndReport(fd, IPPROTO_TCP, TCP_NOTSENT_LOWAT, "TCP_NOTSENT_LOWAT", options.notSentLowat);
+    setAndReport(fd, IPPROTO_TCP, TCP_CORK, "TCP_CORK", options.cork);
+}
+
+/**
+ * @brief Re-Arms TCP_QUICKACK Which Kernel Clears After Delayed ACK
+ * @param fd Socket
+ * @param options Applied Options
+ */
+void rearmQuickAck(int fd, const SocketOptions_t& options)
+{
+    if (1 == options.quickAck)
+    {
+        int value = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_QUICKACK, &value, sizeof(value));
+    }
+}
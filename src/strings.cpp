@@ -26,40 +26,51 @@
  * @return True If The Content Of Vector And String Are The Same, Otherwise False
 */
 
-bool compareVectorAndString(const std::vector<char>& vec, const std::string& str) 
+bool compareVectorAndString(const CharBuffer& vec, const std::string& str) 
 {
-    std::string vecAsString(vec.begin(), vec.end());
-    return vecAsString == str;
+    return vec.size() == str.size() && std::equal(vec.begin(), vec.end(), str.begin());
 }
 
-bool areAllDigitsOrLettersOrDash(const std::vector<char>& vec) {
+bool areAllDigitsOrLettersOrDash(std::string_view vec) {
     return std::all_of(vec.begin(), vec.end(), [](char c) { 
         return std::isdigit(c) || std::isalpha(c) || c == '-'; 
     });
 }
-bool areAllDigitsOrLettersOrDashOrDot(const std::vector<char>& vec) {
+bool areAllDigitsOrLettersOrDashOrDot(std::string_view vec) {
     return std::all_of(vec.begin(), vec.end(), [](char c) { 
         return std::isdigit(c) || std::isalpha(c) || c == '-'|| c == '.'; 
     });
 }
-bool areAllPrintableCharacters(const std::vector<char>& vec) 
+bool areAllPrintableCharacters(std::string_view vec) 
 {
     return std::all_of(vec.begin(), vec.end(), [](char c) { return c >= 0x21 && c <= 0x7E; });
 }
 
-bool areAllPrintableCharactersOrSpace(const std::vector<char>& vec) 
+bool areAllPrintableCharactersOrSpace(const CharBuffer& vec) 
 {
-    return std::all_of(vec.begin(), vec.end(), [](char c) { return c >= 0x20 && c <= 0x7E; });
+    return areAllPrintableCharactersOrSpace(std::string_view(vec.data(), vec.size()));
 }
 
+bool areAllPrintableCharactersOrSpace(std::string_view text) 
+{
+    return std::all_of(text.begin(), text.end(), [](char c) { return c >= 0x20 && c <= 0x7E; });
+}
 
-std::string convertToString(const std::vector<char>& inputVector)
+
+std::string convertToString(const CharBuffer& inputVector)
 {   
 // Vytvoření stringu z vektoru
 return std::string(inputVector.begin(), inputVector.end());
 }
 
-bool compare(const std::vector<char>& vec, const std::string& pattern) {
+bool compare(const CharBuffer& vec, const std::string& pattern) {
+    // "^literal" Is Matched As Prefix In Place, No Copy And No Regex Compilation
+    if (!pattern.empty() && '^' == pattern[0] && std::string::npos == pattern.find_first_of(".[]{}()*+?|\\$^", 1))
+    {
+        size_t length = pattern.size() - 1;
+        return vec.size() >= length && std::equal(pattern.begin() + 1, pattern.end(), vec.begin());
+    }
+
     std::string str(vec.begin(), vec.end());
     std::regex regexPattern(pattern);
 
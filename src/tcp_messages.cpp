@@ -20,194 +20,171 @@
 /*                  Libraries                   */
 /************************************************/
 #include "../include/tcp_messages.hpp"
+#include "../include/protocol_schema.hpp"
+#include "../include/capture.hpp"
+#include "../include/trace.hpp"
+#include "../include/probe.hpp"
 /************************************************/
 /*                  Class                       */
 /************************************************/
 
 TcpMessages::TcpMessages() : BaseMessages() {}
 
+TcpMessages::TcpMessages(std::pmr::memory_resource* resource) : BaseMessages(resource) {}
+
+/**
+ * @brief Sends Message To The Server
+ * @param clientSocket Client Socket
+ * @param msgToSend Message Terminated By \r\n
+ * @param unsent Bytes The Socket Did Not Take Yet, msgToSend Queues Behind Them
+ *
+ * Socket Is Non-Blocking, Part The Kernel Did Not Take Is Kept In unsent
+ * And Sent By flush() Once The Socket Is Writable.
+ */
+void TcpMessages::transmit(int clientSocket, const std::string& msgToSend, std::string& unsent)
+{
+    Trace::Scope sending("send");
+    PROBE(SEND);
+    unsent += msgToSend;
+    flush(clientSocket, unsent);
+    sending.end();
+    PROBE_END(SEND);
+}
+
+/**
+ * @brief Sends Bytes Waiting For Non-Blocking Socket, Keeps What It Did Not Take
+ * @param clientSocket Client Socket
+ * @param unsent Bytes The Socket Did Not Take Yet
+ *
+ * Every Segment Leaves Thru This Function, So It Is Also Captured Here.
+ * Bytes of Failed Connection Are Dropped, The Drop Is Seen By recv().
+ * @return SUCCESS If The Socket Took Bytes or Was Full, FAIL If The Connection Failed
+ */
+int TcpMessages::flush(int clientSocket, std::string& unsent)
+{
+    ssize_t bytesTx = send(clientSocket, unsent.data(), unsent.size(), MSG_NOSIGNAL);       // Dropped Connection Is Seen By recv(), Not Killed By SIGPIPE
+    if (bytesTx < 0) {
+        if (EAGAIN == errno || EWOULDBLOCK == errno)
+            return SUCCESS;
+        std::perror("ERROR: send");
+        unsent.clear();
+        return FAIL;
+    }
+    Capture::record(Capture::OUTBOUND, unsent.data(), bytesTx);
+    unsent.erase(0, bytesTx);
+    return SUCCESS;
+}
+
 /**
 * @brief Sends Authentication Message.
 * @param client_socket Client Socket
+* @param unsent Bytes The Socket Did Not Take Yet
 * @return None
 */
-void TcpMessages::sendAuthMessage(int client_socket)
+void TcpMessages::sendAuthMessage(int client_socket, std::string& unsent)
 {
-    std::string msgToSend = "AUTH " + std::string(msg.login.begin(), msg.login.end()) + " AS " + std::string(msg.displayName.begin(), msg.displayName.end()) + " USING " + std::string(msg.secret.begin(), msg.secret.end()) + "\r\n";
-    ssize_t bytesTx = send(client_socket, msgToSend.c_str(), msgToSend.length(), 0);
-    if (bytesTx < 0) {
-        std::perror("ERROR: sendto");
-    }
+    Trace::Scope serializing("serialize");
+    PROBE(SERIALIZE);
+    std::string msgToSend;
+    TextCodec::encode<COMMAND_AUTH>(msg, WireHeader_t(), msgToSend);
+    serializing.end();
+    PROBE_END(SERIALIZE);
+    transmit(client_socket, msgToSend, unsent);
+    recordSent(COMMAND_AUTH);
 }
 
 
 /**
- * @brief Checks If Incomming Message Includes Join Pattern.
- * 
- * @return Returns BaseMessages::SUCCESS If Everything Went Well Otherwise Returns BaseMessages::JOIN_FAILED
+ * @brief Checks If Incomming Message Is REPLY To JOIN Or Message From Server
+ * @param accepted Set To Result of REPLY
+ *
+ * Line Is Decoded Once Thru Keyword Table of TextCodec, Message Coming
+ * Before REPLY Is Printed.
+ * @return SUCCESS For REPLY Or Valid Message, Otherwise JOIN_FAILED
 */
-int TcpMessages::checkJoinReply() 
+int TcpMessages::checkJoinReply(bool& accepted)
 {
-    const std::string joinServerMsg(msg.buffer.begin(), msg.buffer.end());
-    const std::string prefix = "^MSG FROM Server IS ";
-    const std::string stdPrefixLenght = "MSG FROM Server IS ";
-    const std::string errPrefixLenght = "ERR FROM Server IS ";
-    const std::string replyOkPrefix = "REPLY OK IS ";
-    const std::string replyNokPrefix = "REPLY OK IS "; 
-    
-    /* Reply Join OK */
-    if (compare(msg.buffer,"^REPLY OK IS "))
+    WireHeader_t header;
+    msg.content.clear();
+    msg.displayNameOutside.clear();
+    MessageType_t type = TextCodec::decode(msg.buffer, msg, header);
+    if (REPLY == type)
     {
-        if (msg.buffer.size() >= 2 && msg.buffer[msg.buffer.size() - 2] == '\r' && msg.buffer[msg.buffer.size() - 1] == '\n') 
-        {
-            StoreDisplayNameAndContent();  
-            std::string replyContent(msg.content.begin(), msg.content.end());
-            fprintf(stdout,"Success: %s\n", replyContent.c_str());
-            msg.type = REPLY;
-            msg.displayNameOutside.clear();
-            msg.content.clear();
-            return SUCCESS;
-        }
+        accepted = header.result;
+        if (accepted)
+            PrintServerOkReply();
+        else
+            PrintServerNokReply();
+        msg.displayNameOutside.clear();
+        msg.content.clear();
+        return SUCCESS;
     }
-    if (compare(msg.buffer,"^REPLY NOK IS "))
+    if (MSG == type && SUCCESS == checkLength())
     {
-        if (msg.buffer.size() >= 2 && msg.buffer[msg.buffer.size() - 2] == '\r' && msg.buffer[msg.buffer.size() - 1] == '\n') 
-        {
-            StoreDisplayNameAndContent();  
-            std::string replyContent(msg.content.begin(), msg.content.end());
-            fprintf(stdout,"Failure: %s\n", replyContent.c_str());
-            msg.displayNameOutside.clear();
-            msg.content.clear();
-            msg.type = REPLY;
-            return SUCCESS;
-        }
-    }
-
-    /* Catch Messages From Server */
-    if (compare(msg.buffer, "^MSG FROM ")) {
-        if (msg.buffer.size() >= stdPrefixLenght.length()) 
-        {
-            parseMessage();
-            printMessage();
-            msg.type = MSG;
-            return SUCCESS;
-        }
+        printMessage();
+        return SUCCESS;
     }
-    /* Join Confirmed */
     return JOIN_FAILED;
 }
 
 /**
  * @brief Sends 'Join' Message
  * @param client_socket Client Socket
+ * @param unsent Bytes The Socket Did Not Take Yet
  * 
  * Sends 'Join' Message
  * @return None
 */
-void TcpMessages::sendJoinMessage(int client_socket)
+void TcpMessages::sendJoinMessage(int client_socket, std::string& unsent)
 {
-    std::string msgToSend = "JOIN " + std::string(msg.channelID.begin(), msg.channelID.end()) + " AS " + std::string(msg.displayName.begin(), msg.displayName.end()) + "\r\n";
-    ssize_t bytesTx = send(client_socket, msgToSend.c_str(), msgToSend.length(), 0);
-    if (bytesTx < 0) {
-        std::perror("ERROR: sendto");
-    }
+    Trace::Scope serializing("serialize");
+    PROBE(SERIALIZE);
+    std::string msgToSend;
+    TextCodec::encode<COMMAND_JOIN>(msg, WireHeader_t(), msgToSend);
+    serializing.end();
+    PROBE_END(SERIALIZE);
+    transmit(client_socket, msgToSend, unsent);
+    recordSent(COMMAND_JOIN);
 }
 
 /**
  * @brief Sends 'Bye' Message
  * @param clientSocket Client Socket
- * @param buffer Buffer
+ * @param unsent Bytes The Socket Did Not Take Yet
  * 
  * Sends 'Bye' Message
  * @return None
 */
-void TcpMessages::sentByeMessage(int clientSocket)
+void TcpMessages::sentByeMessage(int clientSocket, std::string& unsent)
 {
-    std::string msgToSend = "BYE\r\n"; 
-    ssize_t bytesTx = send(clientSocket, msgToSend.c_str(), msgToSend.length(), 0);
-    if (bytesTx < 0)
-        perror("ERROR in sendto");
+    std::string msgToSend;
+    TextCodec::encode<COMMAND_BYE>(msg, WireHeader_t(), msgToSend);
+    transmit(clientSocket, msgToSend, unsent);
+    recordSent(COMMAND_BYE);
 
 }
 
 /**
  * @brief Sends User's Message To Server
  * @param clientSocket Client Socket
+ * @param unsent Bytes The Socket Did Not Take Yet
  * 
  * Sends User's Message To Server
  * @return None
 */
-void TcpMessages::sentUsersMessage(int clientSocket)
+void TcpMessages::sentUsersMessage(int clientSocket, std::string& unsent)
 {
-    std::string msgToSend = "MSG FROM " + std::string(msg.displayName.begin(), msg.displayName.end()) + " IS " + std::string(msg.content.begin(), msg.content.end()) + "\r\n";
-    ssize_t bytesTx = send(clientSocket, msgToSend.c_str(), msgToSend.length(), 0);
-    if (bytesTx < 0)
-        perror("ERROR in sendto");
+    Trace::Scope serializing("serialize");
+    PROBE(SERIALIZE);
+    std::string msgToSend;
+    TextCodec::encode<MSG>(msg, WireHeader_t(), msgToSend);
+    serializing.end();
+    PROBE_END(SERIALIZE);
+    transmit(clientSocket, msgToSend, unsent);
+    recordSent(MSG, std::string(msg.content.begin(), msg.content.end()));
 }
 
-int TcpMessages::checkIfErrorOrBye(int clientSocket)
-{
-    size_t idx = 0;
-    std::regex msgIsRegex("^IS");
-
-    /* HAS TO BE CLEANED -> WILL BE MODIFIED */
-    msg.content.clear(); 
-    msg.displayNameOutside.clear();
-
-    if (msg.buffer.size() >= 9 && compare(msg.buffer, "^ERR FROM "))
-    {
-        // Erase "ERR FROM " 
-        msg.buffer.erase(msg.buffer.begin(), msg.buffer.begin() + 9);
-
-        // Get Display Name
-        while (idx < msg.buffer.size() && msg.buffer[idx] != '\n' && msg.buffer[idx] != '\r') 
-        {
-            std::string currentSubStr(msg.buffer.begin() + idx, msg.buffer.end());
-            if (std::regex_search(currentSubStr, msgIsRegex)) {
-                break; // Exit the loop if "IN" is found at the beginning of the current substring
-            }
-            msg.displayNameOutside.push_back(msg.buffer[idx]);
-            idx++;
-        }
-
-        // Check and Remove the Last Character if Needed (It's a Space)
-        if (!msg.displayNameOutside.empty()) 
-        {
-            msg.displayNameOutside.pop_back();
-        }
-        /* Process The Content */
-        int isPlusSpace = 3;                                                    // 1. Get Rid of "IS "
-        msg.buffer.erase(msg.buffer.begin(), msg.buffer.begin() + idx + isPlusSpace);
-
-        /* Get Content */
-        idx = 0;
-        while (idx < msg.buffer.size() && msg.buffer[idx] != '\n' && msg.buffer[idx] != '\r') 
-        {
-            msg.content.push_back(msg.buffer[idx]);   
-            idx++;
-        }
-        msg.type = ERROR;
-        /* SEND BYE */
-        sentByeMessage(clientSocket);
-        /* PRINT ERROR MESSAGE */
-        basePrintExternalError();
-        exit(EXTERNAL_ERROR);            
-
-    }
-    else if (msg.buffer.size() < 6 && compare(msg.buffer, "^BYE\r\n"))
-    {
-        
-        while (idx < msg.buffer.size() && msg.buffer[idx] != '\n' && msg.buffer[idx] != '\r') 
-        {
-            msg.content.push_back(msg.buffer[idx]);   
-            idx++;
-        }
-        exit(SUCCESS);
-    }
-    return SUCCESS;
-}
-
-void TcpMessages::sendErrorMessage(int clientSocket, MessageType_t type)
+void TcpMessages::sendErrorMessage(int clientSocket, MessageType_t type, std::string& unsent)
 {
     /* Variables */
     std::string errContent;
@@ -220,96 +197,41 @@ void TcpMessages::sendErrorMessage(int clientSocket, MessageType_t type)
     else
         errContent = "Unknown Error";
 
-    std::string msgToSend = "ERR FROM " + std::string(msg.displayName.begin(), msg.displayName.end()) + " IS " +  errContent + "\r\n";
-    ssize_t bytesTx = send(clientSocket, msgToSend.c_str(), msgToSend.length(), 0);
-    if (bytesTx < 0)
-        perror("ERROR in sendto");        
+    Message_t error(msg);
+    error.content.assign(errContent.begin(), errContent.end());
+    std::string msgToSend;
+    TextCodec::encode<ERROR>(error, WireHeader_t(), msgToSend);
+    transmit(clientSocket, msgToSend, unsent);
+    recordSent(ERROR, errContent);
 }
 
 /**
  * @brief Handles Reply From Server
- * 
- * @return 0 If The Reply Is OK, -1 If The Reply Is Not OK, -2 If Error Occurs 
+ *
+ * Line Is Decoded Once Thru Keyword Table of TextCodec, Message Coming
+ * Before REPLY Is Printed.
+ * @return SUCCESS For REPLY OK, AUTH_FAILED For REPLY NOK Or Invalid Line, JUST_A_MESSAGE For Message
 */
 int TcpMessages::handleAuthReply()
 {
-    /* Preparation  */
-    std::string errorLenght     = "ERR FROM Server IS ";
-    std::string replyOkLenght   = "REPLY OK IS ";
-    std::string replyNokLenght   = "REPLY NOK IS ";
-
-    /* Execution    */
-    if (compare(msg.buffer,"^REPLY")) 
+    WireHeader_t header;
+    msg.content.clear();
+    msg.displayNameOutside.clear();
+    MessageType_t type = TextCodec::decode(msg.buffer, msg, header);
+    if (REPLY == type)
     {
-        if (msg.buffer.size() >= 2 && msg.buffer[msg.buffer.size() - 2] == '\r' && msg.buffer[msg.buffer.size() - 1] == '\n') 
+        if (header.result)
         {
-            msg.buffer.pop_back(); // Removes '\n'
-            msg.buffer.pop_back(); // Removes '\r'
-            if (compare(msg.buffer,"^REPLY OK IS ")) 
-            {
-                msg.buffer.erase(msg.buffer.begin(), msg.buffer.begin() + replyOkLenght.length());
-                std::string authContent(msg.buffer.begin(), msg.buffer.end());
-                fprintf(stdout,"Success: %s\n", authContent.c_str());
-                return SUCCESS;
-
-            }
-            else if (compare(msg.buffer,"^REPLY NOK IS "))
-            {
-                msg.buffer.erase(msg.buffer.begin(), msg.buffer.begin() + replyNokLenght.length());
-                std::string authContent(msg.buffer.begin(), msg.buffer.end());
-                fprintf(stdout,"Failure: %s\n", authContent.c_str());
-                return AUTH_FAILED;
-            } 
+            PrintServerOkReply();
+            return SUCCESS;
         }
+        PrintServerNokReply();
+        return AUTH_FAILED;
     }
-
-    /*  ERROR MESSAGE HANDLING  */
-    else if (compare(msg.buffer,"^MSG FROM "))
+    if (MSG == type && SUCCESS == checkLength())
     {
-        int retVal = SUCCESS;
-        retVal = parseMessage();
-        if (SUCCESS == retVal)
-        {
-            printMessage();
-            return JUST_A_MESSAGE;
-        }
-        return AUTH_FAILED;
+        printMessage();
+        return JUST_A_MESSAGE;
     }
     return AUTH_FAILED;
 }
-
-void TcpMessages::StoreDisplayNameAndContent()
-{
-    size_t idx = 0;
-    std::regex msgIsRegex("^IS");
-    // Erase "ERR/MSG FROM " 
-    msg.buffer.erase(msg.buffer.begin(), msg.buffer.begin() + 9);
-
-    // Get Display Name
-    while (idx < msg.buffer.size() && msg.buffer[idx] != '\n' && msg.buffer[idx] != '\r') 
-    {
-        std::string currentSubStr(msg.buffer.begin() + idx, msg.buffer.end());
-        if (std::regex_search(currentSubStr, msgIsRegex)) {
-            break; // Exit the loop if "IN" is found at the beginning of the current substring
-        }
-        msg.displayNameOutside.push_back(msg.buffer[idx]);
-        idx++;
-    }
-
-    // Check and Remove the Last Character if Needed (It's a Space)
-    if (!msg.displayNameOutside.empty()) 
-    {
-        msg.displayNameOutside.pop_back();
-    }
-    /* Process The Content */
-    int isPlusSpace = 3;                                                    // 1. Get Rid of "IS "
-    msg.buffer.erase(msg.buffer.begin(), msg.buffer.begin() + idx + isPlusSpace);
-
-    /* Get Content */
-    idx = 0;
-    while (idx < msg.buffer.size() && msg.buffer[idx] != '\n' && msg.buffer[idx] != '\r') 
-    {
-        msg.content.push_back(msg.buffer[idx]);   
-        idx++;
-    }
-}
\ No newline at end of file
@@ -0,0 +1,494 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      tcp_session.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements TCP Session Run As Coroutines.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           tcp_session.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements TCP Session Run As Coroutines.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include "../include/tcp_session.hpp"
+#include "../include/protocol_schema.hpp"
+#include "../include/capture.hpp"
+#include "../include/renderer.hpp"
+#include "../include/message_memory.hpp"
+#include "../include/strings.hpp"
+#include "../include/probe.hpp"
+/************************************************/
+/*                  Class                       */
+/************************************************/
+TcpSession::TcpSession(Scheduler& owner, const std::string& sessionName, const std::string& addr, int port, int connectTimeOut)
+    : Session(owner, sessionName, addr, port, TCP, connectTimeOut)
+{
+}
+
+TcpSession::~TcpSession()
+{
+    // receive() May Wait In reconnect() or awaitReply(), Members Used There Are Gone Before Session's Destructor
+    stop();
+}
+
+/**
+ * @brief Enables Reconnect After Server Drops The Session
+ * @param attempts Attempts Per Outage, 0 Disables Reconnect
+ * @param delay First Backoff Step In Milliseconds
+ */
+void TcpSession::setReconnect(uint32_t attempts, uint32_t delay)
+{
+    reconnectAttempts = attempts;
+    backoff = Backoff(std::chrono::milliseconds(delay), std::chrono::milliseconds(MAX_RECONNECT_DELAY));
+}
+
+/**
+ * @brief Runs User's Lines From AUTH Up To BYE
+ *
+ * User's Fields (Display Name) Stay In message, ERR Sent From receive()
+ * Uses Them Too.
+ */
+Task<> TcpSession::converse()
+{
+    BaseMessages record;
+    bool accepted;
+    bool paced;
+    while (true)
+    {
+        bool haveRecord = co_await nextRecord(record);
+        if (!haveRecord)
+        {
+            break;
+        }
+        takeRecord(message, record);
+        if (SUCCESS != message.checkMessage())
+        {
+            reportError("Invalid Parameters");
+            continue;
+        }
+
+        switch (message.msg.type)
+        {
+            case BaseMessages::COMMAND_AUTH:
+                if (Authentication != state)
+                {
+                    reportError("Authentication Already Processed - Not Possible Again");
+                    break;
+                }
+                paced = co_await pace();
+                if (!paced)
+                {
+                    break;
+                }
+                message.sendAuthMessage(sock, unsent);
+                writeLater();
+                credentials = message;
+                markReplyAwaited();
+                accepted = co_await reply();
+                if (accepted)
+                {
+                    state = Open;
+                }
+                break;
+            case BaseMessages::COMMAND_JOIN:
+                if (Open != state)
+                {
+                    reportError("Not Authenticated");
+                    break;
+                }
+                paced = co_await pace();
+                if (!paced)
+                {
+                    break;
+                }
+                message.sendJoinMessage(sock, unsent);
+                writeLater();
+                pendingChannel = message.msg.channelID;
+                markReplyAwaited();
+                accepted = co_await reply();
+                if (accepted)
+                {
+                    joinedChannel = pendingChannel;
+                }
+                break;
+            case BaseMessages::MSG:
+                if (Open != state)
+                {
+                    reportError("Not Authenticated");
+                    break;
+                }
+                paced = co_await pace();
+                if (!paced)
+                {
+                    break;
+                }
+                message.sentUsersMessage(sock, unsent);
+                writeLater();
+                if (!unsent.empty())
+                {
+                    // Next Message Waits Until Slow Server Takes This One
+                    const std::function<bool()> taken = [this] { return unsent.empty() || finished || closing; };
+                    co_await until(taken);
+                }
+                break;
+            case BaseMessages::COMMAND_HELP:
+                message.printHelp();
+                break;
+            case BaseMessages::COMMAND_SEARCH:
+                message.printSearch();
+                break;
+            case BaseMessages::COMMAND_SENDFILE:
+                sendFile(convertToString(message.msg.content));
+                break;
+            case BaseMessages::COMMAND_RENAME:                          // checkMessage() Already Renamed The User
+            default:
+                break;
+        }
+    }
+    if (!finished)
+    {
+        if (draining)
+        {
+            reportDrain();
+        }
+        message.sentByeMessage(sock, unsent);
+        writeLater();
+        const std::function<bool()> taken = [this] { return unsent.empty() || finished || closing; };
+        co_await until(taken, Clock::now() + std::chrono::milliseconds(REPLY_TIMEOUT));
+        finish();
+    }
+}
+
+/**
+ * @brief Reads Segments, Handles Every Complete Line In Them
+ *
+ * Segment May Carry More Lines Or Only Part of One, Rest Waits In stream.
+ * Dropped Connection Is Rebuilt By reconnect() When Enabled.
+ */
+Task<> TcpSession::receive()
+{
+    while (!finished)
+    {
+        co_await scheduler.readable(sock);
+        Renderer::setSession(name);
+        ssize_t bytesRx = receiveSegment();
+        if (0 < bytesRx)
+        {
+            handleStream();
+            continue;
+        }
+        if (bytesRx < 0 && (EAGAIN == errno || EWOULDBLOCK == errno))
+        {
+            continue;
+        }
+
+        // Queued Lines Wait For The Rebuilt Session
+        bool rebuilt = co_await reconnect();
+        if (!rebuilt && !finished)
+        {
+            reportError("Server Disconnected");
+            finish(FAIL);
+        }
+    }
+}
+
+/**
+ * @brief Receives Segment And Appends It To stream
+ * @return Number of Received Bytes, 0 or Less If The Connection Dropped
+ */
+ssize_t TcpSession::receiveSegment()
+{
+    char buf[BUFSIZE];
+    Trace::beginMessage(true);
+    Trace::Scope span("recv");
+    ssize_t bytesRx = recv(sock, buf, sizeof(buf), 0);
+    const int recvError = errno;
+    span.end();
+    rearmQuickAck(sock, socketOptions);
+    if (0 < bytesRx)
+    {
+        Capture::record(Capture::INBOUND, buf, bytesRx);
+        stream.append(buf, bytesRx);
+    }
+    errno = recvError;
+    return bytesRx;
+}
+
+/**
+ * @brief Handles Every Complete Line In stream
+ *
+ * Every Line Is Parsed Into Message Living In Its Own Arena.
+ */
+void TcpSession::handleStream()
+{
+    size_t end;
+    while (!finished && std::string::npos != (end = stream.find("\r\n")))
+    {
+        MessageArena arena;
+        TcpMessages inbound(arena.get());
+        inbound.readAndStoreBytes(stream.data(), end + 2);
+        stream.erase(0, end + 2);
+        handleServerLine(inbound);
+    }
+}
+
+/**
+ * @brief Reconnects With Exponential Backoff And Rebuilds The Session
+ *
+ * Backoff And Connect Run On The Scheduler, Input Is Still Read And Queued
+ * Meanwhile And Signal Gives The Reconnect Up. Only Authenticated Session
+ * Is Rebuilt. Messages Already Handed To The Dead Socket Are Not Resent.
+ * @return True If The Session Was Rebuilt, Otherwise False
+ */
+Task<bool> TcpSession::reconnect()
+{
+    if (0 == reconnectAttempts || Open != state || draining || closing)
+    {
+        co_return false;
+    }
+    const bool joinInFlight = awaitingReply;
+    reconnecting = true;
+    // Bytes of The Dead Socket Are Not Resent, write() Must Not Wait For Its Descriptor
+    writing = Task<>();
+    unsent.clear();
+    disconnect();
+    stream.clear();
+    for (uint32_t attempt = 1; attempt <= reconnectAttempts; attempt++)
+    {
+        std::chrono::milliseconds delay = backoff.next();
+        fprintf(stderr,"%sINFO: Server Disconnected, Reconnecting In %lld ms (Attempt %u of %u)\n",
+                tag().c_str(), static_cast<long long>(delay.count()), attempt, reconnectAttempts);
+        bool halted = co_await halt.wait(Clock::now() + delay);
+        if (halted || finished)
+        {
+            fprintf(stderr,"%sINFO: Reconnect Cancelled\n", tag().c_str());
+            break;
+        }
+
+        int connected = co_await connectToServer();
+        if (SUCCESS != connected)
+        {
+            continue;
+        }
+        int retVal = co_await rebuildSession(joinInFlight);
+        if (SUCCESS == retVal)
+        {
+            fprintf(stderr,"%sINFO: Session Rebuilt\n", tag().c_str());
+            backoff.reset();
+            reconnecting = false;
+            wakeup.set();
+            co_return true;
+        }
+        writing = Task<>();
+        unsent.clear();
+        disconnect();
+        stream.clear();
+        if (AUTH_FAILED == retVal)
+        {
+            reportError("Server Refused Credentials After Reconnect");
+            break;
+        }
+        if (finished)
+        {
+            break;
+        }
+    }
+    reconnecting = false;
+    co_return false;
+}
+
+/**
+ * @brief Authenticates Again And Rejoins Channel On New Connection
+ * @param joinInFlight JOIN Was Sent But Not Answered Before The Drop
+ *
+ * Current Display Name Is Used, So /rename Survives The Reconnect. Refused
+ * JOIN Leaves The User In The Default Channel. REPLY To Rejoin Is Handed
+ * To converse() When It Waits For REPLY of The Lost JOIN.
+ * @return SUCCESS, AUTH_FAILED If Server Refused Credentials, FAIL If Connection Dropped Again
+ */
+Task<int> TcpSession::rebuildSession(bool joinInFlight)
+{
+    credentials.msg.displayName = message.msg.displayName;
+    credentials.sendAuthMessage(sock, unsent);
+    writeLater();
+    int retVal = co_await awaitReply();
+    if (SUCCESS != retVal)
+    {
+        co_return retVal;
+    }
+
+    const BaseMessages::ChannelID channel = joinInFlight ? pendingChannel : joinedChannel;
+    if (channel.empty())
+    {
+        co_return SUCCESS;
+    }
+    credentials.msg.channelID = channel;
+    credentials.sendJoinMessage(sock, unsent);
+    writeLater();
+    retVal = co_await awaitReply();
+    if (FAIL == retVal)
+    {
+        co_return FAIL;
+    }
+    if (SUCCESS == retVal)
+    {
+        joinedChannel = channel;
+    }
+    if (joinInFlight)
+    {
+        replyAccepted = (SUCCESS == retVal);
+        awaitingReply = false;
+    }
+    co_return SUCCESS;
+}
+
+/**
+ * @brief Waits For REPLY While Rebuilding, Messages Coming Before It Are Printed
+ *
+ * Server's ERR or BYE Ends The Session As In receive().
+ * @return SUCCESS For REPLY OK, AUTH_FAILED For REPLY NOK, FAIL If Connection Dropped Or Timed Out
+ */
+Task<int> TcpSession::awaitReply()
+{
+    const Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(REPLY_TIMEOUT);
+    int retVal = FAIL;
+    rebuilding = true;
+    while (rebuilding && !finished)
+    {
+        bool readable = co_await scheduler.readable(sock, deadline);
+        if (!readable)
+        {
+            reportError("No Reply From Server");
+            break;
+        }
+        ssize_t bytesRx = receiveSegment();
+        if (bytesRx < 0 && (EAGAIN == errno || EWOULDBLOCK == errno))
+        {
+            continue;
+        }
+        if (0 >= bytesRx)
+        {
+            break;
+        }
+        handleStream();
+        if (!rebuilding && !finished)
+        {
+            retVal = rebuildAccepted ? SUCCESS : AUTH_FAILED;
+        }
+    }
+    rebuilding = false;
+    co_return retVal;
+}
+
+/**
+ * @brief Handles Single Line From Server
+ * @param inbound Line Stored In Buffer, Allocated In Arena of receive()
+ *
+ * Line Is Decoded Once Thru Keyword Table of TextCodec. REPLY Clears
+ * awaitingReply And Wakes converse() As The Last Step, While Rebuilding
+ * It Is Kept For awaitReply().
+ */
+void TcpSession::handleServerLine(TcpMessages& inbound)
+{
+    WireHeader_t header;
+    Trace::Scope span("deserialize");
+    PROBE(DECODE_LINE);
+    const BaseMessages::MessageType_t type = TextCodec::decode(inbound.msg.buffer, inbound.msg, header);
+    span.end();
+    PROBE_END(DECODE_LINE);
+    switch (type)
+    {
+        case BaseMessages::ERROR:
+            inbound.basePrintExternalError();
+            message.sentByeMessage(sock, unsent);
+            finish(EXTERNAL_ERROR);
+            break;
+        case BaseMessages::COMMAND_BYE:
+            finish();
+            break;
+        case BaseMessages::REPLY:
+            if (!awaitingReply && !rebuilding)
+            {
+                protocolError("Unexpected Reply");
+                break;
+            }
+            if (header.result)
+                inbound.PrintServerOkReply();
+            else
+                inbound.PrintServerNokReply();
+            if (rebuilding)
+            {
+                rebuildAccepted = header.result;
+                rebuilding = false;
+                break;
+            }
+            replyAccepted = header.result;
+            awaitingReply = false;
+            wakeup.set();
+            break;
+        case BaseMessages::MSG:
+            if (SUCCESS != inbound.checkLength())
+            {
+                protocolError("Invalid Message From Server");
+                break;
+            }
+            inbound.printMessage();
+            break;
+        default:
+            protocolError((awaitingReply || rebuilding) ? "Expected Reply" : "Invalid Message From Server");
+            break;
+    }
+}
+
+/**
+ * @brief Sends ERR And BYE, Ends The Session
+ * @param text Description Printed Locally
+ */
+void TcpSession::protocolError(const std::string& text)
+{
+    reportError(text);
+    message.sendErrorMessage(sock, BaseMessages::UNKNOWN_MSG_TYPE, unsent);
+    message.sentByeMessage(sock, unsent);
+    finish(FAIL);
+}
+
+/**
+ * @brief Starts write() For Bytes The Socket Did Not Take At Once
+ *
+ * Running write() Picks New Bytes Up Itself.
+ */
+void TcpSession::writeLater()
+{
+    if (!unsent.empty() && writing.done())
+    {
+        writing = write();
+        writing.start();
+    }
+}
+
+/**
+ * @brief Sends unsent Whenever The Socket Becomes Writable
+ *
+ * Wakes converse() Waiting For Slow Server Once Everything Left.
+ */
+Task<> TcpSession::write()
+{
+    while (!unsent.empty())
+    {
+        while (!unsent.empty())
+        {
+            co_await scheduler.writable(sock);
+            TcpMessages::flush(sock, unsent);
+        }
+        // converse() May Send Again Before wakeup.set() Returns
+        wakeup.set();
+    }
+}
@@ -0,0 +1,205 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      timestamps.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Kernel Receive And Transmit Timestamps.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           timestamps.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Kernel Receive And Transmit Timestamps.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <netinet/in.h>
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#include "../include/timestamps.hpp"
+#include "../include/macros.hpp"
+/************************************************/
+/*                  Constants                   */
+/************************************************/
+static constexpr size_t CONTROL_SIZE = 512;     //!< Space For Control Messages
+
+/************************************************/
+/*                  Functions                   */
+/************************************************/
+/**
+ * @brief Finds Software Timestamp In Control Messages
+ * @param msgHdr Received Message Header
+ * @param stamp Found Timestamp
+ *
+ * @return True If SCM_TIMESTAMPING Was Present
+ */
+static bool findTimestamp(struct msghdr* msgHdr, struct timespec& stamp)
+{
+    for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(msgHdr); nullptr != cmsg; cmsg = CMSG_NXTHDR(msgHdr, cmsg))
+    {
+        if (SOL_SOCKET == cmsg->cmsg_level && SCM_TIMESTAMPING == cmsg->cmsg_type)
+        {
+            struct scm_timestamping stamps;
+            memcpy(&stamps, CMSG_DATA(cmsg), sizeof(stamps));
+            stamp = stamps.ts[0];                               // Software Timestamp
+            return true;
+        }
+    }
+    return false;
+}
+
+/************************************************/
+/*                  Class                       */
+/************************************************/
+/**
+ * @brief Enables SO_TIMESTAMPING Software RX/TX Timestamps On The Socket
+ * @param sock UDP Socket
+ *
+ * OPT_ID Numbers Transmitted Datagrams Per Socket, OPT_TSONLY Keeps The
+ * Payload Out of Error Queue. Count Restarts, So Datagrams Sent Before
+ * And On Other Sockets Do Not Shift The Numbering.
+ * @return SUCCESS If The Kernel Accepted The Option, Otherwise FAIL
+ */
+int KernelTimestamps::enable(int sock)
+{
+    int flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_TX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE |
+                SOF_TIMESTAMPING_OPT_ID | SOF_TIMESTAMPING_OPT_TSONLY;
+    if (0 != setsockopt(sock, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)))
+    {
+        fprintf(stderr,"ERR: SO_TIMESTAMPING Not Supported: %s\n", strerror(errno));
+        enabled = false;
+        return FAIL;
+    }
+    enabled = true;
+    sent = 0;
+    memset(txValid, 0, sizeof(txValid));
+    return SUCCESS;
+}
+
+bool KernelTimestamps::isEnabled() const
+{
+    return enabled;
+}
+
+/**
+ * @brief Receives Datagram Together With Its Kernel RX Timestamp
+ * @param sock Socket
+ * @param buffer Buffer For The Datagram
+ * @param size Size of The Buffer
+ * @param from Sender's Address
+ * @param fromLen Length of Sender's Address
+ *
+ * @return Number of Received Bytes, Or -1 On Error
+ */
+ssize_t KernelTimestamps::receive(int sock, char* buffer, size_t size, struct sockaddr_storage* from, socklen_t* fromLen)
+{
+    char control[CONTROL_SIZE];
+    struct iovec iov = {buffer, size};
+    struct msghdr msgHdr;
+    memset(&msgHdr, 0, sizeof(msgHdr));
+    msgHdr.msg_name = from;
+    msgHdr.msg_namelen = *fromLen;
+    msgHdr.msg_iov = &iov;
+    msgHdr.msg_iovlen = 1;
+    msgHdr.msg_control = control;
+    msgHdr.msg_controllen = sizeof(control);
+
+    ssize_t bytesRx = recvmsg(sock, &msgHdr, MSG_DONTWAIT);
+    if (bytesRx >= 0)
+    {
+        *fromLen = msgHdr.msg_namelen;
+        if (!findTimestamp(&msgHdr, lastRx))
+        {
+            lastRx = {0, 0};
+        }
+    }
+    return bytesRx;
+}
+
+/**
+ * @brief Reads TX Timestamps From Socket's Error Queue
+ * @param sock Socket
+ */
+void KernelTimestamps::drainErrorQueue(int sock)
+{
+    char control[CONTROL_SIZE];
+    char data[1];
+
+    while (true)
+    {
+        struct iovec iov = {data, sizeof(data)};
+        struct msghdr msgHdr;
+        memset(&msgHdr, 0, sizeof(msgHdr));
+        msgHdr.msg_iov = &iov;
+        msgHdr.msg_iovlen = 1;
+        msgHdr.msg_control = control;
+        msgHdr.msg_controllen = sizeof(control);
+
+        if (recvmsg(sock, &msgHdr, MSG_ERRQUEUE | MSG_DONTWAIT) < 0)
+        {
+            return;
+        }
+
+        struct timespec stamp = {0, 0};
+        bool hasStamp = findTimestamp(&msgHdr, stamp);
+        for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&msgHdr); nullptr != cmsg; cmsg = CMSG_NXTHDR(&msgHdr, cmsg))
+        {
+            bool recvErr = (IPPROTO_IP == cmsg->cmsg_level && IP_RECVERR == cmsg->cmsg_type) ||
+                           (IPPROTO_IPV6 == cmsg->cmsg_level && IPV6_RECVERR == cmsg->cmsg_type);
+            if (!recvErr || !hasStamp)
+            {
+                continue;
+            }
+            struct sock_extended_err extErr;
+            memcpy(&extErr, CMSG_DATA(cmsg), sizeof(extErr));
+            if (SO_EE_ORIGIN_TIMESTAMPING == extErr.ee_origin && SCM_TSTAMP_SND == extErr.ee_info)
+            {
+                uint32_t slot = extErr.ee_data % TX_HISTORY;
+                txIds[slot] = extErr.ee_data;
+                txTimes[slot] = stamp;
+                txValid[slot] = true;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Marks The Last Counted Datagram As The One Whose CONFIRM Is Awaited
+ */
+void KernelTimestamps::expectConfirm()
+{
+    awaitedId = sent - 1;
+}
+
+/**
+ * @brief Computes Network RTT of The Awaited Datagram
+ * @param sock Socket, Its Error Queue Is Drained First
+ * @param rttMs Round Trip Time Between Kernel TX And RX Timestamps In Milliseconds
+ *
+ * @return True If Both Timestamps Are Known
+ */
+bool KernelTimestamps::networkRtt(int sock, double& rttMs)
+{
+    if (!enabled)
+    {
+        return false;
+    }
+    drainErrorQueue(sock);
+
+    uint32_t slot = awaitedId % TX_HISTORY;
+    if (!txValid[slot] || txIds[slot] != awaitedId || (0 == lastRx.tv_sec && 0 == lastRx.tv_nsec))
+    {
+        return false;
+    }
+    const struct timespec& tx = txTimes[slot];
+    rttMs = (lastRx.tv_sec - tx.tv_sec) * 1e3 + (lastRx.tv_nsec - tx.tv_nsec) / 1e6;
+    return true;
+}
@@ -0,0 +1,96 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      token_bucket.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Token Bucket Pacing Outgoing Messages.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           token_bucket.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Token Bucket Pacing Outgoing Messages.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <algorithm>
+#include "../include/token_bucket.hpp"
+/************************************************/
+/*                  Class                       */
+/************************************************/
+/**
+ * @brief Sets Rate And Burst, Bucket Starts Full
+ * @param ratePerSecond Messages Per Second, 0 Disables Pacing
+ * @param burstSize Messages Which May Leave Back To Back
+ * @param now Current Time
+ */
+void TokenBucket::configure(double ratePerSecond, uint32_t burstSize, Clock::time_point now)
+{
+    rate = std::max(0.0, ratePerSecond);
+    capacity = std::max<uint32_t>(1, burstSize);
+    tokens = capacity;
+    refilledAt = now;
+}
+
+/**
+ * @brief Adds Tokens Gained Since The Last Refill, Up To burst
+ * @param now Current Time
+ */
+void TokenBucket::refill(Clock::time_point now)
+{
+    if (now <= refilledAt)
+    {
+        return;
+    }
+    double elapsed = std::chrono::duration<double>(now - refilledAt).count();
+    tokens = std::min(capacity, tokens + elapsed * rate);
+    refilledAt = now;
+}
+
+/**
+ * @brief Determine If One Message May Be Sent Now
+ * @param now Current Time
+ *
+ * @return True If Whole Token Is In The Bucket
+ */
+bool TokenBucket::available(Clock::time_point now)
+{
+    if (!isLimited())
+    {
+        return true;
+    }
+    refill(now);
+    return 1.0 <= tokens;
+}
+
+/**
+ * @brief Takes Token For Sent Message
+ */
+void TokenBucket::take()
+{
+    if (isLimited())
+    {
+        tokens -= 1.0;
+    }
+}
+
+/**
+ * @brief Returns Time When The Next Token Is In The Bucket
+ * @param now Current Time
+ *
+ * @return now If Token Is Available Already
+ */
+TokenBucket::Clock::time_point TokenBucket::readyAt(Clock::time_point now)
+{
+    if (available(now))
+    {
+        return now;
+    }
+    std::chrono::duration<double> missing((1.0 - tokens) / rate);
+    return now + std::chrono::ceil<Clock::duration>(missing);
+}
@@ -0,0 +1,247 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      trace.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements Per-Message Lifecycle Tracing In Chrome Trace Format.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           trace.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements Per-Message Lifecycle Tracing In Chrome Trace Format.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <chrono>
+#include <cstdlib>
+#include <csignal>
+#include "../include/trace.hpp"
+#include "../include/macros.hpp"
+/************************************************/
+/*                  Helpers                     */
+/************************************************/
+/**
+ * @brief Message Handled By The Thread
+ */
+struct TraceContext_t
+{
+    uint32_t message = 0;
+    bool inbound = false;
+};
+
+static thread_local TraceContext_t context;
+/************************************************/
+/*                  Class                       */
+/************************************************/
+std::atomic<bool> Trace::active{false};
+std::atomic<bool> Trace::running{false};
+std::atomic<uint32_t> Trace::nextMessage{1};
+std::atomic<uint32_t> Trace::dropped{0};
+std::mutex Trace::registry;
+std::vector<std::unique_ptr<Trace::Buffer>> Trace::buffers;
+std::thread Trace::flusher;
+FILE* Trace::file = nullptr;
+thread_local Trace::Buffer* Trace::ownBuffer = nullptr;
+
+/**
+ * @brief Creates Trace File And Starts Flushing Thread
+ * @param path Path of The Trace File
+ *
+ * File Uses JSON Array Format, Whose Closing Bracket Is Optional, So Trace
+ * of Killed Client Still Loads. Closed By atexit(), Because Client Leaves
+ * Thru exit() On Many Places.
+ * @return SUCCESS If Tracing Runs, Otherwise FAIL
+ */
+int Trace::open(const std::string& path)
+{
+    file = fopen(path.c_str(), "w");
+    if (nullptr == file)
+    {
+        fprintf(stderr,"ERR: Trace File %s Could Not Be Created\n", path.c_str());
+        return FAIL;
+    }
+    fprintf(file, "[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"ipk24chat-client\"}}");
+    running = true;
+    sigset_t all, previous;
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &previous);           // Signals Go To Main Thread's signalfd
+    flusher = std::thread(run);
+    pthread_sigmask(SIG_SETMASK, &previous, nullptr);
+    active = true;
+    nameThread("network");
+    atexit(Trace::close);
+    return SUCCESS;
+}
+
+uint64_t Trace::now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Starts New Message On Calling Thread
+ * @param inbound Message Came From Server
+ *
+ * @return Number of The Message, 0 If Trace Is Disabled
+ */
+uint32_t Trace::beginMessage(bool inbound)
+{
+    if (!enabled())
+    {
+        return 0;
+    }
+    context.message = nextMessage.fetch_add(1, std::memory_order_relaxed);
+    context.inbound = inbound;
+    return context.message;
+}
+
+uint32_t Trace::currentMessage()
+{
+    return context.message;
+}
+
+/**
+ * @brief Continues Message Started On Other Thread Or Earlier
+ * @param message Number of The Message
+ * @param inbound Message Came From Server
+ */
+void Trace::resumeMessage(uint32_t message, bool inbound)
+{
+    context.message = message;
+    context.inbound = inbound;
+}
+
+/**
+ * @brief Records Span of Current Message
+ * @param name Stage, String Literal
+ * @param start Start In Nanoseconds
+ * @param end End In Nanoseconds
+ */
+void Trace::span(const char* name, uint64_t start, uint64_t end)
+{
+    span(name, start, end, context.message, context.inbound);
+}
+
+/**
+ * @brief Records Span of Given Message
+ * @param name Stage, String Literal
+ * @param start Start In Nanoseconds
+ * @param end End In Nanoseconds
+ * @param message Number of The Message
+ * @param inbound Message Came From Server
+ */
+void Trace::span(const char* name, uint64_t start, uint64_t end, uint32_t message, bool inbound)
+{
+    if (!enabled())
+    {
+        return;
+    }
+    Buffer* buffer = threadBuffer();
+    if (!buffer->queue.push({name, start, end, message, inbound}))
+    {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief Names Calling Thread In The Timeline
+ * @param name Name, String Literal
+ */
+void Trace::nameThread(const char* name)
+{
+    if (enabled())
+    {
+        threadBuffer()->name = name;
+    }
+}
+
+/**
+ * @brief Returns Buffer of Calling Thread, Registers It On First Use
+ *
+ * Registration Is The Only Locked Step On The Hot Path, Once Per Thread.
+ */
+Trace::Buffer* Trace::threadBuffer()
+{
+    if (nullptr == ownBuffer)
+    {
+        std::lock_guard<std::mutex> guard(registry);
+        buffers.push_back(std::make_unique<Buffer>());
+        buffers.back()->tid = buffers.size();
+        ownBuffer = buffers.back().get();
+    }
+    return ownBuffer;
+}
+
+/**
+ * @brief Writes Queued Spans of All Threads Into The File
+ *
+ * Spans Become Complete Events ("ph":"X") In Microseconds, Category Tells
+ * Direction And Argument "msg" Ties Stages of One Message Together.
+ */
+void Trace::flush()
+{
+    std::lock_guard<std::mutex> guard(registry);
+    Event_t event;
+    for (const std::unique_ptr<Buffer>& buffer : buffers)
+    {
+        const char* threadName = buffer->name.load();
+        if (!buffer->named && nullptr != threadName)
+        {
+            fprintf(file, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+                    buffer->tid, threadName);
+            buffer->named = true;
+        }
+        while (buffer->queue.pop(event))
+        {
+            fprintf(file, ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{\"msg\":%u}}",
+                    event.name, event.inbound ? "inbound" : "outbound", buffer->tid,
+                    event.start / 1000.0, (event.end - event.start) / 1000.0, event.message);
+        }
+    }
+    fflush(file);
+}
+
+/**
+ * @brief Body of Flushing Thread
+ */
+void Trace::run()
+{
+    while (running)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(FLUSH_PERIOD));
+        flush();
+    }
+}
+
+/**
+ * @brief Stops Flushing Thread, Writes Remaining Spans And Closes The File
+ *
+ * Rendering Thread Is Already Joined, Its atexit() Handler Runs First.
+ */
+void Trace::close()
+{
+    if (!running.exchange(false))
+    {
+        return;
+    }
+    active = false;
+    if (flusher.joinable())
+    {
+        flusher.join();
+    }
+    flush();
+    fprintf(file, "\n]\n");
+    fclose(file);
+    file = nullptr;
+    uint32_t lost = dropped.exchange(0);
+    if (0 != lost)
+    {
+        fprintf(stderr,"INFO: %u Trace Spans Dropped, Flushing Was Too Slow\n", lost);
+    }
+}
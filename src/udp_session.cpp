@@ -0,0 +1,616 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      udp_session.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Implements UDP Session Run As Coroutines.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           udp_session.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Implements UDP Session Run As Coroutines.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include "../include/udp_session.hpp"
+#include "../include/capture.hpp"
+#include "../include/renderer.hpp"
+#include "../include/message_memory.hpp"
+#include "../include/strings.hpp"
+#include "../include/trace.hpp"
+#include "../include/probe.hpp"
+/************************************************/
+/*                  Helpers                     */
+/************************************************/
+/**
+ * @brief Reads Big-Endian Message ID From Datagram
+ */
+static uint16_t readID(const char* data)
+{
+    return static_cast<uint16_t>((static_cast<uint8_t>(data[0]) << 8) | static_cast<uint8_t>(data[1]));
+}
+
+/************************************************/
+/*                  Class                       */
+/************************************************/
+UdpSession::UdpSession(Scheduler& owner, const std::string& sessionName, const std::string& addr, int port, int retryCount, int confirmTimeOut, int connectTimeOut)
+    : Session(owner, sessionName, addr, port, UDP, connectTimeOut), maxRetries(retryCount), confirmationTimeout(confirmTimeOut), adopted(owner)
+{
+    memset(&peer, 0, sizeof(peer));
+}
+
+UdpSession::~UdpSession()
+{
+    // receive() May Wait For adopted, Which Is Gone Before Session's Destructor
+    stop();
+}
+
+/**
+ * @brief Resolved Server Sets peer, More Addresses Start The Race
+ *
+ * With One Address peer Is Set Right Away. With More Addresses Every
+ * Candidate Gets Its Own Coroutine Waiting For The First Datagram And
+ * receive() Waits Until One Of Them Wins, AUTH Is Sent By deliver().
+ */
+void UdpSession::prepare()
+{
+    peer = server;
+    if (1 < candidates.size())
+    {
+        for (size_t idx = 0; idx < candidates.size(); idx++)
+        {
+            racers.push_back(watchCandidate(idx));
+            racers.back().start();
+        }
+    }
+    else if (kernelTimestamps)
+    {
+        timestamps.enable(sock);
+    }
+}
+
+void UdpSession::setKernelTimestamps(bool enable)
+{
+    kernelTimestamps = enable;
+}
+
+/**
+ * @brief Runs User's Records From AUTH Up To BYE
+ */
+Task<> UdpSession::converse()
+{
+    BaseMessages record;
+    bool accepted;
+    bool paced;
+    while (true)
+    {
+        bool haveRecord = co_await nextRecord(record);
+        if (!haveRecord)
+        {
+            break;
+        }
+        takeRecord(message, record);
+        if (SUCCESS != message.checkMessage())
+        {
+            reportError("Invalid Parameters");
+            continue;
+        }
+
+        switch (message.msg.type)
+        {
+            case BaseMessages::COMMAND_AUTH:
+                if (Authentication != state)
+                {
+                    reportError("Authentication Already Processed - Not Possible Again");
+                    break;
+                }
+                paced = co_await pace();
+                if (!paced)
+                {
+                    break;
+                }
+                accepted = co_await deliver(BaseMessages::COMMAND_AUTH);
+                if (accepted)
+                {
+                    accepted = co_await reply();
+                }
+                if (accepted)
+                {
+                    state = Open;
+                }
+                break;
+            case BaseMessages::COMMAND_JOIN:
+                if (Open != state)
+                {
+                    reportError("Not Authenticated");
+                    break;
+                }
+                paced = co_await pace();
+                if (!paced)
+                {
+                    break;
+                }
+                accepted = co_await deliver(BaseMessages::COMMAND_JOIN);
+                if (accepted)
+                {
+                    co_await reply();
+                }
+                break;
+            case BaseMessages::MSG:
+                if (Open != state)
+                {
+                    reportError("Not Authenticated");
+                    break;
+                }
+                paced = co_await pace();
+                if (!paced)
+                {
+                    break;
+                }
+                co_await deliver(BaseMessages::MSG);
+                break;
+            case BaseMessages::COMMAND_HELP:
+                message.printHelp();
+                break;
+            case BaseMessages::COMMAND_SEARCH:
+                message.printSearch();
+                break;
+            case BaseMessages::COMMAND_SENDFILE:
+                sendFile(convertToString(message.msg.content));
+                break;
+            case BaseMessages::COMMAND_RENAME:                          // checkMessage() Already Renamed The User
+            default:
+                break;
+        }
+    }
+    if (!finished && draining)
+    {
+        reportDrain();
+    }
+    co_await goodbye();
+}
+
+/**
+ * @brief Sends Message And Waits Until It Is Confirmed
+ * @param type Type of The Message
+ *
+ * Serialized Bytes Are Kept In Arena of The Session, So The Frame Stays
+ * Small. Retransmission Sends Them Again Unchanged And Takes Token Only
+ * When Retransmissions Share The Pacing Budget.
+ * REPLY To AUTH or JOIN Confirms The Message Too. While Racing, AUTH Goes
+ * To The Next Address Every CONNECTION_ATTEMPT_DELAY. Message Sent Before
+ * Drain Deadline Is Given Up Once The Deadline Passes.
+ * @return True If CONFIRM Came, False If Retries Ran Out or Session Ended
+ */
+Task<bool> UdpSession::deliver(BaseMessages::MessageType_t type)
+{
+    const bool abandonable = !hurried;
+    message.msg.type = type;
+    message.messageID = nextMessageID;
+    outbound.reset();                                                   // Only One Message Is In Flight, Previous Datagram Is Gone
+    UdpMessages::Datagram datagram = message.serializeMessage(outbound.get());
+    inFlightID = nextMessageID++;
+    awaitingConfirm = true;
+    if (1 < candidates.size() && 0 == nextCandidate)
+    {
+        startNextCandidate(datagram);
+    }
+    else
+    {
+        transmit(datagram);
+    }
+    sentAt = UdpMessages::lastTransmitAt;
+    timestamps.expectConfirm();
+    confirmAwaitedSince = Trace::startSpan();
+    confirmMessage = Trace::currentMessage();
+    if (BaseMessages::COMMAND_AUTH == type || BaseMessages::COMMAND_JOIN == type)
+    {
+        markReplyAwaited();
+        replyFor = inFlightID;
+    }
+    bool withContent = (BaseMessages::MSG == type || BaseMessages::ERROR == type);
+    message.recordSent(type, withContent ? std::string(message.msg.content.begin(), message.msg.content.end()) : "");
+
+    const std::function<bool()> settled = [this, abandonable] { return !awaitingConfirm || finished || (abandonable && hurried); };
+    for (int retries = 0; ; retries++)
+    {
+        Clock::time_point deadline = Clock::now() + std::chrono::milliseconds(confirmationTimeout);
+        bool confirmed = co_await until(settled, wakeAt(deadline));
+        while (!confirmed && Clock::now() < deadline)
+        {
+            // Next Racing Address Is Due Before Retransmission
+            if (1 < candidates.size() && nextCandidate < candidates.size() && Clock::now() >= nextAttemptAt)
+            {
+                startNextCandidate(datagram);
+            }
+            confirmed = co_await until(settled, wakeAt(deadline));
+        }
+        if (abandonable && hurried && awaitingConfirm && !finished)
+        {
+            unsent++;
+            awaitingConfirm = false;
+            co_return false;
+        }
+        if (!awaitingConfirm || finished)
+        {
+            co_return !finished;
+        }
+        if (retries >= maxRetries)
+        {
+            reportError("Attempts Overrun");
+            finish(FAIL);
+            co_return false;
+        }
+        if (retransmitsPaced)
+        {
+            bool paced = co_await pace();
+            if (!paced)
+            {
+                co_return false;
+            }
+        }
+        Trace::resumeMessage(confirmMessage, false);
+        transmit(datagram);
+        sentAt = UdpMessages::lastTransmitAt;
+        timestamps.expectConfirm();
+    }
+}
+
+/**
+ * @brief Sends ERR If Something Was Wrong And BYE, Then Ends The Session
+ *
+ * Nothing Is Sent When AUTH Never Went Out. While Still Racing, Every
+ * Address Which Received AUTH Gets BYE Without Waiting For CONFIRM.
+ */
+Task<> UdpSession::goodbye()
+{
+    awaitingReply = false;
+    if (finished)
+    {
+        co_return;
+    }
+    if (0 == nextMessageID)
+    {
+        finish();
+        co_return;
+    }
+    if (1 < candidates.size())
+    {
+        for (const Candidate_t& candidate : candidates)
+        {
+            if (candidate.started)
+                sendBye(candidate);
+        }
+        finish();
+        co_return;
+    }
+    if (!errorText.empty())
+    {
+        state = Error;
+        message.msg.content.assign(errorText.begin(), errorText.end());
+        bool delivered = co_await deliver(BaseMessages::ERROR);
+        if (!delivered)
+        {
+            co_return;
+        }
+    }
+    if (!finished)
+    {
+        state = End;
+        co_await deliver(BaseMessages::COMMAND_BYE);
+        finish();
+    }
+}
+
+/**
+ * @brief Sends Datagram To The Server, While Racing To Every Started Address
+ * @param datagram Serialized Message
+ */
+void UdpSession::transmit(const UdpMessages::Datagram& datagram)
+{
+    if (1 < candidates.size())
+    {
+        for (const Candidate_t& candidate : candidates)
+        {
+            if (candidate.started)
+                UdpMessages::transmit(candidate.sock, datagram.data(), datagram.size(), candidate.address.addr);
+        }
+        return;
+    }
+    if (UdpMessages::transmit(sock, datagram.data(), datagram.size(), peer))
+    {
+        timestamps.countTransmit();
+    }
+}
+
+/**
+ * @brief Sends Datagram To The Next Racing Address
+ * @param datagram Serialized AUTH
+ */
+void UdpSession::startNextCandidate(const UdpMessages::Datagram& datagram)
+{
+    Candidate_t& candidate = candidates[nextCandidate];
+    UdpMessages::transmit(candidate.sock, datagram.data(), datagram.size(), candidate.address.addr);
+    candidate.started = true;
+    nextCandidate++;
+    nextAttemptAt = Clock::now() + std::chrono::milliseconds(CONNECTION_ATTEMPT_DELAY);
+}
+
+Session::Clock::time_point UdpSession::wakeAt(Clock::time_point deadline) const
+{
+    if (1 < candidates.size() && nextCandidate < candidates.size())
+    {
+        return std::min(deadline, nextAttemptAt);
+    }
+    return deadline;
+}
+
+/**
+ * @brief Coroutine Waiting For The First Datagram From One Candidate
+ * @param index Index of The Candidate
+ *
+ * Error Reported On The Socket (ICMP Unreachable) Is Consumed By The Peek
+ * And The Candidate Keeps Waiting.
+ */
+Task<> UdpSession::watchCandidate(size_t index)
+{
+    const int candidateSock = candidates[index].sock;
+    while (true)
+    {
+        co_await scheduler.readable(candidateSock);
+        char byte;
+        if (0 <= recv(candidateSock, &byte, sizeof(byte), MSG_PEEK | MSG_DONTWAIT))
+        {
+            break;
+        }
+    }
+    adoptCandidate(index);
+}
+
+/**
+ * @brief Keeps The Candidate Which Answered First
+ * @param index Index of The Winning Candidate
+ *
+ * Other Candidates Which Already Received AUTH Are Sent BYE, All Of Them Are
+ * Closed. The Winner Becomes sock And receive() Is Let Go.
+ */
+void UdpSession::adoptCandidate(size_t index)
+{
+    for (size_t idx = 0; idx < candidates.size(); idx++)
+    {
+        if (idx == index)
+            continue;
+        racers[idx] = Task<>();                                         // Stops Waiting On The Socket Before It Is Closed
+        if (candidates[idx].started)
+        {
+            // Do Not Leave Half-Open Session On The Losing Address
+            sendBye(candidates[idx]);
+        }
+        close(candidates[idx].sock);
+    }
+    sock = candidates[index].sock;
+    memcpy(&server, &candidates[index].address.addr, sizeof(server));
+    peer = server;
+    candidates.clear();
+    if (kernelTimestamps)
+    {
+        timestamps.enable(sock);
+    }
+    adopted.set();
+}
+
+/**
+ * @brief Sends BYE To Racing Address Which Is Left
+ * @param candidate Losing Candidate
+ *
+ * BYE Is Not Confirmed And Not Appended To History.
+ */
+void UdpSession::sendBye(const Candidate_t& candidate)
+{
+    UdpMessages bye;
+    bye.messageID = nextMessageID;
+    bye.sendByeMessage(candidate.sock, candidate.address.addr, false);
+}
+
+/**
+ * @brief Receives Datagram, Kernel RX Timestamp Is Taken When Enabled
+ * @param buf Buffer For The Datagram
+ * @param size Size of The Buffer
+ * @param from Sender's Address
+ *
+ * TX Timestamps Wake The Socket Thru Error Queue, They Are Read First.
+ * @return Number of Received Bytes, -1 If Nothing Was Waiting
+ */
+ssize_t UdpSession::receiveDatagram(char* buf, size_t size, struct sockaddr_storage& from)
+{
+    socklen_t fromLength = sizeof(from);
+    ssize_t bytesRx;
+    if (timestamps.isEnabled())
+    {
+        timestamps.drainErrorQueue(sock);
+        bytesRx = timestamps.receive(sock, buf, size, &from, &fromLength);
+    }
+    else
+    {
+        bytesRx = recvfrom(sock, buf, size, MSG_DONTWAIT, (struct sockaddr *)&from, &fromLength);
+    }
+    receivedAt = std::chrono::high_resolution_clock::now();
+    return bytesRx;
+}
+
+/**
+ * @brief Reports Network And Application RTT of Confirmed Message
+ */
+void UdpSession::reportConfirmRtt()
+{
+    double networkMs = 0.0;
+    if (!kernelTimestamps || !timestamps.networkRtt(sock, networkMs))
+    {
+        return;
+    }
+    double applicationMs = std::chrono::duration<double, std::milli>(receivedAt - sentAt).count();
+    fprintf(stderr,"%sINFO: CONFIRM %u Network RTT %.3f ms, Application RTT %.3f ms, Client Overhead %.3f ms\n",
+            tag().c_str(), inFlightID, networkMs, applicationMs, applicationMs - networkMs);
+}
+
+/**
+ * @brief Receives Datagrams, Confirms And Handles Them
+ *
+ * While Addresses Race, Waits Until One of Them Wins. Every Datagram Is
+ * Decoded Into Message Living In Its Own Arena, Released In One Step Before
+ * The Next recvfrom().
+ */
+Task<> UdpSession::receive()
+{
+    if (1 < candidates.size())
+    {
+        co_await adopted.wait();
+    }
+    char buf[BUFSIZE];
+    while (!finished)
+    {
+        co_await scheduler.readable(sock);
+        Renderer::setSession(name);
+
+        struct sockaddr_storage from;
+        Trace::beginMessage(true);
+        Trace::Scope span("recvfrom");
+        ssize_t bytesRx = receiveDatagram(buf, sizeof(buf), from);
+        span.end();
+        if (0 >= bytesRx)
+        {
+            continue;
+        }
+        Capture::record(Capture::INBOUND, buf, bytesRx);
+        peer = from;                                                    // Server Answers From Dynamic Port
+        if (UdpMessages::confirmFromHeader(sock, peer, buf, bytesRx))
+        {
+            timestamps.countTransmit();                                 // CONFIRM Takes Kernel's TX Number Too
+        }
+        if (bytesRx < 3)
+        {
+            continue;
+        }
+
+        const uint8_t type = static_cast<uint8_t>(buf[0]);
+        const uint16_t id = readID(buf + 1);
+        Trace::Scope deduplicating("dedup");
+        PROBE(DEDUP);
+        const bool duplicate = BaseMessages::CONFIRM != type && !receivedIDs.insert(id).second;
+        deduplicating.end();
+        PROBE_END(DEDUP);
+        if (duplicate)
+        {
+            continue;                                                   // Duplicate Was Already Confirmed, Ignore It
+        }
+        MessageArena arena;
+        UdpMessages inbound(arena.get());
+        inbound.readAndStoreBytes(buf, bytesRx);
+        handleDatagram(inbound);
+    }
+}
+
+/**
+ * @brief Handles Received Datagram
+ * @param inbound Datagram Stored In Buffer, Allocated In Arena of receive()
+ *
+ * Only Updates State And Wakes converse(), Which May Run Before wakeup.set()
+ * Returns, So Nothing Is Touched After It.
+ */
+void UdpSession::handleDatagram(UdpMessages& inbound)
+{
+    const CharBuffer& datagram = inbound.msg.buffer;
+    const uint8_t type = static_cast<uint8_t>(datagram[0]);
+
+    if (BaseMessages::CONFIRM == type)
+    {
+        if (awaitingConfirm && readID(datagram.data() + 1) == inFlightID)
+        {
+            reportConfirmRtt();
+            Trace::endSpan("await CONFIRM", confirmAwaitedSince, confirmMessage, false);
+            awaitingConfirm = false;
+            wakeup.set();
+        }
+        return;
+    }
+
+    Trace::Scope span("deserialize");
+    PROBE(DECODE_DATAGRAM);
+    inbound.cleanMessage();
+    inbound.deserializeMessage(datagram);
+    span.end();
+    PROBE_END(DECODE_DATAGRAM);
+    switch (type)
+    {
+        case BaseMessages::REPLY:
+        {
+            uint16_t reference = (6 <= datagram.size()) ? readID(datagram.data() + 4) : 0;
+            if (!awaitingReply || reference != replyFor || BaseMessages::REPLY != inbound.msg.type)
+            {
+                protocolError("Unexpected Reply");
+                break;
+            }
+            if (awaitingConfirm && reference == inFlightID)
+            {
+                awaitingConfirm = false;                                // REPLY Implies Lost CONFIRM
+            }
+            replyAccepted = (1 == inbound.result);
+            if (replyAccepted)
+                inbound.PrintServerOkReply(inbound.messageID);
+            else
+                inbound.PrintServerNokReply(inbound.messageID);
+            awaitingReply = false;
+            wakeup.set();
+            break;
+        }
+        case BaseMessages::MSG:
+            if (SUCCESS != inbound.checkLength())
+            {
+                protocolError("Invalid Messsage Params");
+                break;
+            }
+            inbound.printMessage(inbound.messageID);
+            break;
+        case BaseMessages::ERROR:
+            inbound.basePrintExternalError(inbound.messageID);
+            if (SUCCESS == exitCode)
+                exitCode = EXTERNAL_ERROR;
+            state = End;
+            closing = true;
+            wakeup.set();
+            break;
+        case BaseMessages::COMMAND_BYE:
+            finish();
+            break;
+        default:
+            protocolError("Invalid Messsage Type");
+            break;
+    }
+}
+
+/**
+ * @brief Reports Invalid Datagram, goodbye() Then Sends ERR
+ * @param text Content of ERR
+ *
+ * When The Session Is Already Leaving, Only BYE Is Sent.
+ */
+void UdpSession::protocolError(const std::string& text)
+{
+    reportError(text);
+    if (closing)
+    {
+        return;
+    }
+    errorText = text;
+    if (SUCCESS == exitCode)
+        exitCode = FAIL;
+    state = Error;
+    closing = true;
+    wakeup.set();
+}
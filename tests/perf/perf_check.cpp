@@ -0,0 +1,740 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      perf_check.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Performance Regression Gate Running Client Against Loopback Server.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           perf_check.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Performance Regression Gate Running Client Against Loopback Server.
+ *
+ *  Usage: ipk24chat-perf [--update] [--runs N] [--messages N] CLIENT BASELINE
+ *
+ *  Every Scenario Runs The Client Binary Several Times Against Server In
+ *  This Process. Messages Are Closed-Loop, Next One Leaves When The Previous
+ *  One Arrived, So Latency Is Cost of One Message Thru The Client. Medians
+ *  Are Compared With Baseline, Allowed Change Grows With Measured Noise.
+ * ****************************/
+
+/************************************************/
+/*                  Libraries                   */
+/************************************************/
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "macros.hpp"
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr int REPLY_TIMEOUT      = 5000;     //!< Deadline For Any Step of Scenario In Milliseconds
+static constexpr int SERVER_TICK        = 50;       //!< Server Checks Stop Request This Often In Milliseconds
+static constexpr uint32_t LOSS_SEED     = 4567;     //!< Same Loss Pattern In Every Run
+static constexpr double NOISE_FACTOR    = 3.0;      //!< Allowed Change In Multiples of Relative Noise
+
+/**
+ * @brief Scenario Run By The Gate
+ */
+struct Scenario_t
+{
+    const char* name;
+    bool udp;
+    bool flood;                 //!< Server Sends, Client Receives, Otherwise Client Sends
+    double loss;                //!< Probability of Losing Client's MSG Or Its CONFIRM
+};
+
+static const Scenario_t SCENARIOS[] = {
+    {"tcp-bulk-send",  false, false, 0.0},
+    {"udp-bulk-send",  true,  false, 0.0},
+    {"tcp-recv-flood", false, true,  0.0},
+    {"udp-recv-flood", true,  true,  0.0},
+    {"udp-loss-1",     true,  false, 0.01},
+    {"udp-loss-5",     true,  false, 0.05},
+};
+
+/**
+ * @brief Metric Compared With Baseline
+ */
+struct Metric_t
+{
+    const char* name;
+    const char* unit;
+    bool higherIsBetter;        //!< Throughput, Per-Message Time Is 1 / Value
+    double floor;               //!< Allowed Relative Growth of Per-Message Time Even Without Noise
+};
+
+static const Metric_t METRICS[] = {
+    {"throughput", "msg/s", true,  0.20},
+    {"p50_us",     "us",    false, 0.20},
+    {"p99_us",     "us",    false, 0.25},
+};
+static constexpr size_t NUM_METRICS = sizeof(METRICS) / sizeof(METRICS[0]);
+
+/**
+ * @brief Median And Relative Noise of One Metric Over All Runs
+ */
+struct Measured_t
+{
+    double value = 0.0;
+    double noise = 0.0;
+};
+
+/************************************************/
+/*                  Helpers                     */
+/************************************************/
+/**
+ * @brief Returns Value At Given Fraction of Sorted Values (Nearest Rank)
+ * @param values Measured Values
+ * @param fraction Fraction Between 0 And 1
+ *
+ * @return Percentile, 0 For No Values
+ */
+static double percentile(std::vector<double> values, double fraction)
+{
+    if (values.empty())
+        return 0.0;
+    std::sort(values.begin(), values.end());
+    size_t rank = static_cast<size_t>(std::ceil(fraction * values.size()));
+    return values[std::clamp<size_t>(rank, 1, values.size()) - 1];
+}
+
+/**
+ * @brief Summarises Runs By Median And Median Absolute Deviation
+ * @param values Value of Each Run
+ *
+ * @return Median And Deviation Relative To It
+ */
+static Measured_t summarise(const std::vector<double>& values)
+{
+    Measured_t measured;
+    measured.value = percentile(values, 0.5);
+    std::vector<double> deviations;
+    for (double value : values)
+    {
+        deviations.push_back(std::fabs(value - measured.value));
+    }
+    if (0.0 != measured.value)
+        measured.noise = percentile(deviations, 0.5) / measured.value;
+    return measured;
+}
+
+/************************************************/
+/*                  Class                       */
+/************************************************/
+/**
+ * @brief IPK24 Server On Loopback, Records When Messages Arrive
+ *
+ * Answers AUTH And JOIN With REPLY OK, Confirms UDP Messages And Can Push
+ * MSG To The Client. Loss Drops Client's MSG Or Server's CONFIRM of It.
+ */
+class LoopbackServer
+{
+    public:
+        ~LoopbackServer() { stop(); }
+
+        /**
+         * @brief Binds Ephemeral Port And Starts Server Thread
+         * @param useUdp Serve UDP Instead of TCP
+         * @param loss Probability of Losing MSG Or Its CONFIRM
+         *
+         * @return SUCCESS, FAIL If Socket Could Not Be Bound
+         */
+        int start(bool useUdp, double loss)
+        {
+            udp = useUdp;
+            dropping = std::bernoulli_distribution(loss);
+            generator.seed(LOSS_SEED);
+            listenSock = socket(AF_INET, udp ? SOCK_DGRAM : SOCK_STREAM, 0);
+            struct sockaddr_in addr = {};
+            addr.sin_family = AF_INET;
+            addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            socklen_t len = sizeof(addr);
+            if (0 > listenSock || 0 != bind(listenSock, (struct sockaddr*)&addr, sizeof(addr)) ||
+                (!udp && 0 != listen(listenSock, 1)) || 0 != getsockname(listenSock, (struct sockaddr*)&addr, &len))
+            {
+                fprintf(stderr,"ERR: Loopback Server Could Not Be Started\n");
+                return FAIL;
+            }
+            port = ntohs(addr.sin_port);
+            thread = std::thread(&LoopbackServer::run, this);
+            return SUCCESS;
+        }
+        void stop()
+        {
+            stopping = true;
+            if (thread.joinable())
+                thread.join();
+            for (int* fd : {&peerSock, &listenSock})
+            {
+                if (0 <= *fd)
+                    close(*fd);
+                *fd = -1;
+            }
+        }
+        uint16_t getPort() const { return port; }
+
+        /**
+         * @brief Sends MSG "r<index>" To The Client
+         * @param index Number of The Message
+         */
+        void push(uint32_t index)
+        {
+            std::string content = "r" + std::to_string(index);
+            std::lock_guard<std::mutex> guard(lock);
+            if (!udp)
+            {
+                std::string line = "MSG FROM Server IS " + content + "\r\n";
+                ssize_t bytesTx = send(peerSock, line.data(), line.size(), MSG_NOSIGNAL);
+                (void)bytesTx;
+                return;
+            }
+            uint16_t id = nextId++;
+            pushed[id] = index;
+            std::vector<uint8_t> datagram = {0x04, static_cast<uint8_t>(id >> 8), static_cast<uint8_t>(id), 'S', 'e', 'r', 'v', 'e', 'r', '\0'};
+            datagram.insert(datagram.end(), content.begin(), content.end());
+            datagram.push_back('\0');
+            sendto(listenSock, datagram.data(), datagram.size(), 0, (struct sockaddr*)&peer, sizeof(peer));
+        }
+
+        /**
+         * @brief Waits Until Message Arrives (UDP Pushed Message: Until Its CONFIRM)
+         * @param index Number of The Message
+         * @param at Time of Arrival
+         *
+         * @return True If It Arrived Before Deadline
+         */
+        bool waitArrival(uint32_t index, Clock::time_point& at)
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            bool came = arrived.wait_until(guard, Clock::now() + std::chrono::milliseconds(REPLY_TIMEOUT),
+                                           [&] { return arrivals.count(index); });
+            if (came)
+                at = arrivals[index];
+            return came;
+        }
+
+    private:
+        bool udp = false;
+        int listenSock = -1;
+        int peerSock = -1;                  //!< Accepted TCP Connection
+        uint16_t port = 0;
+        struct sockaddr_in peer = {};       //!< Client's UDP Address
+        std::thread thread;
+        std::atomic<bool> stopping{false};
+        std::mutex lock;
+        std::condition_variable arrived;
+        std::map<uint32_t, Clock::time_point> arrivals;
+        std::map<uint16_t, uint32_t> pushed;    //!< Message ID of Pushed UDP MSG -> Its Number
+        uint16_t nextId = 1;
+        std::mt19937 generator;
+        std::bernoulli_distribution dropping;
+
+        void record(const std::string& content)
+        {
+            if (content.size() < 2 || 'm' != content[0])
+                return;
+            std::lock_guard<std::mutex> guard(lock);
+            arrivals.emplace(static_cast<uint32_t>(std::stoul(content.substr(1))), Clock::now());   // Retransmission Keeps First Arrival
+            arrived.notify_all();
+        }
+        void reply(const std::string& line)
+        {
+            ssize_t bytesTx = send(peerSock, line.data(), line.size(), MSG_NOSIGNAL);
+            (void)bytesTx;
+        }
+        void handleLine(const std::string& line)
+        {
+            if (0 == line.rfind("AUTH ", 0))
+                reply("REPLY OK IS Auth ok\r\n");
+            else if (0 == line.rfind("JOIN ", 0))
+                reply("REPLY OK IS Join ok\r\n");
+            else if (0 == line.rfind("MSG FROM ", 0) && std::string::npos != line.find(" IS "))
+                record(line.substr(line.find(" IS ") + 4));
+        }
+        void confirm(const uint8_t* data, const struct sockaddr_in& from)
+        {
+            uint8_t datagram[3] = {0x00, data[1], data[2]};
+            sendto(listenSock, datagram, sizeof(datagram), 0, (const struct sockaddr*)&from, sizeof(from));
+        }
+        void handleDatagram(const uint8_t* data, size_t size, const struct sockaddr_in& from)
+        {
+            if (size < 3)
+                return;
+            uint16_t id = static_cast<uint16_t>(data[1] << 8 | data[2]);
+            if (0x00 == data[0])
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                auto message = pushed.find(id);
+                if (pushed.end() != message)
+                {
+                    arrivals.emplace(message->second, Clock::now());
+                    arrived.notify_all();
+                }
+                return;
+            }
+            if (0x04 == data[0] && dropping(generator))
+                return;                                                         // MSG Lost On The Way In
+            if (0x04 != data[0] || !dropping(generator))
+                confirm(data, from);                                            // Otherwise CONFIRM Lost On The Way Out
+
+            if (0x02 == data[0] || 0x03 == data[0])
+            {
+                std::lock_guard<std::mutex> guard(lock);
+                peer = from;
+                uint16_t replyId = nextId++;
+                uint8_t datagram[] = {0x01, static_cast<uint8_t>(replyId >> 8), static_cast<uint8_t>(replyId), 1,
+                                      data[1], data[2], 'A', 'u', 't', 'h', ' ', 'o', 'k', '\0'};
+                sendto(listenSock, datagram, sizeof(datagram), 0, (const struct sockaddr*)&from, sizeof(from));
+            }
+            else if (0x04 == data[0])
+            {
+                const char* displayName = reinterpret_cast<const char*>(data) + 3;
+                size_t nameLength = strnlen(displayName, size - 3);
+                if (3 + nameLength + 1 < size)
+                    record(std::string(displayName + nameLength + 1, strnlen(displayName + nameLength + 1, size - 4 - nameLength)));
+            }
+        }
+        void run()
+        {
+            std::string pending;
+            char buffer[2048];
+            while (!stopping)
+            {
+                struct pollfd pfd = {udp || 0 > peerSock ? listenSock : peerSock, POLLIN, 0};
+                if (0 >= poll(&pfd, 1, SERVER_TICK))
+                    continue;
+                if (udp)
+                {
+                    struct sockaddr_in from = {};
+                    socklen_t len = sizeof(from);
+                    ssize_t bytesRx = recvfrom(listenSock, buffer, sizeof(buffer), 0, (struct sockaddr*)&from, &len);
+                    if (0 < bytesRx)
+                        handleDatagram(reinterpret_cast<uint8_t*>(buffer), bytesRx, from);
+                    continue;
+                }
+                if (0 > peerSock)
+                {
+                    int accepted = accept(listenSock, nullptr, nullptr);
+                    std::lock_guard<std::mutex> guard(lock);
+                    peerSock = accepted;
+                    continue;
+                }
+                ssize_t bytesRx = recv(peerSock, buffer, sizeof(buffer), 0);
+                if (0 >= bytesRx)
+                    break;
+                pending.append(buffer, bytesRx);
+                size_t end;
+                while (std::string::npos != (end = pending.find("\r\n")))
+                {
+                    handleLine(pending.substr(0, end));
+                    pending.erase(0, end + 2);
+                }
+            }
+        }
+};
+
+/**
+ * @brief Client Process With Piped STDIN And STDOUT
+ */
+class ClientProcess
+{
+    public:
+        ~ClientProcess() { stop(); }
+
+        /**
+         * @brief Starts The Client, Its STDERR Is Discarded
+         * @param args Arguments Including Path of The Binary
+         *
+         * @return SUCCESS, FAIL If The Process Could Not Be Started
+         */
+        int start(const std::vector<std::string>& args)
+        {
+            int toClient[2], fromClient[2];
+            if (0 != pipe(toClient) || 0 != pipe(fromClient))
+                return FAIL;
+            pid = fork();
+            if (0 == pid)
+            {
+                dup2(toClient[0], STDIN_FILENO);
+                dup2(fromClient[1], STDOUT_FILENO);
+                int devNull = open("/dev/null", O_WRONLY);
+                dup2(devNull, STDERR_FILENO);
+                for (int fd : {toClient[0], toClient[1], fromClient[0], fromClient[1], devNull})
+                    close(fd);
+                std::vector<char*> argv;
+                for (const std::string& arg : args)
+                    argv.push_back(const_cast<char*>(arg.c_str()));
+                argv.push_back(nullptr);
+                execv(argv[0], argv.data());
+                _exit(127);
+            }
+            close(toClient[0]);
+            close(fromClient[1]);
+            input = toClient[1];
+            output = fromClient[0];
+            return 0 < pid ? SUCCESS : FAIL;
+        }
+        /**
+         * @brief Types One Line Into Client's STDIN
+         * @param line Line Without Line Ending
+         */
+        void type(const std::string& line)
+        {
+            std::string withEnd = line + "\n";
+            ssize_t bytesTx = write(input, withEnd.data(), withEnd.size());
+            (void)bytesTx;
+        }
+        /**
+         * @brief Reads Client's STDOUT Until Line Containing Text
+         * @param text Awaited Text
+         *
+         * @return True If The Line Came Before Deadline
+         */
+        bool waitOutput(const std::string& text)
+        {
+            const auto deadline = Clock::now() + std::chrono::milliseconds(REPLY_TIMEOUT);
+            char chunk[512];
+            while (true)
+            {
+                size_t end;
+                while (std::string::npos != (end = pending.find('\n')))
+                {
+                    bool found = pending.find(text) < end;
+                    pending.erase(0, end + 1);
+                    if (found)
+                        return true;
+                }
+                int remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - Clock::now()).count();
+                struct pollfd pfd = {output, POLLIN, 0};
+                if (0 >= remaining || 0 >= poll(&pfd, 1, remaining))
+                    return false;
+                ssize_t bytesRx = read(output, chunk, sizeof(chunk));
+                if (0 >= bytesRx)
+                    return false;
+                pending.append(chunk, bytesRx);
+            }
+        }
+        /**
+         * @brief Interrupts The Client (It Says BYE), Kills It If It Does Not End
+         */
+        void stop()
+        {
+            if (0 < pid)
+            {
+                kill(pid, SIGINT);
+                int status;
+                for (int tick = 0; tick < 100 && 0 == waitpid(pid, &status, WNOHANG); tick++)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                if (0 == kill(pid, SIGKILL))
+                    waitpid(pid, &status, 0);
+                pid = -1;
+            }
+            for (int* fd : {&input, &output})
+            {
+                if (0 <= *fd)
+                    close(*fd);
+                *fd = -1;
+            }
+        }
+
+    private:
+        pid_t pid = -1;
+        int input = -1;
+        int output = -1;
+        std::string pending;            //!< Read But Not Yet Matched Output
+};
+
+/************************************************/
+/*                  Scenarios                   */
+/************************************************/
+/**
+ * @brief Runs Scenario Once
+ * @param scenario Scenario To Run
+ * @param client Path of Client Binary
+ * @param messages Number of Messages
+ * @param metrics Measured Throughput, p50 And p99 (Order of METRICS)
+ *
+ * @return SUCCESS, FAIL If Some Step Timed Out
+ */
+static int runScenario(const Scenario_t& scenario, const std::string& client, uint32_t messages, double (&metrics)[NUM_METRICS])
+{
+    LoopbackServer server;
+    ClientProcess process;
+    if (SUCCESS != server.start(scenario.udp, scenario.loss))
+        return FAIL;
+
+    std::vector<std::string> args = {client, "-t", scenario.udp ? "udp" : "tcp", "-s", "127.0.0.1", "-p", std::to_string(server.getPort())};
+    if (scenario.udp)
+        args.insert(args.end(), {"-d", "50", "-r", "10"});
+    if (SUCCESS != process.start(args))
+        return FAIL;
+    process.type("/auth perf secret Perf");
+    if (!process.waitOutput("Success: Auth ok"))
+    {
+        fprintf(stderr,"ERR: %s: Client Did Not Authenticate\n", scenario.name);
+        return FAIL;
+    }
+
+    std::vector<double> latencies;
+    const Clock::time_point begin = Clock::now();
+    Clock::time_point end = begin;
+    for (uint32_t index = 0; index < messages; index++)
+    {
+        Clock::time_point sent = Clock::now();
+        bool came;
+        if (!scenario.flood)
+        {
+            process.type("m" + std::to_string(index));
+            came = server.waitArrival(index, end);
+        }
+        else
+        {
+            server.push(index);
+            if (scenario.udp)
+            {
+                came = server.waitArrival(index, end);
+            }
+            else
+            {
+                came = process.waitOutput("Server: r" + std::to_string(index));
+                end = Clock::now();
+            }
+        }
+        if (!came)
+        {
+            fprintf(stderr,"ERR: %s: Message %u Did Not Arrive\n", scenario.name, index);
+            return FAIL;
+        }
+        latencies.push_back(std::chrono::duration<double, std::micro>(end - sent).count());
+    }
+
+    metrics[0] = messages / std::chrono::duration<double>(end - begin).count();
+    metrics[1] = percentile(latencies, 0.50);
+    metrics[2] = percentile(latencies, 0.99);
+    return SUCCESS;
+}
+
+/************************************************/
+/*                  Baseline                    */
+/************************************************/
+/**
+ * @brief Reads Numbers of JSON File Under Their Dotted Key Paths
+ * @param path Path of The File
+ * @param values Values By Key Path ("scenarios.tcp-bulk-send.p50_us.value")
+ *
+ * Enough For Baseline Written By writeBaseline(), Arrays Are Not Supported.
+ * @return SUCCESS, FAIL If The File Could Not Be Read
+ */
+static int readBaseline(const std::string& path, std::map<std::string, double>& values)
+{
+    std::ifstream file(path);
+    if (!file)
+        return FAIL;
+    std::stringstream content;
+    content << file.rdbuf();
+    const std::string text = content.str();
+
+    std::vector<std::string> keys;
+    std::string key;
+    for (size_t idx = 0; idx < text.size(); idx++)
+    {
+        char character = text[idx];
+        if ('"' == character)
+        {
+            size_t close = text.find('"', idx + 1);
+            key = text.substr(idx + 1, close - idx - 1);
+            idx = close;
+        }
+        else if ('{' == character)
+        {
+            keys.push_back(key);
+        }
+        else if ('}' == character && !keys.empty())
+        {
+            keys.pop_back();
+        }
+        else if ('-' == character || std::isdigit(static_cast<unsigned char>(character)))
+        {
+            size_t length = 0;
+            double value = std::stod(text.substr(idx), &length);
+            std::string fullKey;
+            for (size_t level = 1; level < keys.size(); level++)
+                fullKey += keys[level] + ".";
+            values[fullKey + key] = value;
+            idx += length - 1;
+        }
+    }
+    return SUCCESS;
+}
+
+/**
+ * @brief Writes Measured Scenarios As Baseline
+ * @param path Path of The File
+ * @param results Measured Metrics By Scenario
+ *
+ * @return SUCCESS, FAIL If The File Could Not Be Written
+ */
+static int writeBaseline(const std::string& path, const std::map<std::string, std::vector<Measured_t>>& results)
+{
+    FILE* file = fopen(path.c_str(), "w");
+    if (nullptr == file)
+        return FAIL;
+    fprintf(file, "{\n  \"scenarios\": {\n");
+    size_t scenarioIdx = 0;
+    for (const Scenario_t& scenario : SCENARIOS)
+    {
+        const std::vector<Measured_t>& measured = results.at(scenario.name);
+        fprintf(file, "    \"%s\": {\n", scenario.name);
+        for (size_t metric = 0; metric < NUM_METRICS; metric++)
+        {
+            fprintf(file, "      \"%s\": {\"value\": %.1f, \"noise\": %.4f}%s\n", METRICS[metric].name,
+                    measured[metric].value, measured[metric].noise, NUM_METRICS - 1 == metric ? "" : ",");
+        }
+        fprintf(file, "    }%s\n", ++scenarioIdx == results.size() ? "" : ",");
+    }
+    fprintf(file, "  }\n}\n");
+    fclose(file);
+    return SUCCESS;
+}
+
+/**
+ * @brief Prints Table of Baseline And Current Values, Marks Regressions
+ * @param baseline Baseline Values By Key Path
+ * @param results Measured Metrics By Scenario
+ *
+ * Metrics Are Compared As Time Per Message. Allowed Growth Is The Larger
+ * of Metric's Floor And NOISE_FACTOR Times Noise of Baseline Or Current
+ * Runs, Whichever Is Noisier.
+ * @return Number of Regressions
+ */
+static int compare(const std::map<std::string, double>& baseline, const std::map<std::string, std::vector<Measured_t>>& results)
+{
+    int regressions = 0;
+    printf("%-16s %-11s %14s %14s %9s %9s\n", "Scenario", "Metric", "Baseline", "Current", "Change", "Allowed");
+    for (const Scenario_t& scenario : SCENARIOS)
+    {
+        const std::vector<Measured_t>& measured = results.at(scenario.name);
+        for (size_t metric = 0; metric < NUM_METRICS; metric++)
+        {
+            const Metric_t& info = METRICS[metric];
+            const std::string key = std::string("scenarios.") + scenario.name + "." + info.name + ".";
+            auto base = baseline.find(key + "value");
+            if (baseline.end() == base || 0.0 == base->second)
+            {
+                printf("%-16s %-11s %14s %8.1f %-5s %9s %9s  new\n", scenario.name, info.name, "-", measured[metric].value, info.unit, "-", "-");
+                continue;
+            }
+            double baseNoise = baseline.count(key + "noise") ? baseline.at(key + "noise") : 0.0;
+            double allowed = std::max(info.floor, NOISE_FACTOR * std::max(baseNoise, measured[metric].noise));
+            double change = (measured[metric].value - base->second) / base->second;
+            double grown = info.higherIsBetter ? base->second / measured[metric].value - 1.0 : change;
+            bool regressed = grown > allowed;
+            regressions += regressed ? 1 : 0;
+            double allowedChange = info.higherIsBetter ? 1.0 / (1.0 + allowed) - 1.0 : allowed;   // Allowed Growth of Time As Change of Value
+            printf("%-16s %-11s %8.1f %-5s %8.1f %-5s %+8.1f%% %+8.1f%%  %s\n", scenario.name, info.name,
+                   base->second, info.unit, measured[metric].value, info.unit, 100.0 * change,
+                   100.0 * allowedChange, regressed ? "REGRESSED" : "ok");
+        }
+    }
+    return regressions;
+}
+
+/************************************************/
+/*                  Main                        */
+/************************************************/
+int main(int argc, char* argv[])
+{
+    bool update = false;
+    uint32_t runs = 5;
+    uint32_t messages = 500;
+    std::vector<std::string> positional;
+    for (int idx = 1; idx < argc; idx++)
+    {
+        std::string arg(argv[idx]);
+        if ("--update" == arg)
+            update = true;
+        else if ("--runs" == arg && idx + 1 < argc)
+            runs = static_cast<uint32_t>(std::stoul(argv[++idx]));
+        else if ("--messages" == arg && idx + 1 < argc)
+            messages = static_cast<uint32_t>(std::stoul(argv[++idx]));
+        else
+            positional.push_back(arg);
+    }
+    if (2 != positional.size() || 0 == runs || 0 == messages)
+    {
+        fprintf(stderr,"Usage: %s [--update] [--runs N] [--messages N] CLIENT BASELINE\n", argv[0]);
+        return FAIL;
+    }
+    signal(SIGPIPE, SIG_IGN);
+
+    std::map<std::string, std::vector<Measured_t>> results;
+    for (const Scenario_t& scenario : SCENARIOS)
+    {
+        std::vector<double> perRun[NUM_METRICS];
+        for (uint32_t run = 0; run < runs; run++)
+        {
+            double metrics[NUM_METRICS];
+            if (SUCCESS != runScenario(scenario, positional[0], messages, metrics))
+                return FAIL;
+            for (size_t metric = 0; metric < NUM_METRICS; metric++)
+                perRun[metric].push_back(metrics[metric]);
+        }
+        for (size_t metric = 0; metric < NUM_METRICS; metric++)
+            results[scenario.name].push_back(summarise(perRun[metric]));
+        const std::vector<Measured_t>& measured = results[scenario.name];
+        fprintf(stderr,"INFO: %-16s %9.1f msg/s, p50 %8.1f us, p99 %8.1f us\n", scenario.name,
+                measured[0].value, measured[1].value, measured[2].value);
+    }
+
+    if (update)
+    {
+        if (SUCCESS != writeBaseline(positional[1], results))
+        {
+            fprintf(stderr,"ERR: Baseline %s Could Not Be Written\n", positional[1].c_str());
+            return FAIL;
+        }
+        fprintf(stderr,"INFO: Baseline Written To %s\n", positional[1].c_str());
+        return SUCCESS;
+    }
+
+    std::map<std::string, double> baseline;
+    if (SUCCESS != readBaseline(positional[1], baseline))
+    {
+        fprintf(stderr,"ERR: Baseline %s Could Not Be Read, Create It By make perf-baseline\n", positional[1].c_str());
+        return FAIL;
+    }
+    int regressions = compare(baseline, results);
+    fflush(stdout);
+    if (0 != regressions)
+    {
+        fprintf(stderr,"ERR: %d Metric/s Regressed Against %s\n", regressions, positional[1].c_str());
+        return FAIL;
+    }
+    fprintf(stderr,"INFO: No Regression Against %s\n", positional[1].c_str());
+    return SUCCESS;
+}
@@ -0,0 +1,47 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_backoff.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Exponential Backoff With Jitter.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_backoff.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Exponential Backoff With Jitter.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include "../src/backoff.cpp"
+
+using namespace std::chrono_literals;
+
+/**
+* @brief Test that delays stay within half and whole of doubling step up to the cap
+*/
+TEST(BackoffTest, DoublesWithinJitterUpToCap) {
+    Backoff backoff(100ms, 1000ms);
+    std::chrono::milliseconds step = 100ms;
+    for (int attempt = 0; attempt < 8; attempt++)
+    {
+        std::chrono::milliseconds delay = backoff.next();
+        EXPECT_GE(delay, step / 2);
+        EXPECT_LE(delay, step);
+        step = std::min(step * 2, std::chrono::milliseconds(1000ms));
+    }
+}
+
+/**
+* @brief Test that reset() starts again from the initial step
+*/
+TEST(BackoffTest, ResetStartsOver) {
+    Backoff backoff(100ms, 1000ms);
+    for (int attempt = 0; attempt < 5; attempt++)
+        backoff.next();
+    backoff.reset();
+    EXPECT_LE(backoff.next(), 100ms);
+}
@@ -0,0 +1,123 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_capture.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For pcapng Block Encoding of Wire Capture.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_capture.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For pcapng Block Encoding of Wire Capture.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <iterator>
+#include "../src/mapped_file.cpp"
+#include "../src/capture.cpp"
+
+static std::string capturePath()
+{
+    return "/tmp/ipk24chat_capture_test_" + std::to_string(getpid()) + ".pcapng";
+}
+
+static std::vector<uint8_t> readFile(const std::string& path)
+{
+    std::ifstream stream(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+}
+
+static uint32_t get32(const std::vector<uint8_t>& bytes, size_t offset)
+{
+    uint32_t value;
+    memcpy(&value, bytes.data() + offset, sizeof(value));
+    return value;
+}
+
+static uint16_t get16(const std::vector<uint8_t>& bytes, size_t offset)
+{
+    uint16_t value;
+    memcpy(&value, bytes.data() + offset, sizeof(value));
+    return value;
+}
+
+TEST(CaptureTest, WritesSectionInterfaceAndPacketBlocks)
+{
+    const std::string path = capturePath();
+    ASSERT_EQ(SUCCESS, Capture::open(path, "udp"));
+    const uint8_t datagram[] = {0x04, 0x00, 0x01, 'H', 'i'};
+    const char segment[] = "MSG FROM a IS b\r\n";
+    Capture::record(Capture::INBOUND, datagram, sizeof(datagram));
+    Capture::record(Capture::OUTBOUND, segment, strlen(segment));
+    Capture::close();
+
+    std::vector<uint8_t> bytes = readFile(path);
+    unlink(path.c_str());
+
+    // Section Header Block
+    ASSERT_LE(28u, bytes.size());
+    EXPECT_EQ(PCAPNG_SHB, get32(bytes, 0));
+    EXPECT_EQ(28u, get32(bytes, 4));
+    EXPECT_EQ(PCAPNG_BYTE_ORDER, get32(bytes, 8));
+    EXPECT_EQ(1u, get16(bytes, 12));
+    EXPECT_EQ(0u, get16(bytes, 14));
+    EXPECT_EQ(28u, get32(bytes, 24));
+
+    // Interface Description Block With if_name "udp" Padded To 4 Bytes
+    size_t offset = 28;
+    const uint32_t idbLength = 32;
+    ASSERT_LE(offset + idbLength, bytes.size());
+    EXPECT_EQ(PCAPNG_IDB, get32(bytes, offset));
+    EXPECT_EQ(idbLength, get32(bytes, offset + 4));
+    EXPECT_EQ(PCAPNG_LINKTYPE_USER0, get16(bytes, offset + 8));
+    EXPECT_EQ(PCAPNG_OPT_IF_NAME, get16(bytes, offset + 16));
+    EXPECT_EQ(3u, get16(bytes, offset + 18));
+    EXPECT_EQ(0, memcmp(bytes.data() + offset + 20, "udp\0", 4));
+    EXPECT_EQ(PCAPNG_OPT_END, get16(bytes, offset + 24));
+    EXPECT_EQ(idbLength, get32(bytes, offset + idbLength - 4));
+    offset += idbLength;
+
+    // Enhanced Packet Blocks, Payload Padded To 4 Bytes, Direction In epb_flags
+    const struct { const void* data; size_t length; uint32_t direction; } packets[] = {
+        {datagram, sizeof(datagram), Capture::INBOUND},
+        {segment, strlen(segment), Capture::OUTBOUND},
+    };
+    uint64_t previousTimestamp = 0;
+    for (const auto& packet : packets)
+    {
+        const size_t dataLength = (packet.length + 3) & ~static_cast<size_t>(3);
+        const uint32_t epbLength = 28 + dataLength + 16;
+        ASSERT_LE(offset + epbLength, bytes.size());
+        EXPECT_EQ(PCAPNG_EPB, get32(bytes, offset));
+        EXPECT_EQ(epbLength, get32(bytes, offset + 4));
+        EXPECT_EQ(0u, get32(bytes, offset + 8));
+        uint64_t timestamp = (static_cast<uint64_t>(get32(bytes, offset + 12)) << 32) | get32(bytes, offset + 16);
+        EXPECT_LE(previousTimestamp, timestamp);
+        previousTimestamp = timestamp;
+        EXPECT_EQ(packet.length, get32(bytes, offset + 20));
+        EXPECT_EQ(packet.length, get32(bytes, offset + 24));
+        EXPECT_EQ(0, memcmp(bytes.data() + offset + 28, packet.data, packet.length));
+        for (size_t idx = packet.length; idx < dataLength; idx++)
+            EXPECT_EQ(0u, bytes[offset + 28 + idx]);
+        size_t options = offset + 28 + dataLength;
+        EXPECT_EQ(PCAPNG_OPT_EPB_FLAGS, get16(bytes, options));
+        EXPECT_EQ(4u, get16(bytes, options + 2));
+        EXPECT_EQ(packet.direction, get32(bytes, options + 4));
+        EXPECT_EQ(PCAPNG_OPT_END, get16(bytes, options + 8));
+        EXPECT_EQ(epbLength, get32(bytes, offset + epbLength - 4));
+        offset += epbLength;
+    }
+    EXPECT_EQ(offset, bytes.size());
+}
+
+TEST(CaptureTest, RecordWithoutOpenFileDoesNothing)
+{
+    const uint8_t datagram[] = {0x00, 0x00, 0x01};
+    Capture::record(Capture::INBOUND, datagram, sizeof(datagram));
+    SUCCEED();
+}
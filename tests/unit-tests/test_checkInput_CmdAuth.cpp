@@ -24,7 +24,7 @@ protected:
 
     void SetUp() override {
         //TODO: Look If The Command Is Ended By '\n'
-        std::vector<char> content = {'/', 'a', 'u', 't', 'h', ' ', 'u', 's', 'e', 'r', ' ', 'p', 'a', 's', 's', 'w', 'o', 'r', 'd', ' ', 'D', 'i', 's', 'p', 'l', 'a', 'y', ' ', 'N', 'a', 'm', 'e', '\n'};
+        CharBuffer content = {'/', 'a', 'u', 't', 'h', ' ', 'u', 's', 'e', 'r', ' ', 'p', 'a', 's', 's', 'w', 'o', 'r', 'd', ' ', 'D', 'i', 's', 'p', 'l', 'a', 'y', ' ', 'N', 'a', 'm', 'e', '\n'};
         preparedMessage.content = content;
     }
 };
@@ -24,7 +24,7 @@ protected:
 
     void SetUp() override {
         //TODO: Look If The Command Is Ended By '\n'
-        std::vector<char> content = {'/', 'j', 'o', 'i', 'n', ' ', 'c', 'h', 'a', 'n', 'n', 'e', 'l', '1', '\n'};
+        CharBuffer content = {'/', 'j', 'o', 'i', 'n', ' ', 'c', 'h', 'a', 'n', 'n', 'e', 'l', '1', '\n'};
         preparedMessage.content = content;
     }
 };
@@ -0,0 +1,217 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_connect.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Connecting Session Without Blocking The Scheduler.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_connect.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Connecting Session Without Blocking The Scheduler.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <netinet/in.h>
+#include "../src/arguments.cpp"
+#include "../src/resolver.cpp"
+#include "../src/socket_options.cpp"
+#include "../src/token_bucket.cpp"
+#include "../src/backoff.cpp"
+#include "../src/trace.cpp"
+#include "../src/capture.cpp"
+#include "../src/mapped_file.cpp"
+#include "../src/jsonl_writer.cpp"
+#include "../src/shm_ring.cpp"
+#include "../src/daemon_hub.cpp"
+#include "../src/renderer.cpp"
+#include "../src/file_sender.cpp"
+#include "../src/history.cpp"
+#include "../src/search_index.cpp"
+#include "../src/message_memory.cpp"
+#include "../src/scheduler.cpp"
+#include "../src/strings.cpp"
+#include "../src/base_client.cpp"
+#include "../src/base_messages.cpp"
+#include "../src/tcp_messages.cpp"
+#include "../src/session.cpp"
+#include "../src/tcp_session.cpp"
+
+/**
+ * @brief Listener Whose Accept Queue Is Full, Further Connects Stall
+ */
+class StalledListener
+{
+    public:
+        StalledListener()
+        {
+            listener = socket(AF_INET, SOCK_STREAM, 0);
+            struct sockaddr_in address = {};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            bind(listener, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+            socklen_t length = sizeof(address);
+            getsockname(listener, reinterpret_cast<struct sockaddr*>(&address), &length);
+            port = ntohs(address.sin_port);
+            listen(listener, 0);
+            for (int idx = 0; idx < 2; idx++)
+            {
+                int filler = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0);
+                connect(filler, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+                fillers.push_back(filler);
+            }
+            usleep(50000);
+        }
+        ~StalledListener()
+        {
+            for (int filler : fillers)
+                close(filler);
+            close(listener);
+        }
+
+        int listener;
+        int port;
+        std::vector<int> fillers;
+};
+
+/**
+ * @brief Counts Ticks of Timer Until Stopped
+ */
+static Task<> tick(Scheduler& scheduler, int& ticks, const bool& stopped)
+{
+    while (!stopped)
+    {
+        co_await scheduler.sleepUntil(Scheduler::Clock::now() + std::chrono::milliseconds(20));
+        ticks++;
+    }
+}
+
+/**
+ * @brief Runs Scheduler Until The Session Ends or Time Runs Out
+ */
+static bool runUntilFinished(Scheduler& scheduler, const Session& session, std::chrono::milliseconds limit)
+{
+    const auto deadline = Scheduler::Clock::now() + limit;
+    while (!session.isFinished() && Scheduler::Clock::now() < deadline)
+        scheduler.runOnce();
+    return session.isFinished();
+}
+
+TEST(ConnectTest, TimerRunsWhileConnectStalls)
+{
+    StalledListener server;
+    Scheduler scheduler;
+    TcpSession session(scheduler, "", "127.0.0.1", server.port, 300);
+    int ticks = 0;
+    bool stopped = false;
+    Task<> timer = tick(scheduler, ticks, stopped);
+    timer.start();
+
+    testing::internal::CaptureStderr();
+    session.start();
+    EXPECT_FALSE(session.isFinished());
+    bool finished = runUntilFinished(scheduler, session, std::chrono::milliseconds(2000));
+    std::string errors = testing::internal::GetCapturedStderr();
+    stopped = true;
+
+    ASSERT_TRUE(finished);
+    EXPECT_EQ(CONNECT_FAILED, session.getExitCode());
+    EXPECT_NE(std::string::npos, errors.find("ERR: Connection To 127.0.0.1 Timed Out"));
+    EXPECT_LE(5, ticks);
+}
+
+TEST(ConnectTest, LeaveAbandonsStalledConnect)
+{
+    StalledListener server;
+    Scheduler scheduler;
+    TcpSession session(scheduler, "", "127.0.0.1", server.port, 5000);
+    int ticks = 0;
+    bool stopped = false;
+    Task<> timer = tick(scheduler, ticks, stopped);
+    timer.start();
+    session.start();
+    const auto until = Scheduler::Clock::now() + std::chrono::milliseconds(100);
+    while (Scheduler::Clock::now() < until)
+        scheduler.runOnce();
+    ASSERT_FALSE(session.isFinished());
+
+    testing::internal::CaptureStderr();
+    const auto leftAt = Scheduler::Clock::now();
+    session.leave();
+    bool finished = runUntilFinished(scheduler, session, std::chrono::milliseconds(1000));
+    std::string errors = testing::internal::GetCapturedStderr();
+    stopped = true;
+
+    ASSERT_TRUE(finished);
+    EXPECT_GT(std::chrono::milliseconds(200), Scheduler::Clock::now() - leftAt);
+    EXPECT_EQ(SUCCESS, session.getExitCode());
+    EXPECT_EQ(std::string::npos, errors.find("Timed Out"));
+}
+
+TEST(ConnectTest, LinesTypedWhileConnectingAreSentInOrder)
+{
+    StalledListener server;
+    std::vector<std::string> lines;
+    // Accept Queue Is Emptied Later, Retransmitted SYN Then Connects The Session
+    std::thread serving([&server, &lines] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        for (size_t idx = 0; idx < server.fillers.size(); idx++)
+            close(accept(server.listener, nullptr, nullptr));
+        int client = accept(server.listener, nullptr, nullptr);
+        std::string stream;
+        char chunk[512];
+        ssize_t bytesRx;
+        bool bye = false;
+        while (!bye && 0 < (bytesRx = recv(client, chunk, sizeof(chunk), 0)))
+        {
+            stream.append(chunk, bytesRx);
+            size_t end;
+            while (std::string::npos != (end = stream.find("\r\n")))
+            {
+                lines.push_back(stream.substr(0, end));
+                stream.erase(0, end + 2);
+                if (0 == lines.back().rfind("AUTH", 0))
+                {
+                    const char answer[] = "REPLY OK IS Fine\r\n";
+                    send(client, answer, sizeof(answer) - 1, MSG_NOSIGNAL);
+                }
+                bye = bye || "BYE" == lines.back();
+            }
+        }
+        close(client);
+    });
+
+    Scheduler scheduler;
+    TcpSession session(scheduler, "", "127.0.0.1", server.port, 5000);
+    int ticks = 0;
+    bool stopped = false;
+    Task<> timer = tick(scheduler, ticks, stopped);
+    timer.start();
+    session.start();
+    const auto until = Scheduler::Clock::now() + std::chrono::milliseconds(100);
+    while (Scheduler::Clock::now() < until)
+        scheduler.runOnce();
+
+    // Typed While Connecting, Nothing Is Lost or Reordered
+    session.handleLine("/auth u s Alice");
+    session.handleLine("hello");
+    session.requestLeave();
+    EXPECT_EQ(2u, session.queuedRecords());
+    EXPECT_FALSE(session.isFinished());
+
+    testing::internal::CaptureStdout();
+    bool finished = runUntilFinished(scheduler, session, std::chrono::milliseconds(5000));
+    testing::internal::GetCapturedStdout();
+    stopped = true;
+    serving.join();
+
+    ASSERT_TRUE(finished);
+    EXPECT_EQ(SUCCESS, session.getExitCode());
+    std::vector<std::string> expected = {"AUTH u AS Alice USING s", "MSG FROM Alice IS hello", "BYE"};
+    EXPECT_EQ(expected, lines);
+}
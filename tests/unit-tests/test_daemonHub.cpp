@@ -0,0 +1,82 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_daemonHub.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Unix Socket Hub Sharing One Session With Local Processes.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_daemonHub.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Unix Socket Hub Sharing One Session With Local Processes.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include "../src/daemon_hub.cpp"
+
+static int connectLocal(const std::string& path)
+{
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    struct sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    memcpy(address.sun_path, path.c_str(), path.size());
+    if (0 != connect(fd, reinterpret_cast<struct sockaddr*>(&address), sizeof(address)))
+    {
+        close(fd);
+        return -1;
+    }
+    struct timeval timeout = {2, 0};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    return fd;
+}
+
+static std::string readExactly(int fd, size_t length)
+{
+    std::string bytes(length, '\0');
+    size_t done = 0;
+    while (done < length)
+    {
+        ssize_t bytesRx = read(fd, bytes.data() + done, length - done);
+        if (0 >= bytesRx)
+            break;
+        done += bytesRx;
+    }
+    bytes.resize(done);
+    return bytes;
+}
+
+/**
+* @brief Test that one frame reaches every subscriber and records are forwarded to the input
+*/
+TEST(DaemonHubTest, FansOutAndForwards) {
+    std::string path = testing::TempDir() + "hub_test.sock";
+    ASSERT_EQ(DaemonHub::open(path, false), SUCCESS);
+    int first = connectLocal(path);
+    int second = connectLocal(path);
+    ASSERT_NE(first, -1);
+    ASSERT_NE(second, -1);
+
+    // Frames of One Process Are Handled In Order, Forwarded Record Follows Its Subscription
+    const char frames[] = {0x00, 0x01, LOCAL_SUBSCRIBE, 0x00, 0x03, 0x04, 'h', 'i'};
+    ASSERT_EQ(write(first, frames, sizeof(frames)), 8);
+    ASSERT_EQ(write(second, frames, sizeof(frames)), 8);
+    std::string forwarded("\x00\x03\x04hi\x00\x03\x04hi", 10);
+    EXPECT_EQ(readExactly(DaemonHub::getInputFd(), forwarded.size()), forwarded);
+
+    DaemonHub::Frame_t* frame = DaemonHub::newFrame(4);
+    memcpy(frame->body(), "\x04" "a\0b", 4);
+    DaemonHub::publish(frame);
+    std::string expected("\x00\x04\x04" "a\0b", 6);
+    EXPECT_EQ(readExactly(first, expected.size()), expected);
+    EXPECT_EQ(readExactly(second, expected.size()), expected);
+
+    close(first);
+    close(second);
+    DaemonHub::close();
+    EXPECT_NE(access(path.c_str(), F_OK), 0);
+}
@@ -0,0 +1,64 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_fixedString.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For String With Inline Storage of Fixed Capacity.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_fixedString.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For String With Inline Storage of Fixed Capacity.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include <string>
+#include "../include/fixed_string.hpp"
+
+/**
+* @brief Test that string up to capacity is stored whole
+*/
+TEST(FixedStringTest, StoresUpToCapacity) {
+    constexpr FixedString<5> literal("abcde");
+    static_assert(5 == literal.size());
+
+    FixedString<5> name;
+    std::string text = "abcde";
+    EXPECT_TRUE(name.assign(text.begin(), text.end()));
+    EXPECT_FALSE(name.overflowed());
+    EXPECT_EQ(std::string(name.begin(), name.end()), "abcde");
+}
+
+/**
+* @brief Test that exceeding capacity marks the string until it is cleared
+*/
+TEST(FixedStringTest, OverflowIsSticky) {
+    FixedString<3> name;
+    std::string text = "abcd";
+    EXPECT_FALSE(name.assign(text.begin(), text.end()));
+    EXPECT_TRUE(name.overflowed());
+    EXPECT_EQ(name.size(), 3u);
+
+    name.pop_back();
+    EXPECT_TRUE(name.overflowed());
+    name.clear();
+    EXPECT_FALSE(name.overflowed());
+    EXPECT_TRUE(name.empty());
+}
+
+/**
+* @brief Test that copy keeps content and overflow mark
+*/
+TEST(FixedStringTest, CopyKeepsState) {
+    FixedString<2> name;
+    name.push_back('a');
+    name.push_back('b');
+    name.push_back('c');
+    FixedString<2> copy = name;
+    EXPECT_EQ(std::string_view(copy), "ab");
+    EXPECT_TRUE(copy.overflowed());
+}
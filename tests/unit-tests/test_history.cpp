@@ -0,0 +1,152 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_history.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Recovery of History Log With Torn Tail.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_history.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Recovery of History Log With Torn Tail.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include "../src/mapped_file.cpp"
+#include "../src/history.cpp"
+
+static std::string historyPath(const char* name)
+{
+    return "/tmp/ipk24chat_history_test_" + std::to_string(getpid()) + "_" + name;
+}
+
+static void removeHistory(const std::string& path)
+{
+    unlink(path.c_str());
+    unlink((path + ".idx").c_str());
+}
+
+static void writeMessages(const std::string& path, int count)
+{
+    ASSERT_EQ(SUCCESS, History::open(path));
+    for (int i = 0; i < count; i++)
+        History::append(History::RECEIVED, BaseMessages::MSG, 0, "Bob", "general", "m" + std::to_string(i));
+    History::close();
+}
+
+/**
+ * @brief Returns Contents of Records Printed By dump()
+ */
+static std::vector<std::string> dumpContents(const std::string& path)
+{
+    testing::internal::CaptureStdout();
+    int result = History::dump(path, 0);
+    std::istringstream lines(testing::internal::GetCapturedStdout());
+    EXPECT_EQ(SUCCESS, result);
+    std::vector<std::string> contents;
+    std::string line;
+    while (std::getline(lines, line))
+        contents.push_back(line.substr(line.rfind(' ') + 1));
+    return contents;
+}
+
+static std::vector<std::string> expectedContents(int count)
+{
+    std::vector<std::string> contents;
+    for (int i = 0; i < count; i++)
+        contents.push_back("m" + std::to_string(i));
+    return contents;
+}
+
+static off_t fileSize(const std::string& path)
+{
+    struct stat info;
+    return (0 == stat(path.c_str(), &info)) ? info.st_size : -1;
+}
+
+/**
+ * @brief Reads Log Offset of Index Entry
+ */
+static uint64_t indexedOffset(const std::string& path, size_t entry)
+{
+    HistoryIndexEntry_t value;
+    std::ifstream stream(path + ".idx", std::ios::binary);
+    stream.seekg(HISTORY_HEADER_SIZE + entry * sizeof(value));
+    stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return value.offset;
+}
+
+TEST(HistoryTest, CutLastRecordIsDiscardedAndOverwritten)
+{
+    const std::string path = historyPath("cut");
+    removeHistory(path);
+    writeMessages(path, 70);
+    ASSERT_EQ(0, truncate(path.c_str(), fileSize(path) - 4));
+
+    ASSERT_EQ(SUCCESS, History::open(path));
+    History::append(History::RECEIVED, BaseMessages::MSG, 0, "Bob", "general", "after");
+    History::close();
+
+    std::vector<std::string> expected = expectedContents(69);
+    expected.push_back("after");
+    EXPECT_EQ(expected, dumpContents(path));
+    removeHistory(path);
+}
+
+TEST(HistoryTest, GarbageAfterLastRecordIsZeroed)
+{
+    const std::string path = historyPath("garbage");
+    removeHistory(path);
+    writeMessages(path, 10);
+    {
+        // Header of Record Whose Checksum Was Never Written
+        HistoryRecord_t torn = {};
+        torn.length = 64;
+        torn.contentLength = 8;
+        std::ofstream stream(path, std::ios::binary | std::ios::app);
+        stream.write(reinterpret_cast<const char*>(&torn), sizeof(torn));
+        stream.write("xxxxxxxxxxxxxxxxxxxxxxxx", 24);
+    }
+
+    testing::internal::CaptureStderr();
+    ASSERT_EQ(SUCCESS, History::open(path));
+    EXPECT_NE(std::string::npos, testing::internal::GetCapturedStderr().find("Torn Tail Discarded, 10 Records Kept"));
+    // Shorter Record Than The Torn One Must Not Leave Its Bytes Behind
+    History::append(History::RECEIVED, BaseMessages::MSG, 0, "", "", "s");
+    History::close();
+    ASSERT_EQ(SUCCESS, History::open(path));
+    History::append(History::RECEIVED, BaseMessages::MSG, 0, "Bob", "general", "last");
+    History::close();
+
+    std::vector<std::string> expected = expectedContents(10);
+    expected.push_back("s");
+    expected.push_back("last");
+    EXPECT_EQ(expected, dumpContents(path));
+    removeHistory(path);
+}
+
+TEST(HistoryTest, IndexEntryOfTornRecordIsDropped)
+{
+    const std::string path = historyPath("index");
+    removeHistory(path);
+    writeMessages(path, 70);
+    const uint64_t torn = indexedOffset(path, 1);
+    ASSERT_EQ(0, truncate(path.c_str(), torn + 8));
+
+    ASSERT_EQ(SUCCESS, History::open(path));
+    History::append(History::RECEIVED, BaseMessages::MSG, 0, "Bob", "general", "after");
+    History::close();
+
+    // Record 64 Is Written Again, So Index Gets Its Entry Back
+    EXPECT_EQ(torn, indexedOffset(path, 1));
+    std::vector<std::string> expected = expectedContents(64);
+    expected.push_back("after");
+    EXPECT_EQ(expected, dumpContents(path));
+    removeHistory(path);
+}
@@ -0,0 +1,147 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_inputReader.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Structured JSONL And Binary Input Records.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_inputReader.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Structured JSONL And Binary Input Records.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include "../src/shm_ring.cpp"
+#include "../src/input_reader.cpp"
+
+/**
+ * @brief Writes Bytes Into Pipe And Returns Its Read End
+ */
+static int pipeWith(const std::string& bytes)
+{
+    int ends[2];
+    if (0 != pipe(ends))
+        return -1;
+    ssize_t written = write(ends[1], bytes.data(), bytes.size());
+    (void)written;
+    close(ends[1]);
+    return ends[0];
+}
+
+static std::string text(const auto& field)
+{
+    return std::string(field.begin(), field.end());
+}
+
+/**
+* @brief Test that JSONL records are decoded without the command grammar and broken ones are skipped
+*/
+TEST(InputReaderTest, DecodesJsonlRecords) {
+    int fd = pipeWith("{\"type\":\"auth\",\"username\":\"user\",\"secret\":\"pass\",\"display_name\":\"Nick\"}\n"
+                      "{ \"type\" : \"msg\", \"content\" : \"/join \\\"x\\\"\", \"extra\":\"ignored\" }\n"
+                      "{\"type\":\"msg\"}\n"
+                      "{\"type\":\"rename\",\"display_name\":\"Other\"}");
+    ASSERT_NE(fd, -1);
+    InputReader reader;
+    reader.open(InputReader::JSONL, fd);
+    BaseMessages::Message_t msg;
+    while (reader.fill())
+        ;
+
+    ASSERT_EQ(reader.next(msg), InputReader::RECORD);
+    EXPECT_EQ(msg.type, BaseMessages::COMMAND_AUTH);
+    EXPECT_EQ(text(msg.login), "user");
+    EXPECT_EQ(text(msg.secret), "pass");
+    EXPECT_EQ(text(msg.displayName), "Nick");
+
+    ASSERT_EQ(reader.next(msg), InputReader::RECORD);
+    EXPECT_EQ(msg.type, BaseMessages::MSG);
+    EXPECT_EQ(text(msg.content), "/join \"x\"");
+    EXPECT_TRUE(msg.structured);
+
+    EXPECT_EQ(reader.next(msg), InputReader::INVALID);
+
+    ASSERT_EQ(reader.next(msg), InputReader::RECORD);
+    EXPECT_EQ(msg.type, BaseMessages::COMMAND_RENAME);
+    EXPECT_EQ(text(msg.content), "Other");
+    EXPECT_EQ(text(msg.displayName), "Nick");
+
+    EXPECT_EQ(reader.next(msg), InputReader::NONE);
+    close(fd);
+}
+
+/**
+* @brief Test that binary records are framed by their length and need all fields
+*/
+TEST(InputReaderTest, DecodesBinaryRecords) {
+    std::string join("\x03" "general", 8);
+    std::string empty("\x04", 1);
+    std::string content("\x04" "line\nwith break", 16);
+    std::string bytes;
+    for (const std::string& record : {join, empty, content})
+    {
+        bytes.push_back(static_cast<char>(record.size() >> 8));
+        bytes.push_back(static_cast<char>(record.size() & 0xFF));
+        bytes += record;
+    }
+    int fd = pipeWith(bytes.substr(0, 5));
+    ASSERT_NE(fd, -1);
+    InputReader reader;
+    reader.open(InputReader::BINARY, fd);
+    BaseMessages::Message_t msg;
+
+    reader.fill();
+    EXPECT_FALSE(reader.hasRecord());
+    close(fd);
+
+    fd = pipeWith(bytes.substr(5));
+    ASSERT_NE(fd, -1);
+    reader.open(InputReader::BINARY, fd);
+    while (reader.fill())
+        ;
+
+    ASSERT_EQ(reader.next(msg), InputReader::RECORD);
+    EXPECT_EQ(msg.type, BaseMessages::COMMAND_JOIN);
+    EXPECT_EQ(text(msg.channelID), "general");
+
+    EXPECT_EQ(reader.next(msg), InputReader::INVALID);
+
+    ASSERT_EQ(reader.next(msg), InputReader::RECORD);
+    EXPECT_EQ(msg.type, BaseMessages::MSG);
+    EXPECT_EQ(text(msg.content), "line\nwith break");
+
+    EXPECT_EQ(reader.next(msg), InputReader::NONE);
+    close(fd);
+}
+
+/**
+* @brief Test that text lines are framed for the command grammar and the last line needs no line ending
+*/
+TEST(InputReaderTest, FramesTextLines) {
+    int fd = pipeWith("/auth user pass Nick\r\nhello\n\nlast");
+    ASSERT_NE(fd, -1);
+    InputReader reader;
+    reader.open(InputReader::TEXT, fd);
+    BaseMessages::Message_t msg;
+
+    reader.fill();
+    ASSERT_EQ(reader.next(msg), InputReader::RECORD);
+    EXPECT_EQ(text(msg.buffer), "/auth user pass Nick\r\n");
+    EXPECT_FALSE(msg.structured);
+    ASSERT_EQ(reader.next(msg), InputReader::RECORD);
+    EXPECT_EQ(text(msg.buffer), "hello\r\n");
+    ASSERT_EQ(reader.next(msg), InputReader::RECORD);
+    EXPECT_EQ(text(msg.buffer), "\r\n");
+    EXPECT_FALSE(reader.hasRecord());
+
+    EXPECT_FALSE(reader.fill());
+    ASSERT_EQ(reader.next(msg), InputReader::RECORD);
+    EXPECT_EQ(text(msg.buffer), "last\r\n");
+    EXPECT_EQ(reader.next(msg), InputReader::NONE);
+    close(fd);
+}
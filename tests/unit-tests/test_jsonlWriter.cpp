@@ -0,0 +1,78 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_jsonlWriter.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For JSON Lines Writer With Background Flushing.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_jsonlWriter.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For JSON Lines Writer With Background Flushing.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include "../src/jsonl_writer.cpp"
+
+static std::string readFile(const std::string& path)
+{
+    std::ifstream file(path);
+    std::stringstream content;
+    content << file.rdbuf();
+    return content.str();
+}
+
+/**
+* @brief Test that fields are escaped and every record ends the line
+*/
+TEST(JsonlWriterTest, EscapesFields) {
+    std::string path = testing::TempDir() + "jsonl_escape.jsonl";
+    JsonlWriter writer;
+    ASSERT_EQ(writer.open(path, -1), SUCCESS);
+    writer.beginRecord();
+    writer.field("type", "msg");
+    writer.field("content", std::string_view("a\"b\\c\td\x01"));
+    writer.field("id", (int64_t)-1);
+    writer.booleanField("result", true);
+    writer.nullField("sender");
+    writer.endRecord();
+    writer.close();
+    EXPECT_EQ(readFile(path), "{\"type\":\"msg\",\"content\":\"a\\\"b\\\\c\\u0009d\\u0001\",\"id\":-1,\"result\":true,\"sender\":null}\n");
+}
+
+/**
+* @brief Test that records spanning many buffer swaps are all written in order
+*/
+TEST(JsonlWriterTest, SwapsBuffersInOrder) {
+    std::string path = testing::TempDir() + "jsonl_swap.jsonl";
+    JsonlWriter writer;
+    ASSERT_EQ(writer.open(path, -1), SUCCESS);
+    std::string content(1000, 'x');
+    const int records = 5000;
+    for (int idx = 0; idx < records; idx++)
+    {
+        writer.beginRecord();
+        writer.field("n", (int64_t)idx);
+        writer.field("content", content);
+        writer.endRecord();
+        if (0 == idx % 100)
+            writer.flush();
+    }
+    writer.close();
+
+    std::istringstream lines(readFile(path));
+    std::string line;
+    int expected = 0;
+    while (std::getline(lines, line))
+    {
+        EXPECT_EQ(line, "{\"n\":" + std::to_string(expected) + ",\"content\":\"" + content + "\"}");
+        expected++;
+    }
+    EXPECT_EQ(expected, records);
+}
@@ -18,9 +18,9 @@ protected:
         std::string longMessage = "MSG FROM John Travolta IS Hey There Lets Have a Group Message Together!\r\n";
 
         // Directly use the string's begin and end iterators to initialize the vector.
-        preparedMessage.content = std::vector<char>(testMessage.begin(), testMessage.end());
-        preparedMessage2.content = std::vector<char>(emptyMessage.begin(), emptyMessage.end());
-        preparedMessage3.content = std::vector<char>(longMessage.begin(), longMessage.end());
+        preparedMessage.content = CharBuffer(testMessage.begin(), testMessage.end());
+        preparedMessage2.content = CharBuffer(emptyMessage.begin(), emptyMessage.end());
+        preparedMessage3.content = CharBuffer(longMessage.begin(), longMessage.end());
     }
 };
 
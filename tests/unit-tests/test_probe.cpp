@@ -0,0 +1,182 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_probe.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Probes On Live Inbound Path of TCP And UDP Sessions.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_probe.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Probes On Live Inbound Path of TCP And UDP Sessions.
+ * ****************************/
+
+// Same As make probe
+#define PROBE_MACRO 1
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <netinet/in.h>
+#include "../src/probe.cpp"
+#include "../src/arguments.cpp"
+#include "../src/resolver.cpp"
+#include "../src/socket_options.cpp"
+#include "../src/token_bucket.cpp"
+#include "../src/backoff.cpp"
+#include "../src/timestamps.cpp"
+#include "../src/trace.cpp"
+#include "../src/capture.cpp"
+#include "../src/mapped_file.cpp"
+#include "../src/jsonl_writer.cpp"
+#include "../src/shm_ring.cpp"
+#include "../src/daemon_hub.cpp"
+#include "../src/renderer.cpp"
+#include "../src/file_sender.cpp"
+#include "../src/history.cpp"
+#include "../src/search_index.cpp"
+#include "../src/message_memory.cpp"
+#include "../src/scheduler.cpp"
+#include "../src/strings.cpp"
+#include "../src/base_client.cpp"
+#include "../src/base_messages.cpp"
+#include "../src/tcp_messages.cpp"
+#include "../src/udp_messages.cpp"
+#include "../src/session.cpp"
+#include "../src/tcp_session.cpp"
+#include "../src/udp_session.cpp"
+
+/**
+ * @brief Binds Loopback Socket To Ephemeral Port
+ * @return Port Number
+ */
+static int bindLoopback(int sock)
+{
+    struct sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(sock, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+    socklen_t length = sizeof(address);
+    getsockname(sock, reinterpret_cast<struct sockaddr*>(&address), &length);
+    return ntohs(address.sin_port);
+}
+
+/**
+ * @brief Runs Scheduler Until The Session Ends or Time Runs Out
+ */
+static bool runUntilFinished(Scheduler& scheduler, const Session& session, std::chrono::milliseconds limit)
+{
+    const auto deadline = Scheduler::Clock::now() + limit;
+    while (!session.isFinished() && Scheduler::Clock::now() < deadline)
+        scheduler.runOnce();
+    return session.isFinished();
+}
+
+/**
+ * @brief Counts Occurrences of Line In Captured Output
+ */
+static size_t countLines(const std::string& output, const std::string& line)
+{
+    size_t count = 0;
+    for (size_t at = output.find(line); std::string::npos != at; at = output.find(line, at + 1))
+        count++;
+    return count;
+}
+
+TEST(ProbeTest, TcpLinesAreCountedByDecodeLine)
+{
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    const int port = bindLoopback(listener);
+    listen(listener, 1);
+    std::thread server([listener] {
+        int client = accept(listener, nullptr, nullptr);
+        char chunk[512];
+        ssize_t bytesRx;
+        while (0 < (bytesRx = recv(client, chunk, sizeof(chunk), 0)))
+        {
+            std::string lines(chunk, bytesRx);
+            if (std::string::npos != lines.find("AUTH"))
+            {
+                const char answer[] = "REPLY OK IS Fine\r\nMSG FROM Bob IS hi\r\n";
+                send(client, answer, sizeof(answer) - 1, MSG_NOSIGNAL);
+            }
+            if (std::string::npos != lines.find("BYE"))
+                break;
+        }
+        close(client);
+    });
+
+    const uint64_t before = Probe::getCalls(Probe::DECODE_LINE);
+    Scheduler scheduler;
+    TcpSession session(scheduler, "", "127.0.0.1", port, 1000);
+    session.start();
+    session.handleLine("/auth u s Alice");
+    session.handleLine("after");
+    session.requestLeave();
+    testing::internal::CaptureStdout();
+    bool finished = runUntilFinished(scheduler, session, std::chrono::milliseconds(5000));
+    testing::internal::GetCapturedStdout();
+    server.join();
+    close(listener);
+
+    ASSERT_TRUE(finished);
+    EXPECT_LE(before + 1, Probe::getCalls(Probe::DECODE_LINE));
+    EXPECT_LT(0u, Probe::getCalls(Probe::CHECK));
+    EXPECT_LT(0u, Probe::getCalls(Probe::SERIALIZE));
+    EXPECT_LT(0u, Probe::getCalls(Probe::SEND));
+}
+
+TEST(ProbeTest, UdpDatagramsAreCountedByDecodeAndDedup)
+{
+    int serverSock = socket(AF_INET, SOCK_DGRAM, 0);
+    const int port = bindLoopback(serverSock);
+    struct timeval limit = {5, 0};
+    setsockopt(serverSock, SOL_SOCKET, SO_RCVTIMEO, &limit, sizeof(limit));
+    std::thread server([serverSock] {
+        uint8_t buf[1536];
+        struct sockaddr_storage from;
+        socklen_t fromLength = sizeof(from);
+        ssize_t bytesRx;
+        while (0 < (bytesRx = recvfrom(serverSock, buf, sizeof(buf), 0, reinterpret_cast<struct sockaddr*>(&from), &fromLength)))
+        {
+            if (bytesRx < 3 || BaseMessages::CONFIRM == buf[0])
+                continue;
+            const uint8_t confirm[3] = {BaseMessages::CONFIRM, buf[1], buf[2]};
+            sendto(serverSock, confirm, sizeof(confirm), 0, reinterpret_cast<struct sockaddr*>(&from), fromLength);
+            if (BaseMessages::COMMAND_AUTH == buf[0])
+            {
+                const uint8_t reply[] = {BaseMessages::REPLY, 0, 100, 1, buf[1], buf[2], 'o', 'k', 0};
+                sendto(serverSock, reply, sizeof(reply), 0, reinterpret_cast<struct sockaddr*>(&from), fromLength);
+                // Second Copy Is Duplicate, Only Confirmed
+                const uint8_t message[] = {BaseMessages::MSG, 0, 101, 'B', 'o', 'b', 0, 'h', 'i', 0};
+                sendto(serverSock, message, sizeof(message), 0, reinterpret_cast<struct sockaddr*>(&from), fromLength);
+                sendto(serverSock, message, sizeof(message), 0, reinterpret_cast<struct sockaddr*>(&from), fromLength);
+            }
+            if (BaseMessages::COMMAND_BYE == buf[0])
+                break;
+        }
+    });
+
+    const uint64_t decoded = Probe::getCalls(Probe::DECODE_DATAGRAM);
+    const uint64_t deduplicated = Probe::getCalls(Probe::DEDUP);
+    Scheduler scheduler;
+    UdpSession session(scheduler, "", "127.0.0.1", port, 3, 250, 1000);
+    session.start();
+    session.handleLine("/auth u s Alice");
+    session.requestLeave();
+    testing::internal::CaptureStdout();
+    bool finished = runUntilFinished(scheduler, session, std::chrono::milliseconds(5000));
+    std::string printed = testing::internal::GetCapturedStdout();
+    server.join();
+    close(serverSock);
+
+    ASSERT_TRUE(finished);
+    EXPECT_EQ(SUCCESS, session.getExitCode());
+    // REPLY And MSG Are Decoded, Duplicate Stops At Dedup
+    EXPECT_LE(decoded + 2, Probe::getCalls(Probe::DECODE_DATAGRAM));
+    EXPECT_LE(deduplicated + 3, Probe::getCalls(Probe::DEDUP));
+    EXPECT_EQ(1u, countLines(printed, "Bob: hi"));
+}
@@ -0,0 +1,116 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_protocolSchema.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Codecs Generated From Protocol Schema.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_protocolSchema.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Codecs Generated From Protocol Schema.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include <string>
+#include "../include/protocol_schema.hpp"
+
+static std::string text(const CharBuffer& buffer)
+{
+    return std::string(buffer.begin(), buffer.end());
+}
+
+template <size_t N>
+static std::string text(const FixedString<N>& field)
+{
+    return std::string(field.begin(), field.end());
+}
+
+/**
+* @brief Test that MSG is encoded to exact size and decoded back by the table
+*/
+TEST(ProtocolSchemaTest, BinaryRoundTrip) {
+    BaseMessages::Message_t msg;
+    msg.type = BaseMessages::MSG;
+    msg.displayName = "Bob";
+    std::string content = "hi there";
+    msg.content.assign(content.begin(), content.end());
+    WireHeader_t header;
+    header.messageID = 0x0102;
+
+    BinaryCodec::Datagram datagram;
+    ASSERT_TRUE(BinaryCodec::encode(msg, header, datagram));
+    EXPECT_EQ(datagram.size(), BinaryCodec::size<BaseMessages::MSG>(msg));
+    std::string expected("\x04\x01\x02" "Bob\0hi there\0", 16);
+    EXPECT_EQ(std::string(datagram.begin(), datagram.end()), expected);
+
+    BaseMessages::Message_t decoded;
+    WireHeader_t decodedHeader;
+    ASSERT_TRUE(BinaryCodec::decode(expected, decoded, decodedHeader));
+    EXPECT_EQ(decoded.type, BaseMessages::MSG);
+    EXPECT_EQ(decodedHeader.messageID, 0x0102);
+    EXPECT_EQ(text(decoded.displayNameOutside), "Bob");
+    EXPECT_EQ(text(decoded.content), "hi there");
+}
+
+/**
+* @brief Test that REPLY and CONFIRM fill the header and broken datagrams are refused
+*/
+TEST(ProtocolSchemaTest, BinaryReplyConfirmAndBroken) {
+    BaseMessages::Message_t msg;
+    WireHeader_t header;
+    ASSERT_TRUE(BinaryCodec::decode(std::string("\x01\x00\x05\x01\x00\x03ok\0", 9), msg, header));
+    EXPECT_EQ(msg.type, BaseMessages::REPLY);
+    EXPECT_EQ(header.messageID, 5);
+    EXPECT_EQ(header.result, 1);
+    EXPECT_EQ(header.refMessageID, 3);
+    EXPECT_EQ(text(msg.content), "ok");
+
+    ASSERT_TRUE(BinaryCodec::decode(std::string("\x00\x00\x07", 3), msg, header));
+    EXPECT_EQ(msg.type, BaseMessages::CONFIRM);
+    EXPECT_EQ(header.refMessageID, 7);
+    EXPECT_EQ(header.messageID, 5);
+
+    EXPECT_FALSE(BinaryCodec::decode(std::string("\x01\x00\x05\x01\x00", 5), msg, header));
+    EXPECT_EQ(msg.type, BaseMessages::UNKNOWN_MSG_TYPE);
+    EXPECT_FALSE(BinaryCodec::decode(std::string("\x42\x00\x01", 3), msg, header));
+    EXPECT_FALSE(BinaryCodec::decode(std::string("\x04\x00", 2), msg, header));
+
+    BinaryCodec::Datagram datagram;
+    msg.type = BaseMessages::COMMAND_HELP;
+    EXPECT_FALSE(BinaryCodec::encode(msg, header, datagram));
+    EXPECT_TRUE(datagram.empty());
+}
+
+/**
+* @brief Test that TCP lines are encoded to exact length and decoded field by field
+*/
+TEST(ProtocolSchemaTest, TextEncodeAndDecode) {
+    BaseMessages::Message_t msg;
+    msg.login = "user";
+    msg.displayName = "Me";
+    msg.secret = "pass";
+    std::string line;
+    TextCodec::encode<BaseMessages::COMMAND_AUTH>(msg, WireHeader_t(), line);
+    EXPECT_EQ(line, "AUTH user AS Me USING pass\r\n");
+    EXPECT_EQ(line.size(), (TextCodec::size<BaseMessages::COMMAND_AUTH>(msg, WireHeader_t())));
+
+    BaseMessages::Message_t decoded;
+    WireHeader_t header;
+    EXPECT_EQ(TextCodec::decode(std::string_view("MSG FROM John IS Hello IS world!\r\n"), decoded, header), BaseMessages::MSG);
+    EXPECT_EQ(text(decoded.displayNameOutside), "John");
+    EXPECT_EQ(text(decoded.content), "Hello IS world!");
+
+    EXPECT_EQ(TextCodec::decode(std::string_view("REPLY NOK IS no way\r\n"), decoded, header), BaseMessages::REPLY);
+    EXPECT_EQ(header.result, 0);
+    EXPECT_EQ(text(decoded.content), "no way");
+
+    EXPECT_EQ(TextCodec::decode(std::string_view("BYE\r\n"), decoded, header), BaseMessages::COMMAND_BYE);
+    EXPECT_EQ(TextCodec::decode(std::string_view("BYEE\r\n"), decoded, header), BaseMessages::UNKNOWN_MSG_TYPE);
+    EXPECT_EQ(TextCodec::decode(std::string_view("REPLY MAYBE IS x\r\n"), decoded, header), BaseMessages::UNKNOWN_MSG_TYPE);
+    EXPECT_EQ(TextCodec::decode(std::string_view("MSG FROM John\r\n"), decoded, header), BaseMessages::UNKNOWN_MSG_TYPE);
+}
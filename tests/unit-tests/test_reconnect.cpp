@@ -0,0 +1,201 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_reconnect.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For TCP Session Rebuilt After Reconnect.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_reconnect.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For TCP Session Rebuilt After Reconnect.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <netinet/in.h>
+#include "../src/arguments.cpp"
+#include "../src/resolver.cpp"
+#include "../src/socket_options.cpp"
+#include "../src/token_bucket.cpp"
+#include "../src/backoff.cpp"
+#include "../src/trace.cpp"
+#include "../src/capture.cpp"
+#include "../src/mapped_file.cpp"
+#include "../src/jsonl_writer.cpp"
+#include "../src/shm_ring.cpp"
+#include "../src/daemon_hub.cpp"
+#include "../src/renderer.cpp"
+#include "../src/file_sender.cpp"
+#include "../src/history.cpp"
+#include "../src/search_index.cpp"
+#include "../src/message_memory.cpp"
+#include "../src/scheduler.cpp"
+#include "../src/strings.cpp"
+#include "../src/base_client.cpp"
+#include "../src/base_messages.cpp"
+#include "../src/tcp_messages.cpp"
+#include "../src/session.cpp"
+#include "../src/tcp_session.cpp"
+
+/**
+ * @brief Server Answering AUTH And JOIN, Dropping The First Connection At JOIN
+ *
+ * Lines of Every Connection Are Kept For The Test To Compare.
+ */
+class DroppingServer
+{
+    public:
+        DroppingServer()
+        {
+            listener = socket(AF_INET, SOCK_STREAM, 0);
+            struct sockaddr_in address = {};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            bind(listener, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+            socklen_t length = sizeof(address);
+            getsockname(listener, reinterpret_cast<struct sockaddr*>(&address), &length);
+            port = ntohs(address.sin_port);
+            listen(listener, 2);
+        }
+        ~DroppingServer()
+        {
+            if (serving.joinable())
+                serving.join();
+            close(listener);
+        }
+
+        /**
+         * @brief Serves Given Number of Connections On Background Thread
+         */
+        void serve(int connections)
+        {
+            serving = std::thread([this, connections] {
+                for (int idx = 0; idx < connections; idx++)
+                    lines.push_back(converse(0 == idx));
+            });
+        }
+        void join() { serving.join(); }
+
+        int port = 0;
+        std::vector<std::vector<std::string>> lines;    //!< Lines Received On Each Connection
+
+    private:
+        std::vector<std::string> converse(bool drop)
+        {
+            std::vector<std::string> received;
+            int client = accept(listener, nullptr, nullptr);
+            std::string stream;
+            char chunk[512];
+            ssize_t bytesRx;
+            while (0 < (bytesRx = recv(client, chunk, sizeof(chunk), 0)))
+            {
+                stream.append(chunk, bytesRx);
+                size_t end;
+                while (std::string::npos != (end = stream.find("\r\n")))
+                {
+                    std::string line = stream.substr(0, end);
+                    stream.erase(0, end + 2);
+                    received.push_back(line);
+                    if (0 == line.rfind("JOIN", 0) && drop)
+                    {
+                        close(client);                  // JOIN Stays Unanswered
+                        return received;
+                    }
+                    if (0 == line.rfind("AUTH", 0) || 0 == line.rfind("JOIN", 0))
+                        send(client, "REPLY OK IS Fine\r\n", 18, MSG_NOSIGNAL);
+                    if ("BYE" == line)
+                    {
+                        close(client);
+                        return received;
+                    }
+                }
+            }
+            close(client);
+            return received;
+        }
+
+        int listener;
+        std::thread serving;
+};
+
+/**
+ * @brief TCP Session Telling When Its Reconnect Waits For Backoff
+ */
+class ProbedSession : public TcpSession
+{
+    public:
+        using TcpSession::TcpSession;
+        bool isReconnecting() const { return reconnecting; }
+};
+
+/**
+ * @brief Runs Scheduler Until The Session Ends or Time Runs Out
+ */
+static bool runUntilFinished(Scheduler& scheduler, const Session& session, std::chrono::milliseconds limit)
+{
+    const auto deadline = Scheduler::Clock::now() + limit;
+    while (!session.isFinished() && Scheduler::Clock::now() < deadline)
+        scheduler.runOnce();
+    return session.isFinished();
+}
+
+TEST(ReconnectTest, RebuildReplaysAuthAndLostJoinThenQueuedMessage)
+{
+    DroppingServer server;
+    server.serve(2);
+    Scheduler scheduler;
+    TcpSession session(scheduler, "", "127.0.0.1", server.port, 1000);
+    session.setReconnect(3, 10);
+    session.start();
+    session.handleLine("/auth u s Alice");
+    session.handleLine("/rename Bob");
+    session.handleLine("/join ch");
+    session.handleLine("after");
+    session.requestLeave();
+
+    testing::internal::CaptureStderr();
+    bool finished = runUntilFinished(scheduler, session, std::chrono::milliseconds(5000));
+    std::string errors = testing::internal::GetCapturedStderr();
+    server.join();
+
+    ASSERT_TRUE(finished);
+    EXPECT_EQ(SUCCESS, session.getExitCode());
+    EXPECT_NE(std::string::npos, errors.find("INFO: Session Rebuilt"));
+    ASSERT_EQ(2u, server.lines.size());
+    std::vector<std::string> first = {"AUTH u AS Alice USING s", "JOIN ch AS Bob"};
+    std::vector<std::string> second = {"AUTH u AS Bob USING s", "JOIN ch AS Bob", "MSG FROM Bob IS after", "BYE"};
+    EXPECT_EQ(first, server.lines[0]);
+    EXPECT_EQ(second, server.lines[1]);
+}
+
+TEST(ReconnectTest, DrainCancelsBackoff)
+{
+    DroppingServer server;
+    server.serve(1);
+    Scheduler scheduler;
+    ProbedSession session(scheduler, "", "127.0.0.1", server.port, 1000);
+    session.setReconnect(3, 20000);
+    session.start();
+    session.handleLine("/auth u s Alice");
+    session.handleLine("/join ch");
+
+    testing::internal::CaptureStderr();
+    while (!session.isReconnecting() && !session.isFinished())
+        scheduler.runOnce();
+    server.join();
+
+    const auto drainedAt = Scheduler::Clock::now();
+    session.drain();
+    bool finished = runUntilFinished(scheduler, session, std::chrono::milliseconds(1000));
+    std::string errors = testing::internal::GetCapturedStderr();
+
+    ASSERT_TRUE(finished);
+    EXPECT_GT(std::chrono::milliseconds(1000), Scheduler::Clock::now() - drainedAt);
+    EXPECT_NE(std::string::npos, errors.find("Reconnecting In"));
+    EXPECT_NE(std::string::npos, errors.find("INFO: Reconnect Cancelled"));
+}
@@ -0,0 +1,139 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_renderer.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Rendering Queue And Its Overflow Buffer.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_renderer.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Rendering Queue And Its Overflow Buffer.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include "../src/mapped_file.cpp"
+#include "../src/history.cpp"
+#include "../src/trace.cpp"
+#include "../src/jsonl_writer.cpp"
+#include "../src/shm_ring.cpp"
+#include "../src/daemon_hub.cpp"
+#include "../src/renderer.cpp"
+
+/**
+ * @brief Reads Pipe Until EOF
+ */
+static std::string readAll(int fd)
+{
+    std::string text;
+    char chunk[4096];
+    ssize_t bytesRx;
+    while (0 < (bytesRx = read(fd, chunk, sizeof(chunk))))
+        text.append(chunk, static_cast<size_t>(bytesRx));
+    return text;
+}
+
+TEST(RendererTest, StalledOutputKeepsEveryMessageInOrder)
+{
+    // Nobody Reads STDOUT Pipe Yet, So Rendering Thread Blocks In fprintf()
+    int ends[2];
+    ASSERT_EQ(0, pipe(ends));
+    fflush(stdout);
+    int savedStdout = dup(STDOUT_FILENO);
+    ASSERT_LE(0, dup2(ends[1], STDOUT_FILENO));
+    close(ends[1]);
+
+    ASSERT_EQ(SUCCESS, Renderer::start(Renderer::TEXT));
+    const int total = 4 * 256;
+    const std::string padding(200, 'x');
+    for (int i = 0; i < total; i++)
+        Renderer::publish(Renderer::CHAT_MESSAGE, "Server", std::to_string(i) + " " + padding);
+
+    std::string output;
+    std::thread reader([&] { output = readAll(ends[0]); });
+    Renderer::stop();
+    fflush(stdout);
+    dup2(savedStdout, STDOUT_FILENO);
+    close(savedStdout);
+    reader.join();
+    close(ends[0]);
+
+    std::istringstream lines(output);
+    std::string line;
+    int expected = 0;
+    while (std::getline(lines, line))
+    {
+        ASSERT_EQ("Server: " + std::to_string(expected) + " " + padding, line);
+        expected++;
+    }
+    EXPECT_EQ(total, expected);
+}
+
+TEST(RendererTest, FullOverflowDropsNewestAndCountsThem)
+{
+    int ends[2];
+    ASSERT_EQ(0, pipe(ends));
+    fflush(stdout);
+    int savedStdout = dup(STDOUT_FILENO);
+    ASSERT_LE(0, dup2(ends[1], STDOUT_FILENO));
+    close(ends[1]);
+
+    testing::internal::CaptureStderr();
+    ASSERT_EQ(SUCCESS, Renderer::start(Renderer::TEXT));
+    // Queue And Overflow Buffer Fill Up Long Before The Pipe Is Read
+    const int total = 256 + 4096 + 2000;
+    const std::string padding(200, 'x');
+    for (int i = 0; i < total; i++)
+        Renderer::publish(Renderer::CHAT_MESSAGE, "Server", std::to_string(i) + " " + padding);
+
+    std::string output;
+    std::thread reader([&] { output = readAll(ends[0]); });
+    Renderer::stop();
+    fflush(stdout);
+    dup2(savedStdout, STDOUT_FILENO);
+    close(savedStdout);
+    reader.join();
+    close(ends[0]);
+    std::string errors = testing::internal::GetCapturedStderr();
+
+    std::istringstream lines(output);
+    std::string line;
+    int rendered = 0;
+    int previous = -1;
+    while (std::getline(lines, line))
+    {
+        int number = std::stoi(line.substr(strlen("Server: ")));
+        ASSERT_LT(previous, number);
+        previous = number;
+        rendered++;
+    }
+    unsigned lost = 0;
+    size_t at = errors.find("ERR: ");
+    ASSERT_NE(std::string::npos, at);
+    ASSERT_EQ(1, sscanf(errors.c_str() + at, "ERR: %u Messages Dropped, Output Is Too Slow", &lost));
+    EXPECT_LT(0u, lost);
+    EXPECT_EQ(total, rendered + static_cast<int>(lost));
+}
+
+TEST(RendererTest, SearchResultsFollowEarlierMessages)
+{
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+    ASSERT_EQ(SUCCESS, Renderer::start(Renderer::TEXT));
+    Renderer::setSession("a");
+    Renderer::publish(Renderer::CHAT_MESSAGE, "Bob", "red apple");
+    Renderer::publishLocal(Renderer::SEARCH_MATCH, 7, "Bob", "red apple");
+    Renderer::publishLocal(Renderer::SEARCH_SUMMARY, 0, "", "INFO: Search Found 1 Matches");
+    Renderer::stop();
+    Renderer::setSession("");
+    std::string output = testing::internal::GetCapturedStdout();
+    std::string errors = testing::internal::GetCapturedStderr();
+
+    EXPECT_EQ("[a] Bob: red apple\n[#7] Bob: red apple\n", output);
+    EXPECT_EQ("INFO: Search Found 1 Matches\n", errors);
+}
@@ -0,0 +1,100 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_resolver.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Ordering of Resolved Addresses (RFC 8305).
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_resolver.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Ordering of Resolved Addresses (RFC 8305).
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include "../src/resolver.cpp"
+
+/**
+ * @brief Builds Resolved Address From Textual Form
+ */
+static Resolver::Address_t makeAddress(const char* text)
+{
+    Resolver::Address_t address;
+    memset(&address, 0, sizeof(address));
+    if (nullptr != strchr(text, ':'))
+    {
+        struct sockaddr_in6* ipv6 = reinterpret_cast<struct sockaddr_in6*>(&address.addr);
+        ipv6->sin6_family = AF_INET6;
+        inet_pton(AF_INET6, text, &ipv6->sin6_addr);
+        address.len = sizeof(struct sockaddr_in6);
+    }
+    else
+    {
+        struct sockaddr_in* ipv4 = reinterpret_cast<struct sockaddr_in*>(&address.addr);
+        ipv4->sin_family = AF_INET;
+        inet_pton(AF_INET, text, &ipv4->sin_addr);
+        address.len = sizeof(struct sockaddr_in);
+    }
+    return address;
+}
+
+/**
+ * @brief Converts Ordered Addresses Back To Text
+ */
+static std::vector<std::string> describe(const std::vector<Resolver::Address_t>& addresses)
+{
+    std::vector<std::string> texts;
+    char text[INET6_ADDRSTRLEN];
+    for (const Resolver::Address_t& address : addresses)
+    {
+        if (AF_INET6 == address.addr.ss_family)
+            inet_ntop(AF_INET6, &reinterpret_cast<const struct sockaddr_in6*>(&address.addr)->sin6_addr, text, sizeof(text));
+        else
+            inet_ntop(AF_INET, &reinterpret_cast<const struct sockaddr_in*>(&address.addr)->sin_addr, text, sizeof(text));
+        texts.push_back(text);
+    }
+    return texts;
+}
+
+static std::vector<std::string> order(std::initializer_list<const char*> texts)
+{
+    std::vector<Resolver::Address_t> addresses;
+    for (const char* text : texts)
+        addresses.push_back(makeAddress(text));
+    Resolver::orderAddresses(addresses);
+    return describe(addresses);
+}
+
+TEST(ResolverTest, InterleavesFamiliesStartingWithFirst)
+{
+    std::vector<std::string> expected = {"2001:db8::1", "192.0.2.1", "2001:db8::2", "192.0.2.2"};
+    EXPECT_EQ(expected, order({"2001:db8::1", "2001:db8::2", "192.0.2.1", "192.0.2.2"}));
+}
+
+TEST(ResolverTest, FirstFamilyDecidesPreference)
+{
+    std::vector<std::string> expected = {"192.0.2.1", "2001:db8::1", "192.0.2.2"};
+    EXPECT_EQ(expected, order({"192.0.2.1", "192.0.2.2", "2001:db8::1"}));
+}
+
+TEST(ResolverTest, LongerFamilyKeepsItsOrderAtTheEnd)
+{
+    std::vector<std::string> expected = {"2001:db8::1", "192.0.2.1", "192.0.2.2", "192.0.2.3"};
+    EXPECT_EQ(expected, order({"2001:db8::1", "192.0.2.1", "192.0.2.2", "192.0.2.3"}));
+}
+
+TEST(ResolverTest, SingleFamilyIsUnchanged)
+{
+    std::vector<std::string> expected = {"192.0.2.3", "192.0.2.1", "192.0.2.2"};
+    EXPECT_EQ(expected, order({"192.0.2.3", "192.0.2.1", "192.0.2.2"}));
+}
+
+TEST(ResolverTest, EmptyListStaysEmpty)
+{
+    EXPECT_TRUE(order({}).empty());
+}
@@ -0,0 +1,239 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_scheduler.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Coroutine Scheduler.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_scheduler.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Coroutine Scheduler.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <unistd.h>
+#include <sys/socket.h>
+#include "../src/message_memory.cpp"
+#include "../src/scheduler.cpp"
+#include "../include/task.hpp"
+
+static std::atomic<size_t> globalNews{0};      //!< Calls of Global operator new In This Binary
+
+void* operator new(std::size_t size)
+{
+    globalNews++;
+    void* block = malloc(size ? size : 1);
+    if (nullptr == block)
+        throw std::bad_alloc();
+    return block;
+}
+void operator delete(void* block) noexcept { free(block); }
+void operator delete(void* block, std::size_t) noexcept { free(block); }
+
+static Task<int> step(int value)
+{
+    co_return value + 1;
+}
+
+static Task<> steps(int count, int& total)
+{
+    for (int idx = 0; idx < count; idx++)
+    {
+        int next = co_await step(total);
+        total = next;
+    }
+}
+
+static Task<bool> waitSignal(Signal& signal, Scheduler::Clock::time_point deadline, int& stage)
+{
+    stage = 1;
+    bool came = co_await signal.wait(deadline);
+    stage = 2;
+    co_return came;
+}
+
+static Task<> waitTwice(Signal& signal, Scheduler::Clock::time_point deadline, int& stage, std::vector<bool>& results)
+{
+    bool came = co_await waitSignal(signal, deadline, stage);
+    results.push_back(came);
+    came = co_await waitSignal(signal, deadline, stage);
+    results.push_back(came);
+}
+
+static Task<> readOnce(Scheduler& scheduler, int fd, char& byte)
+{
+    co_await scheduler.readable(fd);
+    ssize_t bytesRx = read(fd, &byte, 1);
+    (void)bytesRx;
+}
+
+static Task<> writeOnce(Scheduler& scheduler, int fd, bool& resumed)
+{
+    co_await scheduler.writable(fd);
+    resumed = true;
+}
+
+static Task<> readBefore(Scheduler& scheduler, int fd, Scheduler::Clock::time_point deadline, std::vector<bool>& results)
+{
+    bool readable = co_await scheduler.readable(fd, deadline);
+    results.push_back(readable);
+}
+
+/**
+* @brief Test that set() resumes the waiting coroutine and deadline resumes it without signal
+*/
+TEST(SchedulerTest, SignalOrDeadline) {
+    Scheduler scheduler;
+    Signal signal(scheduler);
+    int stage = 0;
+    std::vector<bool> results;
+    auto deadline = Scheduler::Clock::now() + std::chrono::milliseconds(20);
+
+    Task<> task = waitTwice(signal, deadline, stage, results);
+    task.start();
+    EXPECT_EQ(stage, 1);
+
+    signal.set();
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_TRUE(results[0]);
+
+    while (!task.done())
+        ASSERT_EQ(scheduler.runOnce(), SUCCESS);
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_FALSE(results[1]);
+    EXPECT_GE(Scheduler::Clock::now(), deadline);
+}
+
+/**
+* @brief Test that signal raised before wait() passes through without suspension
+*/
+TEST(SchedulerTest, RaisedSignalPassesThrough) {
+    Scheduler scheduler;
+    Signal signal(scheduler);
+    int stage = 0;
+    signal.set();
+
+    Task<bool> task = waitSignal(signal, Scheduler::Clock::time_point::max(), stage);
+    task.start();
+    EXPECT_EQ(stage, 2);
+    EXPECT_TRUE(task.done());
+}
+
+/**
+* @brief Test that readable descriptor resumes the coroutine and dropped task unregisters itself
+*/
+TEST(SchedulerTest, ReadableAndCancel) {
+    Scheduler scheduler;
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    char byte = 0;
+
+    Task<> reader = readOnce(scheduler, fds[0], byte);
+    reader.start();
+    ASSERT_EQ(write(fds[1], "x", 1), 1);
+    ASSERT_EQ(scheduler.runOnce(), SUCCESS);
+    EXPECT_TRUE(reader.done());
+    EXPECT_EQ(byte, 'x');
+
+    Task<> dropped = readOnce(scheduler, fds[0], byte);
+    dropped.start();
+    dropped = Task<>();
+    ASSERT_EQ(write(fds[1], "y", 1), 1);
+
+    Task<> next = readOnce(scheduler, fds[0], byte);        // Dropped Task Left No Registration Behind
+    next.start();
+    ASSERT_EQ(scheduler.runOnce(), SUCCESS);
+    EXPECT_TRUE(next.done());
+    EXPECT_EQ(byte, 'y');
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+/**
+* @brief Test that readable() with deadline yields false after timeout and true for data
+*/
+TEST(SchedulerTest, ReadableOrDeadline) {
+    Scheduler scheduler;
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    std::vector<bool> results;
+    auto deadline = Scheduler::Clock::now() + std::chrono::milliseconds(20);
+
+    Task<> timedOut = readBefore(scheduler, fds[0], deadline, results);
+    timedOut.start();
+    while (!timedOut.done())
+        ASSERT_EQ(scheduler.runOnce(), SUCCESS);
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_FALSE(results[0]);
+    EXPECT_GE(Scheduler::Clock::now(), deadline);
+
+    Task<> ready = readBefore(scheduler, fds[0], Scheduler::Clock::now() + std::chrono::seconds(10), results);
+    ready.start();
+    ASSERT_EQ(write(fds[1], "x", 1), 1);
+    ASSERT_EQ(scheduler.runOnce(), SUCCESS);
+    EXPECT_TRUE(ready.done());
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_TRUE(results[1]);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+/**
+* @brief Test that reader and writer of the same socket are resumed independently
+*/
+TEST(SchedulerTest, ReaderAndWriterOfOneSocket) {
+    Scheduler scheduler;
+    int fds[2];
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds), 0);
+    char chunk[4096] = {};
+    while (0 < write(fds[0], chunk, sizeof(chunk)))
+        ;                                                   // Fill The Send Buffer
+    char byte = 0;
+    bool written = false;
+
+    Task<> writer = writeOnce(scheduler, fds[0], written);
+    writer.start();
+    Task<> reader = readOnce(scheduler, fds[0], byte);
+    reader.start();
+    ASSERT_EQ(write(fds[1], "x", 1), 1);
+    ASSERT_EQ(scheduler.runOnce(), SUCCESS);
+    EXPECT_TRUE(reader.done());
+    EXPECT_EQ(byte, 'x');
+    EXPECT_FALSE(written);
+
+    while (0 < read(fds[1], chunk, sizeof(chunk)))
+        ;                                                   // Peer Drains, Send Buffer Has Room Again
+    while (!writer.done())
+        ASSERT_EQ(scheduler.runOnce(), SUCCESS);
+    EXPECT_TRUE(written);
+
+    close(fds[0]);
+    close(fds[1]);
+}
+
+/**
+* @brief Test that frames of nested tasks are recycled by the message pool, not global operator new
+*/
+TEST(SchedulerTest, TaskFramesComeFromMessagePool) {
+    int total = 0;
+    {
+        Task<> warmUp = steps(1, total);
+        warmUp.start();
+    }
+    size_t before = globalNews;
+    Task<> many = steps(1000, total);
+    many.start();
+    EXPECT_TRUE(many.done());
+    EXPECT_EQ(1001, total);
+    EXPECT_EQ(before, globalNews.load());
+}
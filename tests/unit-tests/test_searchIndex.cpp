@@ -0,0 +1,95 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_searchIndex.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Full-Text Search Index.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_searchIndex.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Full-Text Search Index.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include "../src/search_index.cpp"
+
+// Test Fixture
+class SearchIndexTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SearchIndex::clear();
+        SearchIndex::setMemoryCap(SEARCH_DEFAULT_MEMORY);
+    }
+
+    void TearDown() override {
+        SearchIndex::clear();
+    }
+};
+
+/**
+* @brief Test that the search matches content and sender case-insensitively, newest first
+*/
+TEST_F(SearchIndexTest, FindsTermsInSenderAndContent) {
+    SearchIndex::add("Alice", "Hello World");
+    SearchIndex::add("Bob", "hello again");
+    SearchIndex::add("Carol", "nothing here");
+
+    std::vector<SearchIndex::Match_t> matches = SearchIndex::search("HELLO", 10);
+    ASSERT_EQ(2u, matches.size());
+    EXPECT_EQ("Bob", matches[0].sender);
+    EXPECT_EQ("Alice", matches[1].sender);
+
+    matches = SearchIndex::search("carol", 10);
+    ASSERT_EQ(1u, matches.size());
+    EXPECT_EQ("nothing here", matches[0].content);
+}
+
+/**
+* @brief Test that all terms of the query must match
+*/
+TEST_F(SearchIndexTest, IntersectsMoreTerms) {
+    SearchIndex::add("Alice", "red apple");
+    SearchIndex::add("Alice", "green apple");
+    SearchIndex::add("Bob", "red car");
+
+    std::vector<SearchIndex::Match_t> matches = SearchIndex::search("red apple", 10);
+    ASSERT_EQ(1u, matches.size());
+    EXPECT_EQ(0u, matches[0].document);
+    EXPECT_TRUE(SearchIndex::search("red banana", 10).empty());
+}
+
+/**
+* @brief Test that the limit keeps only the newest matches
+*/
+TEST_F(SearchIndexTest, LimitKeepsNewest) {
+    for (int i = 0; i < 1000; i++) {
+        SearchIndex::add("Alice", "ping " + std::to_string(i));
+    }
+    std::vector<SearchIndex::Match_t> matches = SearchIndex::search("ping", 3);
+    ASSERT_EQ(3u, matches.size());
+    EXPECT_EQ("ping 999", matches[0].content);
+    EXPECT_EQ("ping 997", matches[2].content);
+}
+
+/**
+* @brief Test that the memory cap evicts the oldest messages and their postings
+*/
+TEST_F(SearchIndexTest, CapEvictsOldest) {
+    SearchIndex::setMemoryCap(4096);
+    for (int i = 0; i < 1000; i++) {
+        SearchIndex::add("Alice", "word" + std::to_string(i) + " common");
+    }
+    EXPECT_LE(SearchIndex::memoryUsed(), 4096u);
+    EXPECT_LT(SearchIndex::documents(), 1000u);
+    EXPECT_TRUE(SearchIndex::search("word0", 10).empty());
+    EXPECT_EQ(1u, SearchIndex::search("word999", 10).size());
+
+    SearchIndex::setMemoryCap(0);
+    EXPECT_EQ(0u, SearchIndex::documents());
+    EXPECT_EQ(0u, SearchIndex::memoryUsed());
+}
@@ -0,0 +1,97 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_shmRing.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Shared Memory Rings.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_shmRing.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Shared Memory Rings.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include "../src/shm_ring.cpp"
+
+static bool push(ShmRing& ring, const std::string& body)
+{
+    uint8_t* target = ring.reserve(body.size());
+    if (nullptr == target)
+        return false;
+    memcpy(target, body.data(), body.size());
+    ring.commit(body.size());
+    return true;
+}
+
+static std::string pop(ShmRing& ring)
+{
+    std::string_view record;
+    if (!ring.peek(record))
+        return "<none>";
+    std::string body(record);
+    ring.release(record.size());
+    return body;
+}
+
+/**
+* @brief Test that records never wrap and the skipped end is released by the consumer
+*/
+TEST(ShmRingTest, SkipsEndInsteadOfWrapping) {
+    ShmRingHeader_t header{};
+    alignas(8) uint8_t data[64];
+    ShmRing ring;
+    ring.attach(&header, data, sizeof(data));
+
+    EXPECT_TRUE(push(ring, std::string(40, 'a')));     // 42 Bytes
+    EXPECT_FALSE(push(ring, std::string(30, 'b')));    // 22 Left Before End, 32 Needed
+    EXPECT_EQ(pop(ring), std::string(40, 'a'));
+    EXPECT_TRUE(push(ring, std::string(30, 'b')));     // Starts At Offset 0
+    EXPECT_EQ(header.head.load(), 64u + 32u);
+    EXPECT_EQ(pop(ring), std::string(30, 'b'));
+    EXPECT_EQ(pop(ring), "<none>");
+    EXPECT_TRUE(ring.isEmpty());
+}
+
+/**
+* @brief Test that a full ring refuses records and odd lengths keep records aligned
+*/
+TEST(ShmRingTest, RefusesRecordsWhenFull) {
+    ShmRingHeader_t header{};
+    alignas(8) uint8_t data[64];
+    ShmRing ring;
+    ring.attach(&header, data, sizeof(data));
+
+    int pushed = 0;
+    while (push(ring, "odd"))                           // 2 + 3 Padded To 6 Bytes
+        pushed++;
+    EXPECT_EQ(pushed, 10);
+    EXPECT_EQ(pop(ring), "odd");
+    EXPECT_TRUE(push(ring, "odd"));
+    for (int idx = 0; idx < pushed; idx++)
+        EXPECT_EQ(pop(ring), "odd");
+    EXPECT_TRUE(ring.isEmpty());
+}
+
+/**
+* @brief Test that a consumer sleeping on the futex is woken by a record from another thread
+*/
+TEST(ShmRingTest, WakesSleepingConsumer) {
+    ShmRingHeader_t header{};
+    alignas(8) uint8_t data[256];
+    ShmRing ring;
+    ring.attach(&header, data, sizeof(data));
+
+    std::thread producer([&ring] {
+        usleep(20000);
+        push(ring, "late");
+    });
+    while (ring.isEmpty())
+        ring.waitForData(0);
+    EXPECT_EQ(pop(ring), "late");
+    producer.join();
+}
@@ -0,0 +1,82 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_signalDrain.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Signal Read From signalfd And Drain Deadline.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_signalDrain.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Signal Read From signalfd And Drain Deadline.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include <csignal>
+#include <thread>
+#include "../src/signal_drain.cpp"
+
+TEST(SignalDrainTest, NothingPendingBeforeSignal)
+{
+    SignalDrain signals;
+    ASSERT_EQ(SUCCESS, signals.watchSignals());
+    EXPECT_FALSE(signals.beginDrain(0));
+    EXPECT_FALSE(signals.isDraining());
+    EXPECT_FALSE(signals.drainExpired());
+    EXPECT_EQ(SignalDrain::Clock::time_point::max(), signals.getDeadline());
+}
+
+TEST(SignalDrainTest, FirstSignalStartsDrainUntilDeadline)
+{
+    SignalDrain signals;
+    signals.setDrainTimeout(200);
+    ASSERT_EQ(SUCCESS, signals.watchSignals());
+    // Blocked Signal Stays Pending And Is Read From signalfd
+    ASSERT_EQ(0, raise(SIGINT));
+
+    testing::internal::CaptureStderr();
+    const auto before = SignalDrain::Clock::now();
+    EXPECT_TRUE(signals.beginDrain(3));
+    std::string info = testing::internal::GetCapturedStderr();
+
+    EXPECT_NE(std::string::npos, info.find("Flushing 3 Queued Messages Before BYE (Deadline 200 ms)"));
+    EXPECT_TRUE(signals.isDraining());
+    EXPECT_LE(before + std::chrono::milliseconds(200), signals.getDeadline());
+    EXPECT_FALSE(signals.drainExpired());
+    std::this_thread::sleep_for(std::chrono::milliseconds(250));
+    EXPECT_TRUE(signals.drainExpired());
+}
+
+TEST(SignalDrainTest, SecondSignalMovesDeadlineToNow)
+{
+    SignalDrain signals;
+    signals.setDrainTimeout(60000);
+    ASSERT_EQ(SUCCESS, signals.watchSignals());
+    ASSERT_EQ(0, raise(SIGTERM));
+    testing::internal::CaptureStderr();
+    EXPECT_TRUE(signals.beginDrain(0));
+    EXPECT_FALSE(signals.drainExpired());
+
+    ASSERT_EQ(0, raise(SIGINT));
+    EXPECT_TRUE(signals.beginDrain(0));
+    std::string info = testing::internal::GetCapturedStderr();
+
+    EXPECT_NE(std::string::npos, info.find("Again, Sending BYE Now"));
+    EXPECT_TRUE(signals.drainExpired());
+}
+
+TEST(SignalDrainTest, ZeroTimeoutExpiresAtOnce)
+{
+    SignalDrain signals;
+    signals.setDrainTimeout(0);
+    ASSERT_EQ(SUCCESS, signals.watchSignals());
+    ASSERT_EQ(0, raise(SIGTERM));
+    testing::internal::CaptureStderr();
+    EXPECT_TRUE(signals.beginDrain(5));
+    testing::internal::GetCapturedStderr();
+    EXPECT_TRUE(signals.drainExpired());
+}
@@ -0,0 +1,96 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_socketOptions.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Socket Tuning Profiles.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_socketOptions.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Socket Tuning Profiles.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include "../src/socket_options.cpp"
+
+/**
+* @brief Test that the throughput profile fills unset options and leaves TCP_CORK alone
+*/
+TEST(SocketOptionsTest, ThroughputProfileDoesNotCork) {
+    SocketOptions_t options;
+    options.profile = "throughput";
+    ASSERT_EQ(SUCCESS, resolveSocketProfile(options));
+    EXPECT_EQ(4 * 1024 * 1024, options.sendBuffer);
+    EXPECT_EQ(4 * 1024 * 1024, options.recvBuffer);
+    EXPECT_EQ(128 * 1024, options.notSentLowat);
+    EXPECT_EQ(IPTOS_THROUGHPUT, options.tos);
+    EXPECT_EQ(OPTION_UNSET, options.cork);
+}
+
+/**
+* @brief Test that explicitly set options win over the values of the profile
+*/
+TEST(SocketOptionsTest, ExplicitValuesAreKept) {
+    SocketOptions_t throughput;
+    throughput.profile = "throughput";
+    throughput.sendBuffer = 65536;
+    throughput.tos = 0;
+    throughput.cork = 1;
+    ASSERT_EQ(SUCCESS, resolveSocketProfile(throughput));
+    EXPECT_EQ(65536, throughput.sendBuffer);
+    EXPECT_EQ(4 * 1024 * 1024, throughput.recvBuffer);
+    EXPECT_EQ(0, throughput.tos);
+    EXPECT_EQ(1, throughput.cork);
+
+    SocketOptions_t latency;
+    latency.profile = "latency";
+    latency.noDelay = 0;
+    ASSERT_EQ(SUCCESS, resolveSocketProfile(latency));
+    EXPECT_EQ(0, latency.noDelay);
+    EXPECT_EQ(1, latency.quickAck);
+    EXPECT_EQ(IPTOS_LOWDELAY, latency.tos);
+}
+
+/**
+* @brief Test that the custom profile changes nothing and an unknown one is refused
+*/
+TEST(SocketOptionsTest, CustomKeepsEverythingUnknownFails) {
+    SocketOptions_t custom;
+    custom.profile = "custom";
+    custom.notSentLowat = 4096;
+    ASSERT_EQ(SUCCESS, resolveSocketProfile(custom));
+    EXPECT_EQ(4096, custom.notSentLowat);
+    EXPECT_EQ(OPTION_UNSET, custom.sendBuffer);
+    EXPECT_EQ(OPTION_UNSET, custom.cork);
+
+    SocketOptions_t unknown;
+    unknown.profile = "bulk";
+    EXPECT_EQ(FAIL, resolveSocketProfile(unknown));
+}
+
+/**
+* @brief Test that a socket tuned by the throughput profile is not left corked
+*/
+TEST(SocketOptionsTest, ThroughputSocketIsNotCorked) {
+    SocketOptions_t options;
+    options.profile = "throughput";
+    ASSERT_EQ(SUCCESS, resolveSocketProfile(options));
+    int sock = socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_LE(0, sock);
+    testing::internal::CaptureStderr();
+    applySocketOptions(sock, AF_INET, true, options);
+    std::string log = testing::internal::GetCapturedStderr();
+    int corked = -1;
+    socklen_t length = sizeof(corked);
+    ASSERT_EQ(0, getsockopt(sock, IPPROTO_TCP, TCP_CORK, &corked, &length));
+    close(sock);
+    EXPECT_EQ(0, corked);
+    EXPECT_EQ(std::string::npos, log.find("TCP_CORK"));
+    EXPECT_NE(std::string::npos, log.find("TCP_NOTSENT_LOWAT"));
+}
@@ -0,0 +1,159 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_tcpBackpressure.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For TCP Session Sending To Server Which Stops Reading.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_tcpBackpressure.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For TCP Session Sending To Server Which Stops Reading.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <netinet/in.h>
+#include "../src/arguments.cpp"
+#include "../src/resolver.cpp"
+#include "../src/socket_options.cpp"
+#include "../src/token_bucket.cpp"
+#include "../src/backoff.cpp"
+#include "../src/trace.cpp"
+#include "../src/capture.cpp"
+#include "../src/mapped_file.cpp"
+#include "../src/jsonl_writer.cpp"
+#include "../src/shm_ring.cpp"
+#include "../src/daemon_hub.cpp"
+#include "../src/renderer.cpp"
+#include "../src/file_sender.cpp"
+#include "../src/history.cpp"
+#include "../src/search_index.cpp"
+#include "../src/message_memory.cpp"
+#include "../src/scheduler.cpp"
+#include "../src/strings.cpp"
+#include "../src/base_client.cpp"
+#include "../src/base_messages.cpp"
+#include "../src/tcp_messages.cpp"
+#include "../src/session.cpp"
+#include "../src/tcp_session.cpp"
+
+static constexpr int MESSAGES = 4000;
+static constexpr int PAUSE = 300;          //!< Server Does Not Read After AUTH, In Milliseconds
+
+/**
+ * @brief Records Ticks of Timer Until Stopped
+ */
+static Task<> tick(Scheduler& scheduler, std::vector<Scheduler::Clock::time_point>& ticks, const bool& stopped)
+{
+    while (!stopped)
+    {
+        co_await scheduler.sleepUntil(Scheduler::Clock::now() + std::chrono::milliseconds(20));
+        ticks.push_back(Scheduler::Clock::now());
+    }
+}
+
+TEST(TcpBackpressureTest, SlowServerDoesNotStallScheduler)
+{
+    int listener = socket(AF_INET, SOCK_STREAM, 0);
+    int small = 4096;
+    setsockopt(listener, SOL_SOCKET, SO_RCVBUF, &small, sizeof(small));
+    struct sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(listener, reinterpret_cast<struct sockaddr*>(&address), sizeof(address));
+    socklen_t length = sizeof(address);
+    getsockname(listener, reinterpret_cast<struct sockaddr*>(&address), &length);
+    listen(listener, 1);
+
+    int received = 0;
+    bool sawBye = false;
+    Scheduler::Clock::time_point pausedAt;
+    Scheduler::Clock::time_point resumedAt;
+    std::thread server([listener, &received, &sawBye, &pausedAt, &resumedAt] {
+        int client = accept(listener, nullptr, nullptr);
+        std::string stream;
+        char chunk[65536];
+        ssize_t bytesRx;
+        bool paused = false;
+        while (0 < (bytesRx = recv(client, chunk, sizeof(chunk), 0)))
+        {
+            stream.append(chunk, bytesRx);
+            size_t end;
+            while (std::string::npos != (end = stream.find("\r\n")))
+            {
+                const std::string line = stream.substr(0, end);
+                stream.erase(0, end + 2);
+                if (0 == line.rfind("AUTH", 0))
+                {
+                    const char answer[] = "REPLY OK IS Fine\r\n";
+                    send(client, answer, sizeof(answer) - 1, MSG_NOSIGNAL);
+                }
+                else if (0 == line.rfind("MSG", 0))
+                {
+                    received++;
+                }
+                else if ("BYE" == line)
+                {
+                    sawBye = true;
+                }
+            }
+            if (!paused && 0 < received)
+            {
+                pausedAt = Scheduler::Clock::now();
+                std::this_thread::sleep_for(std::chrono::milliseconds(PAUSE));
+                resumedAt = Scheduler::Clock::now();
+                paused = true;
+            }
+            if (sawBye)
+                break;
+        }
+        close(client);
+    });
+
+    Scheduler scheduler;
+    TcpSession session(scheduler, "", "127.0.0.1", ntohs(address.sin_port), 1000);
+    // Small Send Buffer Fills Up Quickly, The Rest Waits In unsent
+    SocketOptions_t options;
+    options.profile = "custom";
+    options.sendBuffer = 8192;
+    session.setSocketOptions(options);
+    std::vector<Scheduler::Clock::time_point> ticks;
+    bool stopped = false;
+    Task<> timer = tick(scheduler, ticks, stopped);
+    timer.start();
+    session.handleLine("/auth u s Alice");
+    const std::string line(LENGHT_CONTENT, 'x');
+    for (int idx = 0; idx < MESSAGES; idx++)
+        session.handleLine(line);
+    session.requestLeave();
+    session.start();
+
+    testing::internal::CaptureStdout();
+    testing::internal::CaptureStderr();
+    const auto deadline = Scheduler::Clock::now() + std::chrono::milliseconds(10000);
+    while (!session.isFinished() && Scheduler::Clock::now() < deadline)
+        scheduler.runOnce();
+    testing::internal::GetCapturedStdout();
+    testing::internal::GetCapturedStderr();
+    stopped = true;
+    server.join();
+    close(listener);
+
+    ASSERT_TRUE(session.isFinished());
+    EXPECT_EQ(SUCCESS, session.getExitCode());
+    EXPECT_EQ(MESSAGES, received);
+    EXPECT_TRUE(sawBye);
+    // Timer Kept Running While The Server Did Not Read
+    size_t paused = 0;
+    for (const Scheduler::Clock::time_point& at : ticks)
+    {
+        if (pausedAt + std::chrono::milliseconds(PAUSE / 3) < at && at < resumedAt)
+            paused++;
+    }
+    EXPECT_LT(0u, paused);
+}
@@ -0,0 +1,136 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_timestamps.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Kernel RX/TX Timestamps On Loopback Sockets.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_timestamps.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Kernel RX/TX Timestamps On Loopback Sockets.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include <poll.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include "../src/timestamps.cpp"
+
+/**
+ * @brief UDP Socket Bound To Loopback On Ephemeral Port
+ */
+static int boundSocket(struct sockaddr_storage& address)
+{
+    int sock = socket(AF_INET, SOCK_DGRAM, 0);
+    struct sockaddr_in* inet = reinterpret_cast<struct sockaddr_in*>(&address);
+    memset(&address, 0, sizeof(address));
+    inet->sin_family = AF_INET;
+    inet->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    bind(sock, reinterpret_cast<struct sockaddr*>(&address), sizeof(*inet));
+    socklen_t length = sizeof(address);
+    getsockname(sock, reinterpret_cast<struct sockaddr*>(&address), &length);
+    return sock;
+}
+
+/**
+ * @brief Sends Datagram And Counts It Like UdpSession Does
+ */
+static void sendCounted(KernelTimestamps& timestamps, int sock, const struct sockaddr_storage& to, char byte)
+{
+    ssize_t bytesTx = sendto(sock, &byte, 1, 0, reinterpret_cast<const struct sockaddr*>(&to), sizeof(struct sockaddr_in));
+    ASSERT_EQ(1, bytesTx);
+    timestamps.countTransmit();
+}
+
+/**
+ * @brief Echoes One Datagram Back To Its Sender
+ */
+static void echo(int sock)
+{
+    char byte;
+    struct sockaddr_storage from;
+    socklen_t length = sizeof(from);
+    ASSERT_EQ(1, recvfrom(sock, &byte, 1, 0, reinterpret_cast<struct sockaddr*>(&from), &length));
+    ASSERT_EQ(1, sendto(sock, &byte, 1, 0, reinterpret_cast<struct sockaddr*>(&from), length));
+}
+
+/**
+ * @brief Receives The Echo With Its RX Timestamp
+ */
+static void receiveEcho(KernelTimestamps& timestamps, int sock)
+{
+    struct pollfd waiting = {sock, POLLIN, 0};
+    ASSERT_EQ(1, poll(&waiting, 1, 1000));
+    char byte;
+    struct sockaddr_storage from;
+    socklen_t length = sizeof(from);
+    ASSERT_EQ(1, timestamps.receive(sock, &byte, 1, &from, &length));
+}
+
+/**
+* @brief Test that RTT of the awaited datagram is measured, datagrams sent before it included
+*/
+TEST(TimestampsTest, NetworkRttOnLoopback) {
+    struct sockaddr_storage clientAddress, serverAddress;
+    int client = boundSocket(clientAddress);
+    int server = boundSocket(serverAddress);
+    KernelTimestamps timestamps;
+    ASSERT_EQ(SUCCESS, timestamps.enable(client));
+
+    // Earlier Datagrams, Like CONFIRMs, Shift Kernel Numbering Of The Awaited One
+    sendCounted(timestamps, client, serverAddress, 'a');
+    echo(server);
+    receiveEcho(timestamps, client);
+    sendCounted(timestamps, client, serverAddress, 'b');
+    timestamps.expectConfirm();
+    echo(server);
+    receiveEcho(timestamps, client);
+
+    double rttMs = -1.0;
+    EXPECT_TRUE(timestamps.networkRtt(client, rttMs));
+    EXPECT_LE(0.0, rttMs);
+    EXPECT_GT(1000.0, rttMs);
+    close(client);
+    close(server);
+}
+
+/**
+* @brief Test that datagrams of another socket do not shift numbering of TX timestamps
+*/
+TEST(TimestampsTest, OtherSocketDoesNotShiftNumbering) {
+    struct sockaddr_storage firstAddress, secondAddress, firstServerAddress, secondServerAddress;
+    int first = boundSocket(firstAddress);
+    int second = boundSocket(secondAddress);
+    int firstServer = boundSocket(firstServerAddress);
+    int secondServer = boundSocket(secondServerAddress);
+    KernelTimestamps firstStamps, secondStamps;
+    ASSERT_EQ(SUCCESS, firstStamps.enable(first));
+    ASSERT_EQ(SUCCESS, secondStamps.enable(second));
+
+    // Second Socket Sends While The First Awaits Its Answer
+    sendCounted(firstStamps, first, firstServerAddress, 'a');
+    firstStamps.expectConfirm();
+    for (int idx = 0; idx < 3; idx++)
+    {
+        sendCounted(secondStamps, second, secondServerAddress, 'b');
+        echo(secondServer);
+        receiveEcho(secondStamps, second);
+    }
+    secondStamps.expectConfirm();
+    echo(firstServer);
+    receiveEcho(firstStamps, first);
+
+    double rttMs = -1.0;
+    EXPECT_TRUE(firstStamps.networkRtt(first, rttMs));
+    EXPECT_LE(0.0, rttMs);
+    EXPECT_TRUE(secondStamps.networkRtt(second, rttMs));
+    close(first);
+    close(second);
+    close(firstServer);
+    close(secondServer);
+}
@@ -0,0 +1,79 @@
+/******************************
+ *  Project:        IPK Project 1 - Client for Chat Servers
+ *  File Name:      test_tokenBucket.cpp
+ *  Author:         Tomas Dolak
+ *  Date:           19.10.2026
+ *  Description:    Unit Tests For Token Bucket Pacing Outgoing Messages.
+ *
+ * ****************************/
+
+/******************************
+ *  @package        IPK Project 1 - Client for Chat Servers
+ *  @file           test_tokenBucket.cpp
+ *  @author         Tomas Dolak
+ *  @date           19.10.2026
+ *  @brief          Unit Tests For Token Bucket Pacing Outgoing Messages.
+ * ****************************/
+
+#include <gtest/gtest.h>
+#include "../src/token_bucket.cpp"
+
+using namespace std::chrono_literals;
+
+/**
+* @brief Sends One Message At The Given Time Like Session::pace(), If The Bucket Allows It
+*/
+static bool sendAt(TokenBucket& bucket, TokenBucket::Clock::time_point at)
+{
+    if (bucket.readyAt(at) != at)
+        return false;
+    bucket.take();
+    return true;
+}
+
+/**
+* @brief Test that bucket without rate never limits
+*/
+TEST(TokenBucketTest, UnlimitedByDefault) {
+    TokenBucket bucket;
+    auto now = TokenBucket::Clock::now();
+    for (int idx = 0; idx < 1000; idx++)
+        EXPECT_TRUE(sendAt(bucket, now));
+    EXPECT_EQ(bucket.readyAt(now), now);
+}
+
+/**
+* @brief Test that full bucket lets burst out and then paces by rate
+*/
+TEST(TokenBucketTest, BurstThenRate) {
+    TokenBucket bucket;
+    auto start = TokenBucket::Clock::now();
+    bucket.configure(10.0, 3, start);
+
+    EXPECT_TRUE(sendAt(bucket, start));
+    EXPECT_TRUE(sendAt(bucket, start));
+    EXPECT_TRUE(sendAt(bucket, start));
+    EXPECT_FALSE(sendAt(bucket, start));
+    EXPECT_EQ(bucket.readyAt(start), start + 100ms);
+
+    EXPECT_FALSE(sendAt(bucket, start + 99ms));
+    EXPECT_TRUE(sendAt(bucket, start + 100ms));
+    EXPECT_EQ(bucket.readyAt(start + 150ms), start + 200ms);
+}
+
+/**
+* @brief Test that idle bucket refills only up to burst
+*/
+TEST(TokenBucketTest, RefillIsCappedByBurst) {
+    TokenBucket bucket;
+    auto start = TokenBucket::Clock::now();
+    bucket.configure(100.0, 2, start);
+    EXPECT_TRUE(sendAt(bucket, start));
+    EXPECT_TRUE(sendAt(bucket, start));
+
+    auto later = start + 10s;
+    EXPECT_TRUE(sendAt(bucket, later));
+    EXPECT_TRUE(sendAt(bucket, later));
+    EXPECT_FALSE(sendAt(bucket, later));
+    EXPECT_EQ(bucket.readyAt(later), later + 10ms);
+}